@@ -0,0 +1,45 @@
+
+;  888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+;  8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+;  88888b.d88888 888    888 888          d8P 888  888  d8P
+;  888Y88888P888 888        888d888b.   d8P  888  888d88K
+;  888 Y888P 888 888        888P "Y88b d88   888  8888888b
+;  888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+;  888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+;  888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+;
+;   - 64-bit 680x0-inspired Virtual Machine and assembler -
+;
+
+    @def batch_vector #5
+
+    @equ ERR_BATCH_BAD_VECTOR     1100
+    @equ ERR_BATCH_BAD_COMMAND    1101
+    @equ ERR_BATCH_BAD_FUNCTION   1102
+    @equ ERR_BATCH_TOO_DEEP       1103
+
+    ; Command record layout, followed by one quad per load bit set
+    @equ BATCH_CMD_VECTOR    0
+    @equ BATCH_CMD_FUNCTION  1
+    @equ BATCH_CMD_LOAD      2
+    @equ BATCH_CMD_FLAGS     4
+    @equ BATCH_CMD_VALUES    8
+
+    ; Register load bits
+    @equ BATCH_LOAD_D0    1
+    @equ BATCH_LOAD_D1    2
+    @equ BATCH_LOAD_D2    4
+    @equ BATCH_LOAD_A0    8
+    @equ BATCH_LOAD_A1   16
+    @equ BATCH_LOAD_A2   32
+    @equ BATCH_LOAD_FP0  64
+    @equ BATCH_LOAD_FP1 128
+    @equ BATCH_LOAD_FP2 256
+
+    ; Command flags
+    @equ BATCH_STOP_ON_ERROR 1
+
+    @equ batch_init     #0, batch_vector
+    @equ batch_done     #1, batch_vector
+    @equ batch_exec     #2, batch_vector
+    @equ batch_validate #3, batch_vector
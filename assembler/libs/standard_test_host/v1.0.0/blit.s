@@ -0,0 +1,42 @@
+
+;  888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+;  8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+;  88888b.d88888 888    888 888          d8P 888  888  d8P
+;  888Y88888P888 888        888d888b.   d8P  888  888d88K
+;  888 Y888P 888 888        888P "Y88b d88   888  8888888b
+;  888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+;  888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+;  888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+;
+;   - 64-bit 680x0-inspired Virtual Machine and assembler -
+;
+
+    @def blit_vector #6
+
+    @equ ERR_BLIT_BAD_SURFACE 1200
+    @equ ERR_BLIT_BAD_FORMAT  1201
+
+    ; Surface record layout
+    @equ BLIT_SURFACE_PIXELS  0
+    @equ BLIT_SURFACE_REMAP   8
+    @equ BLIT_SURFACE_WIDTH  16
+    @equ BLIT_SURFACE_HEIGHT 20
+    @equ BLIT_SURFACE_STRIDE 24
+    @equ BLIT_SURFACE_FORMAT 28
+    @equ BLIT_SURFACE_SIZE   32
+
+    ; Rect record layout
+    @equ BLIT_RECT_X       0
+    @equ BLIT_RECT_Y       4
+    @equ BLIT_RECT_WIDTH   8
+    @equ BLIT_RECT_HEIGHT 12
+    @equ BLIT_RECT_SIZE   16
+
+    @equ blit_init            #0, blit_vector
+    @equ blit_done            #1, blit_vector
+    @equ blit_display_surface #2, blit_vector
+    @equ blit_fill            #3, blit_vector
+    @equ blit_copy            #4, blit_vector
+    @equ blit_copy_key        #5, blit_vector
+    @equ blit_copy_remap      #6, blit_vector
+    @equ blit_blend           #7, blit_vector
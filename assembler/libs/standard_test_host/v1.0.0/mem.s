@@ -18,6 +18,14 @@
     @equ ERR_NO_MEM             100
     @equ ERR_MEM                101
     @equ ERR_MEM_INVALID_BUFFER 102
+    @equ ERR_MEM_INVALID_BLOCK  105
+    @equ ERR_MEM_INVALID_ARENA  106
+    @equ ERR_MEM_ARENA_FULL     107
+    @equ ERR_MEM_ARENA_CORRUPT  108
+
+    ; Frame arena check flags
+    @equ MEM_ARENA_GUARD        1
+    @equ MEM_ARENA_POISON       2
 
     @def mem_vector         #1
 
@@ -66,3 +74,10 @@
 
     @equ mem_strlen        #32, mem_vector
     @equ mem_strcmp        #33, mem_vector
+
+    @equ mem_free_all      #34, mem_vector
+
+    @equ mem_arena_create  #35, mem_vector
+    @equ mem_arena_alloc   #36, mem_vector
+    @equ mem_arena_reset   #37, mem_vector
+    @equ mem_arena_destroy #38, mem_vector
@@ -0,0 +1,72 @@
+
+;  888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+;  8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+;  88888b.d88888 888    888 888          d8P 888  888  d8P
+;  888Y88888P888 888        888d888b.   d8P  888  888d88K
+;  888 Y888P 888 888        888P "Y88b d88   888  8888888b
+;  888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+;  888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+;  888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+;
+;   - 64-bit 680x0-inspired Virtual Machine and assembler -
+;
+
+    @def raster_vector #7
+
+    @equ ERR_RASTER_BAD_MODE    1300
+    @equ ERR_RASTER_BAD_TEXTURE 1301
+
+    ; Triangle modes
+    @equ RASTER_MODE_FLAT                0
+    @equ RASTER_MODE_GOURAUD             1
+    @equ RASTER_MODE_TEXTURE             2
+    @equ RASTER_MODE_TEXTURE_PERSPECTIVE 3
+
+    ; Triangle flags, to be combined with the mode
+    @equ RASTER_FLAG_KEY      256
+    @equ RASTER_FLAG_PARALLEL 512
+
+    ; Vertex record layout
+    @equ RASTER_VERTEX_X       0
+    @equ RASTER_VERTEX_Y       4
+    @equ RASTER_VERTEX_W       8
+    @equ RASTER_VERTEX_U      12
+    @equ RASTER_VERTEX_V      16
+    @equ RASTER_VERTEX_COLOUR 20
+    @equ RASTER_VERTEX_SIZE   24
+
+    ; Span record layout
+    @equ RASTER_SPAN_X       0
+    @equ RASTER_SPAN_Y       4
+    @equ RASTER_SPAN_LENGTH  8
+    @equ RASTER_SPAN_PIXEL  12
+    @equ RASTER_SPAN_SIZE   16
+
+    ; Wrap modes for raster_affine, to be combined with RASTER_FLAG_KEY
+    @equ RASTER_WRAP_REPEAT 0
+    @equ RASTER_WRAP_CLAMP  1
+    @equ RASTER_WRAP_NONE   2
+
+    ; Transform record layout, the rectangle is a Blit rect record
+    @equ RASTER_TRANSFORM_RECT   0
+    @equ RASTER_TRANSFORM_U     16
+    @equ RASTER_TRANSFORM_V     20
+    @equ RASTER_TRANSFORM_DUDX  24
+    @equ RASTER_TRANSFORM_DVDX  28
+    @equ RASTER_TRANSFORM_DUDY  32
+    @equ RASTER_TRANSFORM_DVDY  36
+    @equ RASTER_TRANSFORM_LINES 40
+    @equ RASTER_TRANSFORM_SIZE  48
+
+    ; Transform line record layout
+    @equ RASTER_LINE_U     0
+    @equ RASTER_LINE_V     4
+    @equ RASTER_LINE_DUDX  8
+    @equ RASTER_LINE_DVDX 12
+    @equ RASTER_LINE_SIZE 16
+
+    @equ raster_init      #0, raster_vector
+    @equ raster_done      #1, raster_vector
+    @equ raster_triangles #2, raster_vector
+    @equ raster_spans     #3, raster_vector
+    @equ raster_affine    #4, raster_vector
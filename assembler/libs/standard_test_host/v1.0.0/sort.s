@@ -0,0 +1,36 @@
+
+;  888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+;  8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+;  88888b.d88888 888    888 888          d8P 888  888  d8P
+;  888Y88888P888 888        888d888b.   d8P  888  888d88K
+;  888 Y888P 888 888        888P "Y88b d88   888  8888888b
+;  888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+;  888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+;  888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+;
+;   - 64-bit 680x0-inspired Virtual Machine and assembler -
+;
+
+    @def sort_vector #8
+
+    @equ ERR_SORT_BAD_MODE 1400
+
+    ; Key types
+    @equ SORT_TYPE_UINT16  0
+    @equ SORT_TYPE_INT16   1
+    @equ SORT_TYPE_UINT32  2
+    @equ SORT_TYPE_INT32   3
+    @equ SORT_TYPE_FLOAT32 4
+    @equ SORT_TYPE_UINT64  5
+    @equ SORT_TYPE_INT64   6
+    @equ SORT_TYPE_FLOAT64 7
+
+    ; Sort flags, to be combined with the key type
+    @equ SORT_FLAG_DESCENDING  256
+    @equ SORT_FLAG_PAYLOAD_64  512
+    @equ SORT_FLAG_INDEX      1024
+    @equ SORT_FLAG_PARALLEL   2048
+
+    @equ sort_init #0, sort_vector
+    @equ sort_done #1, sort_vector
+    @equ sort_keys #2, sort_vector
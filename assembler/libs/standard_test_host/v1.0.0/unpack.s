@@ -0,0 +1,35 @@
+
+;  888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+;  8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+;  88888b.d88888 888    888 888          d8P 888  888  d8P
+;  888Y88888P888 888        888d888b.   d8P  888  888d88K
+;  888 Y888P 888 888        888P "Y88b d88   888  8888888b
+;  888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+;  888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+;  888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+;
+;   - 64-bit 680x0-inspired Virtual Machine and assembler -
+;
+
+    @def unpack_vector #9
+
+    @equ ERR_UNPACK_BAD_MODE    1500
+    @equ ERR_UNPACK_BAD_DATA    1501
+    @equ ERR_UNPACK_TARGET_FULL 1502
+    @equ ERR_UNPACK_CHECKSUM    1503
+    @equ ERR_UNPACK_BAD_JOB     1504
+
+    ; Packed formats
+    @equ UNPACK_FORMAT_LZ4_FRAME 0
+    @equ UNPACK_FORMAT_LZ4_BLOCK 1
+    @equ UNPACK_FORMAT_RLE       2
+
+    ; Unpack flags, to be combined with the format
+    @equ UNPACK_FLAG_FILE 256
+
+    @equ unpack_init   #0, unpack_vector
+    @equ unpack_done   #1, unpack_vector
+    @equ unpack_decode #2, unpack_vector
+    @equ unpack_start  #3, unpack_vector
+    @equ unpack_poll   #4, unpack_vector
+    @equ unpack_wait   #5, unpack_vector
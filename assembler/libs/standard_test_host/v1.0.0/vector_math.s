@@ -181,3 +181,16 @@
     @equ mat4x4d_trans        #149, vecmath_vector
     @equ mat4x4d_det          #150, vecmath_vector
     @equ mat4x4d_inv          #151, vecmath_vector
+
+    ; Visibility. Spheres are { x, y, z, r }, boxes are { min x, y, z, max x, y, z } and frustums are 6 planes of
+    ; { a, b, c, d }, all float32. The cull calls take the volumes in a0, the frustum in a1, the output in a2 and the
+    ; count in d0 and return the visible count in d0.
+    @equ mat4x4f_frustum      #152, vecmath_vector
+    @equ cull_spheres_mask    #153, vecmath_vector
+    @equ cull_spheres_index   #154, vecmath_vector
+    @equ cull_boxes_mask      #155, vecmath_vector
+    @equ cull_boxes_index     #156, vecmath_vector
+
+    @equ FRUSTUM_SIZE 96
+    @equ SPHERE_SIZE  16
+    @equ BOX_SIZE     24
@@ -55,9 +55,19 @@ const CLASS_MAP = [
   'ABadCafe\\MC64K\\Parser\\SourceLine\\Instruction\\OperandSet\\PackedFPRPair' => '/parser/source_line/instruction/operand_set/PackedFPRPair.php',
   'ABadCafe\\MC64K\\Parser\\SourceLine\\Instruction\\OperandSet\\FloatSMCDyadic' => '/parser/source_line/instruction/operand_set/FloatSMCDyadic.php',
   'ABadCafe\\MC64K\\Parser\\SourceLine\\Instruction\\OperandSet\\PackedFPRTriad' => '/parser/source_line/instruction/operand_set/PackedFPRTriad.php',
+  'ABadCafe\\MC64K\\Parser\\SourceLine\\Instruction\\OperandSet\\PackedVRPair' => '/parser/source_line/instruction/operand_set/PackedVRPair.php',
+  'ABadCafe\\MC64K\\Parser\\SourceLine\\Instruction\\OperandSet\\PackedVRTriad' => '/parser/source_line/instruction/operand_set/PackedVRTriad.php',
+  'ABadCafe\\MC64K\\Parser\\SourceLine\\Instruction\\OperandSet\\PackedVRImmediate' => '/parser/source_line/instruction/operand_set/PackedVRImmediate.php',
+  'ABadCafe\\MC64K\\Parser\\SourceLine\\Instruction\\OperandSet\\VectorMemory' => '/parser/source_line/instruction/operand_set/VectorMemory.php',
+  'ABadCafe\\MC64K\\Parser\\SourceLine\\Instruction\\OperandSet\\BitCount' => '/parser/source_line/instruction/operand_set/BitCount.php',
+  'ABadCafe\\MC64K\\Parser\\SourceLine\\Instruction\\OperandSet\\BitField' => '/parser/source_line/instruction/operand_set/BitField.php',
+  'ABadCafe\\MC64K\\Parser\\SourceLine\\Instruction\\OperandSet\\Select' => '/parser/source_line/instruction/operand_set/Select.php',
+  'ABadCafe\\MC64K\\Parser\\SourceLine\\Instruction\\OperandSet\\MinMax' => '/parser/source_line/instruction/operand_set/MinMax.php',
+  'ABadCafe\\MC64K\\Parser\\SourceLine\\Instruction\\OperandSet\\Block' => '/parser/source_line/instruction/operand_set/Block.php',
   'ABadCafe\\MC64K\\Parser\\SourceLine\\Instruction\\OperandSet\\PackedGPRPair' => '/parser/source_line/instruction/operand_set/PackedGPRPair.php',
   'ABadCafe\\MC64K\\Parser\\SourceLine\\Instruction\\OperandSet\\TBranching' => '/parser/source_line/instruction/operand_set/abstract/TBranching.php',
   'ABadCafe\\MC64K\\Parser\\SourceLine\\Instruction\\OperandSet\\Tetradic' => '/parser/source_line/instruction/operand_set/abstract/Tetradic.php',
+  'ABadCafe\\MC64K\\Parser\\SourceLine\\Instruction\\OperandSet\\Polyadic' => '/parser/source_line/instruction/operand_set/abstract/Polyadic.php',
   'ABadCafe\\MC64K\\Parser\\SourceLine\\Instruction\\OperandSet\\Monadic' => '/parser/source_line/instruction/operand_set/abstract/Monadic.php',
   'ABadCafe\\MC64K\\Parser\\SourceLine\\Instruction\\OperandSet\\MonadicBranch' => '/parser/source_line/instruction/operand_set/abstract/MonadicBranch.php',
   'ABadCafe\\MC64K\\Parser\\SourceLine\\Instruction\\OperandSet\\Dyadic' => '/parser/source_line/instruction/operand_set/abstract/Dyadic.php',
@@ -76,12 +86,14 @@ const CLASS_MAP = [
   'ABadCafe\\MC64K\\Parser\\EffectiveAddress\\IPotentiallyFoldableImmediateParser' => '/parser/effective_address/IPotentiallyFoldableImmediateParser.php',
   'ABadCafe\\MC64K\\Parser\\EffectiveAddress\\GPRIndirectIndexed' => '/parser/effective_address/GPRIndirectIndexed.php',
   'ABadCafe\\MC64K\\Parser\\EffectiveAddress\\FPRDirect' => '/parser/effective_address/FPRDirect.php',
+  'ABadCafe\\MC64K\\Parser\\EffectiveAddress\\VRDirect' => '/parser/effective_address/VRDirect.php',
   'ABadCafe\\MC64K\\Parser\\EffectiveAddress\\IParser' => '/parser/effective_address/IParser.php',
   'ABadCafe\\MC64K\\Parser\\EffectiveAddress\\ARDirect' => '/parser/effective_address/ARDirect.php',
   'ABadCafe\\MC64K\\Parser\\EffectiveAddress\\TDisplacementSizeAware' => '/parser/effective_address/TDisplacementSizeAware.php',
   'ABadCafe\\MC64K\\Parser\\EffectiveAddress\\TOperationSizeAware' => '/parser/effective_address/TOperationSizeAware.php',
   'ABadCafe\\MC64K\\Parser\\EffectiveAddress\\TPotentiallyFoldableImmediateAware' => '/parser/effective_address/TPotentiallyFoldableImmediateAware.php',
   'ABadCafe\\MC64K\\Parser\\EffectiveAddress\\AllControlAddressing' => '/parser/effective_address/AllControlAddressing.php',
+  'ABadCafe\\MC64K\\Parser\\EffectiveAddress\\AllMemoryAddressing' => '/parser/effective_address/AllMemoryAddressing.php',
   'ABadCafe\\MC64K\\Parser\\EffectiveAddress\\GPRIndirectIndexedDisplacement' => '/parser/effective_address/GPRIndirectIndexedDisplacement.php',
   'ABadCafe\\MC64K\\Parser\\EffectiveAddress\\FloatImmediate' => '/parser/effective_address/FloatImmediate.php',
   'ABadCafe\\MC64K\\Parser\\EffectiveAddress\\AllIntegerReadable' => '/parser/effective_address/AllIntegerReadable.php',
@@ -132,6 +144,10 @@ const CLASS_MAP = [
   'ABadCafe\\MC64K\\Defs\\Mnemonic\\IControl' => '/defs/mnemonic/IControl.php',
   'ABadCafe\\MC64K\\Defs\\Mnemonic\\IByteCodeGroups' => '/defs/mnemonic/IByteCodeGroups.php',
   'ABadCafe\\MC64K\\Defs\\Mnemonic\\IArithmetic' => '/defs/mnemonic/IArithmetic.php',
+  'ABadCafe\\MC64K\\Defs\\Mnemonic\\IVector' => '/defs/mnemonic/IVector.php',
+  'ABadCafe\\MC64K\\Defs\\Mnemonic\\IBit' => '/defs/mnemonic/IBit.php',
+  'ABadCafe\\MC64K\\Defs\\Mnemonic\\ISelect' => '/defs/mnemonic/ISelect.php',
+  'ABadCafe\\MC64K\\Defs\\Mnemonic\\IBlock' => '/defs/mnemonic/IBlock.php',
   'ABadCafe\\MC64K\\Defs\\Mnemonic\\ILogical' => '/defs/mnemonic/ILogical.php',
   'ABadCafe\\MC64K\\Defs\\Mnemonic\\IMatches' => '/defs/mnemonic/IMatches.php',
   'ABadCafe\\MC64K\\Defs\\Mnemonic\\IOperandSizes' => '/defs/mnemonic/IOperandSizes.php',
@@ -0,0 +1,53 @@
+<?php
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+declare(strict_types = 1);
+
+namespace ABadCafe\MC64K\Defs\Mnemonic;
+
+/**
+ * IBit
+ *
+ * Enumerates the bit manipulation operations. These share a single BIT opcode followed by a sub-opcode byte
+ * that selects the operation.
+ */
+interface IBit extends IByteCodeGroups {
+    const
+        BIT = self::OFS_OTHER + 1,
+
+        // Count leading zeros
+        CLZ_B    = self::BIT << 8 | 0,
+        CLZ_W    = self::BIT << 8 | 1,
+        CLZ_L    = self::BIT << 8 | 2,
+        CLZ_Q    = self::BIT << 8 | 3,
+
+        // Count trailing zeros
+        CTZ_B    = self::BIT << 8 | 4,
+        CTZ_W    = self::BIT << 8 | 5,
+        CTZ_L    = self::BIT << 8 | 6,
+        CTZ_Q    = self::BIT << 8 | 7,
+
+        // Count set bits
+        POPCNT_B = self::BIT << 8 | 8,
+        POPCNT_W = self::BIT << 8 | 9,
+        POPCNT_L = self::BIT << 8 | 10,
+        POPCNT_Q = self::BIT << 8 | 11,
+
+        // Bit fields
+        BFEXTU   = self::BIT << 8 | 12,
+        BFEXTS   = self::BIT << 8 | 13,
+        BFINS    = self::BIT << 8 | 14
+    ;
+}
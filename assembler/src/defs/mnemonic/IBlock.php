@@ -0,0 +1,42 @@
+<?php
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+declare(strict_types = 1);
+
+namespace ABadCafe\MC64K\Defs\Mnemonic;
+
+/**
+ * IBlock
+ *
+ * Enumerates the block memory operations. These share a single BLK opcode followed by a sub-opcode byte that
+ * selects the operation.
+ */
+interface IBlock extends IByteCodeGroups {
+    const
+        BLK = self::OFS_OTHER + 4,
+
+        // Overlap safe block move
+        BMOVE   = self::BLK << 8 | 0,
+
+        // Block fill
+        BFILL_B = self::BLK << 8 | 1,
+        BFILL_W = self::BLK << 8 | 2,
+        BFILL_L = self::BLK << 8 | 3,
+        BFILL_Q = self::BLK << 8 | 4,
+
+        // Block compare
+        BCMP    = self::BLK << 8 | 5
+    ;
+}
@@ -437,5 +437,186 @@ interface IMatches {
         'flog2.d'   => IArithmetic::FLOG2_D,
         'ftwotox.s' => IArithmetic::FTWOTOX_S,
         'ftwotox.d' => IArithmetic::FTWOTOX_D,
+
+        // Packed vector operations
+        'vload'     => IVector::VLOAD,
+        'vstore'    => IVector::VSTORE,
+        'vmove'     => IVector::VMOVE,
+        'vclr'      => IVector::VCLR,
+        'vsplat.b'  => IVector::VSPLAT_B,
+        'vsplat.w'  => IVector::VSPLAT_W,
+        'vsplat.l'  => IVector::VSPLAT_L,
+        'vsplat.q'  => IVector::VSPLAT_Q,
+
+        'vand'      => IVector::VAND,
+        'vor'       => IVector::VOR,
+        'veor'      => IVector::VEOR,
+        'vandn'     => IVector::VANDN,
+
+        'vadd.b'    => IVector::VADD_B,
+        'vadd.w'    => IVector::VADD_W,
+        'vadd.l'    => IVector::VADD_L,
+        'vadd.q'    => IVector::VADD_Q,
+        'vsub.b'    => IVector::VSUB_B,
+        'vsub.w'    => IVector::VSUB_W,
+        'vsub.l'    => IVector::VSUB_L,
+        'vsub.q'    => IVector::VSUB_Q,
+        'vadds.b'   => IVector::VADDS_B,
+        'vadds.w'   => IVector::VADDS_W,
+        'vaddus.b'  => IVector::VADDUS_B,
+        'vaddus.w'  => IVector::VADDUS_W,
+        'vsubs.b'   => IVector::VSUBS_B,
+        'vsubs.w'   => IVector::VSUBS_W,
+        'vsubus.b'  => IVector::VSUBUS_B,
+        'vsubus.w'  => IVector::VSUBUS_W,
+        'vmul.w'    => IVector::VMUL_W,
+        'vmul.l'    => IVector::VMUL_L,
+        'vlsl.w'    => IVector::VLSL_W,
+        'vlsl.l'    => IVector::VLSL_L,
+        'vlsl.q'    => IVector::VLSL_Q,
+        'vlsr.w'    => IVector::VLSR_W,
+        'vlsr.l'    => IVector::VLSR_L,
+        'vlsr.q'    => IVector::VLSR_Q,
+        'vasr.w'    => IVector::VASR_W,
+        'vasr.l'    => IVector::VASR_L,
+
+        'vfadd.s'   => IVector::VFADD_S,
+        'vfadd.d'   => IVector::VFADD_D,
+        'vfsub.s'   => IVector::VFSUB_S,
+        'vfsub.d'   => IVector::VFSUB_D,
+        'vfmul.s'   => IVector::VFMUL_S,
+        'vfmul.d'   => IVector::VFMUL_D,
+        'vfdiv.s'   => IVector::VFDIV_S,
+        'vfdiv.d'   => IVector::VFDIV_D,
+        'vfma.s'    => IVector::VFMA_S,
+        'vfma.d'    => IVector::VFMA_D,
+        'vfmin.s'   => IVector::VFMIN_S,
+        'vfmin.d'   => IVector::VFMIN_D,
+        'vfmax.s'   => IVector::VFMAX_S,
+        'vfmax.d'   => IVector::VFMAX_D,
+
+        'vcvtl.s'   => IVector::VCVTL_S,
+        'vcvts.l'   => IVector::VCVTS_L,
+        'vshuf.l'   => IVector::VSHUF_L,
+        'vpackus.w' => IVector::VPACKUS_W,
+        'vextu.b'   => IVector::VEXTU_B,
+
+        // Bit manipulation operations
+        'clz.b'     => IBit::CLZ_B,
+        'clz.w'     => IBit::CLZ_W,
+        'clz.l'     => IBit::CLZ_L,
+        'clz.q'     => IBit::CLZ_Q,
+        'ctz.b'     => IBit::CTZ_B,
+        'ctz.w'     => IBit::CTZ_W,
+        'ctz.l'     => IBit::CTZ_L,
+        'ctz.q'     => IBit::CTZ_Q,
+        'popcnt.b'  => IBit::POPCNT_B,
+        'popcnt.w'  => IBit::POPCNT_W,
+        'popcnt.l'  => IBit::POPCNT_L,
+        'popcnt.q'  => IBit::POPCNT_Q,
+        'bfextu'    => IBit::BFEXTU,
+        'bfexts'    => IBit::BFEXTS,
+        'bfins'     => IBit::BFINS,
+
+        // Conditional select, min, max and clamp
+        'sello.b'   => ISelect::SELLO_B,
+        'sello.w'   => ISelect::SELLO_W,
+        'sello.l'   => ISelect::SELLO_L,
+        'sello.q'   => ISelect::SELLO_Q,
+        'sellt.b'   => ISelect::SELLT_B,
+        'sellt.w'   => ISelect::SELLT_W,
+        'sellt.l'   => ISelect::SELLT_L,
+        'sellt.q'   => ISelect::SELLT_Q,
+        'fsellt.s'  => ISelect::FSELLT_S,
+        'fsellt.d'  => ISelect::FSELLT_D,
+        'sells.b'   => ISelect::SELLS_B,
+        'sells.w'   => ISelect::SELLS_W,
+        'sells.l'   => ISelect::SELLS_L,
+        'sells.q'   => ISelect::SELLS_Q,
+        'selle.b'   => ISelect::SELLE_B,
+        'selle.w'   => ISelect::SELLE_W,
+        'selle.l'   => ISelect::SELLE_L,
+        'selle.q'   => ISelect::SELLE_Q,
+        'fselle.s'  => ISelect::FSELLE_S,
+        'fselle.d'  => ISelect::FSELLE_D,
+        'seleq.b'   => ISelect::SELEQ_B,
+        'seleq.w'   => ISelect::SELEQ_W,
+        'seleq.l'   => ISelect::SELEQ_L,
+        'seleq.q'   => ISelect::SELEQ_Q,
+        'fseleq.s'  => ISelect::FSELEQ_S,
+        'fseleq.d'  => ISelect::FSELEQ_D,
+        'selhs.b'   => ISelect::SELHS_B,
+        'selhs.w'   => ISelect::SELHS_W,
+        'selhs.l'   => ISelect::SELHS_L,
+        'selhs.q'   => ISelect::SELHS_Q,
+        'selge.b'   => ISelect::SELGE_B,
+        'selge.w'   => ISelect::SELGE_W,
+        'selge.l'   => ISelect::SELGE_L,
+        'selge.q'   => ISelect::SELGE_Q,
+        'fselge.s'  => ISelect::FSELGE_S,
+        'fselge.d'  => ISelect::FSELGE_D,
+        'selhi.b'   => ISelect::SELHI_B,
+        'selhi.w'   => ISelect::SELHI_W,
+        'selhi.l'   => ISelect::SELHI_L,
+        'selhi.q'   => ISelect::SELHI_Q,
+        'selgt.b'   => ISelect::SELGT_B,
+        'selgt.w'   => ISelect::SELGT_W,
+        'selgt.l'   => ISelect::SELGT_L,
+        'selgt.q'   => ISelect::SELGT_Q,
+        'fselgt.s'  => ISelect::FSELGT_S,
+        'fselgt.d'  => ISelect::FSELGT_D,
+        'selne.b'   => ISelect::SELNE_B,
+        'selne.w'   => ISelect::SELNE_W,
+        'selne.l'   => ISelect::SELNE_L,
+        'selne.q'   => ISelect::SELNE_Q,
+        'fselne.s'  => ISelect::FSELNE_S,
+        'fselne.d'  => ISelect::FSELNE_D,
+        'selbs.b'   => ISelect::SELBS_B,
+        'selbs.w'   => ISelect::SELBS_W,
+        'selbs.l'   => ISelect::SELBS_L,
+        'selbs.q'   => ISelect::SELBS_Q,
+        'selbc.b'   => ISelect::SELBC_B,
+        'selbc.w'   => ISelect::SELBC_W,
+        'selbc.l'   => ISelect::SELBC_L,
+        'selbc.q'   => ISelect::SELBC_Q,
+
+        'min.b'     => ISelect::MIN_B,
+        'min.w'     => ISelect::MIN_W,
+        'min.l'     => ISelect::MIN_L,
+        'min.q'     => ISelect::MIN_Q,
+        'max.b'     => ISelect::MAX_B,
+        'max.w'     => ISelect::MAX_W,
+        'max.l'     => ISelect::MAX_L,
+        'max.q'     => ISelect::MAX_Q,
+        'minu.b'    => ISelect::MINU_B,
+        'minu.w'    => ISelect::MINU_W,
+        'minu.l'    => ISelect::MINU_L,
+        'minu.q'    => ISelect::MINU_Q,
+        'maxu.b'    => ISelect::MAXU_B,
+        'maxu.w'    => ISelect::MAXU_W,
+        'maxu.l'    => ISelect::MAXU_L,
+        'maxu.q'    => ISelect::MAXU_Q,
+        'fmin.s'    => ISelect::FMIN_S,
+        'fmin.d'    => ISelect::FMIN_D,
+        'fmax.s'    => ISelect::FMAX_S,
+        'fmax.d'    => ISelect::FMAX_D,
+        'clamp.b'   => ISelect::CLAMP_B,
+        'clamp.w'   => ISelect::CLAMP_W,
+        'clamp.l'   => ISelect::CLAMP_L,
+        'clamp.q'   => ISelect::CLAMP_Q,
+        'clampu.b'  => ISelect::CLAMPU_B,
+        'clampu.w'  => ISelect::CLAMPU_W,
+        'clampu.l'  => ISelect::CLAMPU_L,
+        'clampu.q'  => ISelect::CLAMPU_Q,
+        'fclamp.s'  => ISelect::FCLAMP_S,
+        'fclamp.d'  => ISelect::FCLAMP_D,
+
+        // Block memory operations
+        'bmove'     => IBlock::BMOVE,
+        'bfill.b'   => IBlock::BFILL_B,
+        'bfill.w'   => IBlock::BFILL_W,
+        'bfill.l'   => IBlock::BFILL_L,
+        'bfill.q'   => IBlock::BFILL_Q,
+        'bcmp'      => IBlock::BCMP,
     ];
 }
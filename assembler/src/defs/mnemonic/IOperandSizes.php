@@ -423,6 +423,129 @@ interface IOperandSizes {
         IArithmetic::FLOG2_D   => [8, 8],
         IArithmetic::FTWOTOX_S => [4, 4],
         IArithmetic::FTWOTOX_D => [8, 8],
+
+        // Packed vector memory and scalar operands
+        IVector::VLOAD         => [32, 32],
+        IVector::VSTORE        => [32, 32],
+        IVector::VSPLAT_B      => [1, 32],
+        IVector::VSPLAT_W      => [2, 32],
+        IVector::VSPLAT_L      => [4, 32],
+        IVector::VSPLAT_Q      => [8, 32],
+
+        // Bit manipulation
+        IBit::CLZ_B            => [1, 1],
+        IBit::CLZ_W            => [2, 2],
+        IBit::CLZ_L            => [4, 4],
+        IBit::CLZ_Q            => [8, 8],
+        IBit::CTZ_B            => [1, 1],
+        IBit::CTZ_W            => [2, 2],
+        IBit::CTZ_L            => [4, 4],
+        IBit::CTZ_Q            => [8, 8],
+        IBit::POPCNT_B         => [1, 1],
+        IBit::POPCNT_W         => [2, 2],
+        IBit::POPCNT_L         => [4, 4],
+        IBit::POPCNT_Q         => [8, 8],
+        IBit::BFEXTU           => [1, 1, 8, 8],
+        IBit::BFEXTS           => [1, 1, 8, 8],
+        IBit::BFINS            => [1, 1, 8, 8],
+
+        // Conditional select, min, max and clamp
+        ISelect::SELLO_B       => [1, 1, 1, 1, 1],
+        ISelect::SELLO_W       => [2, 2, 2, 2, 2],
+        ISelect::SELLO_L       => [4, 4, 4, 4, 4],
+        ISelect::SELLO_Q       => [8, 8, 8, 8, 8],
+        ISelect::SELLT_B       => [1, 1, 1, 1, 1],
+        ISelect::SELLT_W       => [2, 2, 2, 2, 2],
+        ISelect::SELLT_L       => [4, 4, 4, 4, 4],
+        ISelect::SELLT_Q       => [8, 8, 8, 8, 8],
+        ISelect::FSELLT_S      => [4, 4, 4, 4, 4],
+        ISelect::FSELLT_D      => [8, 8, 8, 8, 8],
+        ISelect::SELLS_B       => [1, 1, 1, 1, 1],
+        ISelect::SELLS_W       => [2, 2, 2, 2, 2],
+        ISelect::SELLS_L       => [4, 4, 4, 4, 4],
+        ISelect::SELLS_Q       => [8, 8, 8, 8, 8],
+        ISelect::SELLE_B       => [1, 1, 1, 1, 1],
+        ISelect::SELLE_W       => [2, 2, 2, 2, 2],
+        ISelect::SELLE_L       => [4, 4, 4, 4, 4],
+        ISelect::SELLE_Q       => [8, 8, 8, 8, 8],
+        ISelect::FSELLE_S      => [4, 4, 4, 4, 4],
+        ISelect::FSELLE_D      => [8, 8, 8, 8, 8],
+        ISelect::SELEQ_B       => [1, 1, 1, 1, 1],
+        ISelect::SELEQ_W       => [2, 2, 2, 2, 2],
+        ISelect::SELEQ_L       => [4, 4, 4, 4, 4],
+        ISelect::SELEQ_Q       => [8, 8, 8, 8, 8],
+        ISelect::FSELEQ_S      => [4, 4, 4, 4, 4],
+        ISelect::FSELEQ_D      => [8, 8, 8, 8, 8],
+        ISelect::SELHS_B       => [1, 1, 1, 1, 1],
+        ISelect::SELHS_W       => [2, 2, 2, 2, 2],
+        ISelect::SELHS_L       => [4, 4, 4, 4, 4],
+        ISelect::SELHS_Q       => [8, 8, 8, 8, 8],
+        ISelect::SELGE_B       => [1, 1, 1, 1, 1],
+        ISelect::SELGE_W       => [2, 2, 2, 2, 2],
+        ISelect::SELGE_L       => [4, 4, 4, 4, 4],
+        ISelect::SELGE_Q       => [8, 8, 8, 8, 8],
+        ISelect::FSELGE_S      => [4, 4, 4, 4, 4],
+        ISelect::FSELGE_D      => [8, 8, 8, 8, 8],
+        ISelect::SELHI_B       => [1, 1, 1, 1, 1],
+        ISelect::SELHI_W       => [2, 2, 2, 2, 2],
+        ISelect::SELHI_L       => [4, 4, 4, 4, 4],
+        ISelect::SELHI_Q       => [8, 8, 8, 8, 8],
+        ISelect::SELGT_B       => [1, 1, 1, 1, 1],
+        ISelect::SELGT_W       => [2, 2, 2, 2, 2],
+        ISelect::SELGT_L       => [4, 4, 4, 4, 4],
+        ISelect::SELGT_Q       => [8, 8, 8, 8, 8],
+        ISelect::FSELGT_S      => [4, 4, 4, 4, 4],
+        ISelect::FSELGT_D      => [8, 8, 8, 8, 8],
+        ISelect::SELNE_B       => [1, 1, 1, 1, 1],
+        ISelect::SELNE_W       => [2, 2, 2, 2, 2],
+        ISelect::SELNE_L       => [4, 4, 4, 4, 4],
+        ISelect::SELNE_Q       => [8, 8, 8, 8, 8],
+        ISelect::FSELNE_S      => [4, 4, 4, 4, 4],
+        ISelect::FSELNE_D      => [8, 8, 8, 8, 8],
+        ISelect::SELBS_B       => [1, 1, 1, 1, 1],
+        ISelect::SELBS_W       => [2, 2, 2, 2, 2],
+        ISelect::SELBS_L       => [4, 4, 4, 4, 4],
+        ISelect::SELBS_Q       => [8, 8, 8, 8, 8],
+        ISelect::SELBC_B       => [1, 1, 1, 1, 1],
+        ISelect::SELBC_W       => [2, 2, 2, 2, 2],
+        ISelect::SELBC_L       => [4, 4, 4, 4, 4],
+        ISelect::SELBC_Q       => [8, 8, 8, 8, 8],
+        ISelect::MIN_B         => [1, 1],
+        ISelect::MIN_W         => [2, 2],
+        ISelect::MIN_L         => [4, 4],
+        ISelect::MIN_Q         => [8, 8],
+        ISelect::MAX_B         => [1, 1],
+        ISelect::MAX_W         => [2, 2],
+        ISelect::MAX_L         => [4, 4],
+        ISelect::MAX_Q         => [8, 8],
+        ISelect::MINU_B        => [1, 1],
+        ISelect::MINU_W        => [2, 2],
+        ISelect::MINU_L        => [4, 4],
+        ISelect::MINU_Q        => [8, 8],
+        ISelect::MAXU_B        => [1, 1],
+        ISelect::MAXU_W        => [2, 2],
+        ISelect::MAXU_L        => [4, 4],
+        ISelect::MAXU_Q        => [8, 8],
+        ISelect::FMIN_S        => [4, 4],
+        ISelect::FMIN_D        => [8, 8],
+        ISelect::FMAX_S        => [4, 4],
+        ISelect::FMAX_D        => [8, 8],
+        ISelect::CLAMP_B       => [1, 1, 1],
+        ISelect::CLAMP_W       => [2, 2, 2],
+        ISelect::CLAMP_L       => [4, 4, 4],
+        ISelect::CLAMP_Q       => [8, 8, 8],
+        ISelect::CLAMPU_B      => [1, 1, 1],
+        ISelect::CLAMPU_W      => [2, 2, 2],
+        ISelect::CLAMPU_L      => [4, 4, 4],
+        ISelect::CLAMPU_Q      => [8, 8, 8],
+        ISelect::FCLAMP_S      => [4, 4, 4],
+        ISelect::FCLAMP_D      => [8, 8, 8],
+        IBlock::BMOVE          => [1, 1, 8],
+        IBlock::BFILL_B        => [1, 1, 8],
+        IBlock::BFILL_W        => [2, 2, 8],
+        IBlock::BFILL_L        => [4, 4, 8],
+        IBlock::BFILL_Q        => [8, 8, 8],
+        IBlock::BCMP           => [1, 1, 8],
     ];
 
 
@@ -0,0 +1,143 @@
+<?php
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+declare(strict_types = 1);
+
+namespace ABadCafe\MC64K\Defs\Mnemonic;
+
+/**
+ * ISelect
+ *
+ * Enumerates the conditional select, minimum, maximum and clamp operations. Conditional select shares a single CSEL
+ * opcode followed by the condition, as per the set on condition operations. The others share a single MINMAX opcode
+ * followed by a sub-opcode byte that selects the operation.
+ */
+interface ISelect extends IByteCodeGroups {
+    const
+        CSEL   = self::OFS_OTHER + 2,
+        MINMAX = self::OFS_OTHER + 3,
+
+        // Select <ea(x)> if <ea(a)> <cc> <ea(b)>, otherwise <ea(y)>
+        SELLO_B   = self::CSEL << 8 | ICondition::ULT_B, // unsigned: Lower
+        SELLO_W   = self::CSEL << 8 | ICondition::ULT_W,
+        SELLO_L   = self::CSEL << 8 | ICondition::ULT_L,
+        SELLO_Q   = self::CSEL << 8 | ICondition::ULT_Q,
+
+        SELLT_B   = self::CSEL << 8 | ICondition::ILT_B, // signed: Less Than
+        SELLT_W   = self::CSEL << 8 | ICondition::ILT_W,
+        SELLT_L   = self::CSEL << 8 | ICondition::ILT_L,
+        SELLT_Q   = self::CSEL << 8 | ICondition::ILT_Q,
+        FSELLT_S  = self::CSEL << 8 | ICondition::FLT_S,
+        FSELLT_D  = self::CSEL << 8 | ICondition::FLT_D,
+
+        SELLS_B   = self::CSEL << 8 | ICondition::ULE_B, // unsigned: Lower or Same
+        SELLS_W   = self::CSEL << 8 | ICondition::ULE_W,
+        SELLS_L   = self::CSEL << 8 | ICondition::ULE_L,
+        SELLS_Q   = self::CSEL << 8 | ICondition::ULE_Q,
+
+        SELLE_B   = self::CSEL << 8 | ICondition::ILE_B, // signed: Less or Equal
+        SELLE_W   = self::CSEL << 8 | ICondition::ILE_W,
+        SELLE_L   = self::CSEL << 8 | ICondition::ILE_L,
+        SELLE_Q   = self::CSEL << 8 | ICondition::ILE_Q,
+        FSELLE_S  = self::CSEL << 8 | ICondition::FLE_S,
+        FSELLE_D  = self::CSEL << 8 | ICondition::FLE_D,
+
+        SELEQ_B   = self::CSEL << 8 | ICondition::IEQ_B,
+        SELEQ_W   = self::CSEL << 8 | ICondition::IEQ_W,
+        SELEQ_L   = self::CSEL << 8 | ICondition::IEQ_L,
+        SELEQ_Q   = self::CSEL << 8 | ICondition::IEQ_Q,
+        FSELEQ_S  = self::CSEL << 8 | ICondition::FEQ_S,
+        FSELEQ_D  = self::CSEL << 8 | ICondition::FEQ_D,
+
+        SELHS_B   = self::CSEL << 8 | ICondition::UGE_B, // unsigned: Higher or Same
+        SELHS_W   = self::CSEL << 8 | ICondition::UGE_W,
+        SELHS_L   = self::CSEL << 8 | ICondition::UGE_L,
+        SELHS_Q   = self::CSEL << 8 | ICondition::UGE_Q,
+
+        SELGE_B   = self::CSEL << 8 | ICondition::IGE_B, // signed: Greater or Equal
+        SELGE_W   = self::CSEL << 8 | ICondition::IGE_W,
+        SELGE_L   = self::CSEL << 8 | ICondition::IGE_L,
+        SELGE_Q   = self::CSEL << 8 | ICondition::IGE_Q,
+        FSELGE_S  = self::CSEL << 8 | ICondition::FGE_S,
+        FSELGE_D  = self::CSEL << 8 | ICondition::FGE_D,
+
+        SELHI_B   = self::CSEL << 8 | ICondition::UGT_B, // unsigned: Higher
+        SELHI_W   = self::CSEL << 8 | ICondition::UGT_W,
+        SELHI_L   = self::CSEL << 8 | ICondition::UGT_L,
+        SELHI_Q   = self::CSEL << 8 | ICondition::UGT_Q,
+
+        SELGT_B   = self::CSEL << 8 | ICondition::IGT_B, // signed: Greater Than
+        SELGT_W   = self::CSEL << 8 | ICondition::IGT_W,
+        SELGT_L   = self::CSEL << 8 | ICondition::IGT_L,
+        SELGT_Q   = self::CSEL << 8 | ICondition::IGT_Q,
+        FSELGT_S  = self::CSEL << 8 | ICondition::FGT_S,
+        FSELGT_D  = self::CSEL << 8 | ICondition::FGT_D,
+
+        SELNE_B   = self::CSEL << 8 | ICondition::INE_B,
+        SELNE_W   = self::CSEL << 8 | ICondition::INE_W,
+        SELNE_L   = self::CSEL << 8 | ICondition::INE_L,
+        SELNE_Q   = self::CSEL << 8 | ICondition::INE_Q,
+        FSELNE_S  = self::CSEL << 8 | ICondition::FNE_S,
+        FSELNE_D  = self::CSEL << 8 | ICondition::FNE_D,
+
+        SELBS_B   = self::CSEL << 8 | ICondition::BPS_B, // bit set
+        SELBS_W   = self::CSEL << 8 | ICondition::BPS_W,
+        SELBS_L   = self::CSEL << 8 | ICondition::BPS_L,
+        SELBS_Q   = self::CSEL << 8 | ICondition::BPS_Q,
+
+        SELBC_B   = self::CSEL << 8 | ICondition::BPC_B, // bit clear
+        SELBC_W   = self::CSEL << 8 | ICondition::BPC_W,
+        SELBC_L   = self::CSEL << 8 | ICondition::BPC_L,
+        SELBC_Q   = self::CSEL << 8 | ICondition::BPC_Q,
+
+        // Minimum and maximum, signed
+        MIN_B     = self::MINMAX << 8 | 0,
+        MIN_W     = self::MINMAX << 8 | 1,
+        MIN_L     = self::MINMAX << 8 | 2,
+        MIN_Q     = self::MINMAX << 8 | 3,
+        MAX_B     = self::MINMAX << 8 | 4,
+        MAX_W     = self::MINMAX << 8 | 5,
+        MAX_L     = self::MINMAX << 8 | 6,
+        MAX_Q     = self::MINMAX << 8 | 7,
+
+        // Minimum and maximum, unsigned
+        MINU_B    = self::MINMAX << 8 | 8,
+        MINU_W    = self::MINMAX << 8 | 9,
+        MINU_L    = self::MINMAX << 8 | 10,
+        MINU_Q    = self::MINMAX << 8 | 11,
+        MAXU_B    = self::MINMAX << 8 | 12,
+        MAXU_W    = self::MINMAX << 8 | 13,
+        MAXU_L    = self::MINMAX << 8 | 14,
+        MAXU_Q    = self::MINMAX << 8 | 15,
+
+        // Minimum and maximum, floating point
+        FMIN_S    = self::MINMAX << 8 | 16,
+        FMIN_D    = self::MINMAX << 8 | 17,
+        FMAX_S    = self::MINMAX << 8 | 18,
+        FMAX_D    = self::MINMAX << 8 | 19,
+
+        // Clamp
+        CLAMP_B   = self::MINMAX << 8 | 20,
+        CLAMP_W   = self::MINMAX << 8 | 21,
+        CLAMP_L   = self::MINMAX << 8 | 22,
+        CLAMP_Q   = self::MINMAX << 8 | 23,
+        CLAMPU_B  = self::MINMAX << 8 | 24,
+        CLAMPU_W  = self::MINMAX << 8 | 25,
+        CLAMPU_L  = self::MINMAX << 8 | 26,
+        CLAMPU_Q  = self::MINMAX << 8 | 27,
+        FCLAMP_S  = self::MINMAX << 8 | 28,
+        FCLAMP_D  = self::MINMAX << 8 | 29
+    ;
+}
@@ -0,0 +1,105 @@
+<?php
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+declare(strict_types = 1);
+
+namespace ABadCafe\MC64K\Defs\Mnemonic;
+
+/**
+ * IVector
+ *
+ * Enumerates the packed vector operations. These share a single VEC opcode followed by a sub-opcode byte
+ * that selects the operation.
+ */
+interface IVector extends IByteCodeGroups {
+    const
+        VEC = self::OFS_OTHER + 0,
+
+        // Data movement
+        VLOAD     = self::VEC << 8 | 0,
+        VSTORE    = self::VEC << 8 | 1,
+        VMOVE     = self::VEC << 8 | 2,
+        VCLR      = self::VEC << 8 | 3,
+        VSPLAT_B  = self::VEC << 8 | 4,
+        VSPLAT_W  = self::VEC << 8 | 5,
+        VSPLAT_L  = self::VEC << 8 | 6,
+        VSPLAT_Q  = self::VEC << 8 | 7,
+
+        // Bitwise
+        VAND      = self::VEC << 8 | 8,
+        VOR       = self::VEC << 8 | 9,
+        VEOR      = self::VEC << 8 | 10,
+        VANDN     = self::VEC << 8 | 11,
+
+        // Integer, modulo
+        VADD_B    = self::VEC << 8 | 12,
+        VADD_W    = self::VEC << 8 | 13,
+        VADD_L    = self::VEC << 8 | 14,
+        VADD_Q    = self::VEC << 8 | 15,
+        VSUB_B    = self::VEC << 8 | 16,
+        VSUB_W    = self::VEC << 8 | 17,
+        VSUB_L    = self::VEC << 8 | 18,
+        VSUB_Q    = self::VEC << 8 | 19,
+
+        // Integer, saturating
+        VADDS_B   = self::VEC << 8 | 20,
+        VADDS_W   = self::VEC << 8 | 21,
+        VADDUS_B  = self::VEC << 8 | 22,
+        VADDUS_W  = self::VEC << 8 | 23,
+        VSUBS_B   = self::VEC << 8 | 24,
+        VSUBS_W   = self::VEC << 8 | 25,
+        VSUBUS_B  = self::VEC << 8 | 26,
+        VSUBUS_W  = self::VEC << 8 | 27,
+
+        // Integer multiply, low half of product
+        VMUL_W    = self::VEC << 8 | 28,
+        VMUL_L    = self::VEC << 8 | 29,
+
+        // Shift by immediate count
+        VLSL_W    = self::VEC << 8 | 30,
+        VLSL_L    = self::VEC << 8 | 31,
+        VLSL_Q    = self::VEC << 8 | 32,
+        VLSR_W    = self::VEC << 8 | 33,
+        VLSR_L    = self::VEC << 8 | 34,
+        VLSR_Q    = self::VEC << 8 | 35,
+        VASR_W    = self::VEC << 8 | 36,
+        VASR_L    = self::VEC << 8 | 37,
+
+        // Floating point
+        VFADD_S   = self::VEC << 8 | 38,
+        VFADD_D   = self::VEC << 8 | 39,
+        VFSUB_S   = self::VEC << 8 | 40,
+        VFSUB_D   = self::VEC << 8 | 41,
+        VFMUL_S   = self::VEC << 8 | 42,
+        VFMUL_D   = self::VEC << 8 | 43,
+        VFDIV_S   = self::VEC << 8 | 44,
+        VFDIV_D   = self::VEC << 8 | 45,
+        VFMA_S    = self::VEC << 8 | 46,
+        VFMA_D    = self::VEC << 8 | 47,
+        VFMIN_S   = self::VEC << 8 | 48,
+        VFMIN_D   = self::VEC << 8 | 49,
+        VFMAX_S   = self::VEC << 8 | 50,
+        VFMAX_D   = self::VEC << 8 | 51,
+
+        // Conversion
+        VCVTL_S   = self::VEC << 8 | 52,
+        VCVTS_L   = self::VEC << 8 | 53,
+
+        // Shuffle and pack
+        VSHUF_L   = self::VEC << 8 | 54,
+        VPACKUS_W = self::VEC << 8 | 55,
+        VEXTU_B   = self::VEC << 8 | 56
+    ;
+}
@@ -57,4 +57,19 @@ class Enumerator implements INames {
         }
         return self::FPR_MAP[$sRegister];
     }
+
+    /**
+     * Returns the integer name for a given vector register
+     *
+     * @param  string $sRegister
+     * @return int
+     * @throws OutOfBoundsException
+     */
+    public static function getVRNumber(string $sRegister): int {
+        $sRegister = strtolower($sRegister);
+        if (!isset(self::VR_MAP[$sRegister])) {
+            throw new OutOfBoundsException($sRegister . ' is not a recognised vector register name');
+        }
+        return self::VR_MAP[$sRegister];
+    }
 }
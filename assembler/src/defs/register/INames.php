@@ -48,4 +48,12 @@ interface INames {
         'fp8'  =>  8, 'fp9'  =>  9, 'fp10' => 10, 'fp11' => 11,
         'fp12' => 12, 'fp13' => 13, 'fp14' => 14, 'fp15' => 15,
     ];
+
+    const VR_MAP = [
+        // Packed vector register names
+        'v0'   =>  0, 'v1'   =>  1, 'v2'   =>  2, 'v3'   =>  3,
+        'v4'   =>  4, 'v5'   =>  5, 'v6'   =>  6, 'v7'   =>  7,
+        'v8'   =>  8, 'v9'   =>  9, 'v10'  => 10, 'v11'  => 11,
+        'v12'  => 12, 'v13'  => 13, 'v14'  => 14, 'v15'  => 15,
+    ];
 }
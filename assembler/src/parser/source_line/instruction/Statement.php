@@ -23,6 +23,7 @@ use ABadCafe\MC64K\Defs\Mnemonic\IDataMove;
 use ABadCafe\MC64K\Defs\Mnemonic\ILogical;
 use ABadCafe\MC64K\Defs\Mnemonic\IArithmetic;
 use ABadCafe\MC64K\Defs\Mnemonic\IControl;
+use ABadCafe\MC64K\Defs\Mnemonic\IVector;
 use ABadCafe\MC64K\Tokeniser;
 use ABadCafe\MC64K\Parser\EffectiveAddress;
 use ABadCafe\MC64K\Utils\Log;
@@ -79,6 +80,15 @@ class Statement implements SourceLine\IParser, Defs\Mnemonic\IMatches {
         $this->addOperandSetParser(new OperandSet\PackedFPRPair());
         $this->addOperandSetParser(new OperandSet\PackedFPRTriad());
         $this->addOperandSetParser(new OperandSet\PackedFPRTetrad());
+        $this->addOperandSetParser(new OperandSet\PackedVRPair());
+        $this->addOperandSetParser(new OperandSet\PackedVRTriad());
+        $this->addOperandSetParser(new OperandSet\PackedVRImmediate());
+        $this->addOperandSetParser(new OperandSet\VectorMemory());
+        $this->addOperandSetParser(new OperandSet\BitCount());
+        $this->addOperandSetParser(new OperandSet\BitField());
+        $this->addOperandSetParser(new OperandSet\Select());
+        $this->addOperandSetParser(new OperandSet\MinMax());
+        $this->addOperandSetParser(new OperandSet\Block());
 
 
         // Now for the awkward gits...
@@ -128,6 +138,11 @@ class Statement implements SourceLine\IParser, Defs\Mnemonic\IMatches {
             [],
             false
         ));
+
+        $this->addOperandSetParser(new OperandSet\CustomMonadic(
+            [IVector::VCLR],
+            new EffectiveAddress\VRDirect()
+        ));
     }
 
 
@@ -0,0 +1,68 @@
+<?php
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+declare(strict_types = 1);
+
+namespace ABadCafe\MC64K\Parser\SourceLine\Instruction\OperandSet;
+use ABadCafe\MC64K\Parser\EffectiveAddress;
+use ABadCafe\MC64K\Defs\Mnemonic\IBit;
+use ABadCafe\MC64K\Defs;
+
+/**
+ * BitCount
+ *
+ * For the leading zero, trailing zero and set bit counts. Expects <ea:s>, <ea:d>, encoded as per the integer dyadic
+ * operations following the sub-opcode.
+ */
+class BitCount extends Dyadic {
+
+    const OPCODES = [
+        IBit::CLZ_B,
+        IBit::CLZ_W,
+        IBit::CLZ_L,
+        IBit::CLZ_Q,
+        IBit::CTZ_B,
+        IBit::CTZ_W,
+        IBit::CTZ_L,
+        IBit::CTZ_Q,
+        IBit::POPCNT_B,
+        IBit::POPCNT_W,
+        IBit::POPCNT_L,
+        IBit::POPCNT_Q,
+    ];
+
+    /**
+     * Constructor
+     */
+    public function __construct() {
+        $this->oSrcParser = new EffectiveAddress\AllIntegerReadable();
+        $this->oDstParser = new EffectiveAddress\AllIntegerWriteable();
+        parent::__construct();
+    }
+
+    /**
+     * @inheritDoc
+     */
+    public function getOpcodes(): array {
+        return self::OPCODES;
+    }
+
+    /**
+     * @inheritDoc
+     */
+    protected function getInitialInstructionSize(int $iOpcode): int {
+        return Defs\IOpcodeLimits::SIZE_SUB;
+    }
+}
@@ -0,0 +1,143 @@
+<?php
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+declare(strict_types = 1);
+
+namespace ABadCafe\MC64K\Parser\SourceLine\Instruction\OperandSet;
+use ABadCafe\MC64K\Parser\SourceLine\Instruction\Operand;
+use ABadCafe\MC64K\Parser\EffectiveAddress;
+use ABadCafe\MC64K\Defs\Mnemonic\IBit;
+use ABadCafe\MC64K\Defs;
+
+use function \ord, \chr;
+
+/**
+ * BitField
+ *
+ * For the bit field extract and insert operations. Expects #offset, #width, <ea:s>, <ea:d>. The offset and width
+ * bytes follow the sub-opcode, then the destination and source effective addresses as per the dyadic operations.
+ * The offset counts from the least significant bit and the field must lie within the 64-bit operand.
+ *
+ * Either of the offset and width may instead be a GPR, as on the 68020, encoded as FIELD_REGISTER plus the register
+ * number. Register fields are only known at run time, where a field extending past bit 63 is cut short.
+ */
+class BitField extends Dyadic {
+
+    const OPCODES = [
+        IBit::BFEXTU,
+        IBit::BFEXTS,
+        IBit::BFINS,
+    ];
+
+    const
+        OPERAND_OFFSET    = 0,
+        OPERAND_WIDTH     = 1,
+        OPERAND_SRC       = 2,
+        OPERAND_DST       = 3,
+        MIN_OPERAND_COUNT = 4,
+        FIELD_BYTES_SIZE  = 2,
+        MAX_FIELD_BITS    = 64,
+        FIELD_REGISTER    = 0x80
+    ;
+
+    private EffectiveAddress\IParser $oFieldParser;
+    private EffectiveAddress\IParser $oFieldRegisterParser;
+
+    /**
+     * Constructor
+     */
+    public function __construct() {
+        $this->oFieldParser         = new EffectiveAddress\Custom(new Operand\FixedInteger(Defs\IIntLimits::BYTE));
+        $this->oFieldRegisterParser = new EffectiveAddress\GPRDirect();
+        $this->oSrcParser   = new EffectiveAddress\AllIntegerReadable();
+        $this->oDstParser   = new EffectiveAddress\AllIntegerWriteable();
+        parent::__construct();
+    }
+
+    /**
+     * @inheritDoc
+     */
+    public function getOpcodes(): array {
+        return self::OPCODES;
+    }
+
+    /**
+     * @inheritDoc
+     */
+    public function parse(int $iOpcode, array $aOperands, array $aSizes = []): string {
+        $this->assertMinimumOperandCount($aOperands, self::MIN_OPERAND_COUNT);
+
+        $iOffset = $this->parseFieldByte($aOperands[self::OPERAND_OFFSET], 0, self::MAX_FIELD_BITS - 1);
+        $iWidth  = $this->parseFieldByte($aOperands[self::OPERAND_WIDTH], 1, self::MAX_FIELD_BITS);
+        if (!(($iOffset | $iWidth) & self::FIELD_REGISTER) && $iOffset + $iWidth > self::MAX_FIELD_BITS) {
+            throw new \RangeException(
+                'Bit field ' . $iOffset . ':' . $iWidth . ' does not fit in ' . self::MAX_FIELD_BITS . ' bits'
+            );
+        }
+
+        return chr($iOffset) . chr($iWidth) . parent::parse($iOpcode, $aOperands, $aSizes);
+    }
+
+    /**
+     * @inheritDoc
+     */
+    protected function getSourceOperandIndex(): int {
+        return self::OPERAND_SRC;
+    }
+
+    /**
+     * @inheritDoc
+     */
+    protected function getDestinationOperandIndex(): int {
+        return self::OPERAND_DST;
+    }
+
+    /**
+     * @inheritDoc
+     */
+    protected function getInitialInstructionSize(int $iOpcode): int {
+        return Defs\IOpcodeLimits::SIZE_SUB + self::FIELD_BYTES_SIZE;
+    }
+
+    /**
+     * Parses a field offset or width, either a register or an immediate from iMin to iMax
+     *
+     * @param  string $sOperand
+     * @param  int    $iMin
+     * @param  int    $iMax
+     * @return int
+     * @throws \UnexpectedValueException
+     * @throws \RangeException
+     */
+    private function parseFieldByte(string $sOperand, int $iMin, int $iMax): int {
+        $sBytecode = $this->oFieldRegisterParser->parse($sOperand);
+        if (null !== $sBytecode) {
+            return self::FIELD_REGISTER | ord($sBytecode);
+        }
+        $sBytecode = $this->oFieldParser->parse($sOperand);
+        if (null === $sBytecode) {
+            throw new \UnexpectedValueException(
+                $sOperand . ' not a valid bit field immediate or register'
+            );
+        }
+        $iValue = ord($sBytecode);
+        if ($iValue < $iMin || $iValue > $iMax) {
+            throw new \RangeException(
+                $sOperand . ' out of range ' . $iMin . '-' . $iMax . ' for a bit field'
+            );
+        }
+        return $iValue;
+    }
+}
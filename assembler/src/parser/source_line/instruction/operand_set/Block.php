@@ -0,0 +1,72 @@
+<?php
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+declare(strict_types = 1);
+
+namespace ABadCafe\MC64K\Parser\SourceLine\Instruction\OperandSet;
+use ABadCafe\MC64K\Parser\EffectiveAddress;
+use ABadCafe\MC64K\Defs\Mnemonic\IBlock;
+
+use function \array_keys;
+
+/**
+ * Block
+ *
+ * For the block memory operations. Expects <ea:s>, <ea:d>, r<N>, where r<N> holds the length. Move and compare take
+ * the start addresses of two blocks, fill takes the value and the start address of the block. The length register
+ * is encoded as a byte after the sub-opcode, followed by the destination and source effective addresses.
+ */
+class Block extends Polyadic {
+
+    // Opcode => is fill
+    const OPCODES = [
+        IBlock::BMOVE   => false,
+        IBlock::BFILL_B => true,
+        IBlock::BFILL_W => true,
+        IBlock::BFILL_L => true,
+        IBlock::BFILL_Q => true,
+        IBlock::BCMP    => false,
+    ];
+
+    /** @var EffectiveAddress\IParser[][] $aOrders, indexed by is fill */
+    private array $aOrders;
+
+    /**
+     * Constructor
+     */
+    public function __construct() {
+        $oLength = new EffectiveAddress\GPRDirect();
+        $oMemory = new EffectiveAddress\AllMemoryAddressing();
+
+        $this->aOrders = [
+            0 => [2 => $oLength, 1 => $oMemory, 0 => $oMemory],
+            1 => [2 => $oLength, 1 => $oMemory, 0 => new EffectiveAddress\AllIntegerReadable()],
+        ];
+    }
+
+    /**
+     * @inheritDoc
+     */
+    public function getOpcodes(): array {
+        return array_keys(self::OPCODES);
+    }
+
+    /**
+     * @inheritDoc
+     */
+    protected function getEncodingOrder(int $iOpcode): array {
+        return $this->aOrders[(int)self::OPCODES[$iOpcode]];
+    }
+}
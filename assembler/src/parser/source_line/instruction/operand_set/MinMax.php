@@ -0,0 +1,104 @@
+<?php
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+declare(strict_types = 1);
+
+namespace ABadCafe\MC64K\Parser\SourceLine\Instruction\OperandSet;
+use ABadCafe\MC64K\Parser\EffectiveAddress;
+use ABadCafe\MC64K\Defs\Mnemonic\ISelect;
+
+use function \array_keys;
+
+/**
+ * MinMax
+ *
+ * For the minimum, maximum and clamp operations. Minimum and maximum expect <ea:s>, <ea:d> and are encoded as per
+ * the dyadic operations. Clamp expects <ea:lo>, <ea:hi>, <ea:d> and is encoded as d, lo, hi.
+ */
+class MinMax extends Polyadic {
+
+    // Opcode => [is float, is clamp]
+    const OPCODES = [
+        ISelect::MIN_B    => [false, false],
+        ISelect::MIN_W    => [false, false],
+        ISelect::MIN_L    => [false, false],
+        ISelect::MIN_Q    => [false, false],
+        ISelect::MAX_B    => [false, false],
+        ISelect::MAX_W    => [false, false],
+        ISelect::MAX_L    => [false, false],
+        ISelect::MAX_Q    => [false, false],
+        ISelect::MINU_B   => [false, false],
+        ISelect::MINU_W   => [false, false],
+        ISelect::MINU_L   => [false, false],
+        ISelect::MINU_Q   => [false, false],
+        ISelect::MAXU_B   => [false, false],
+        ISelect::MAXU_W   => [false, false],
+        ISelect::MAXU_L   => [false, false],
+        ISelect::MAXU_Q   => [false, false],
+        ISelect::FMIN_S   => [true,  false],
+        ISelect::FMIN_D   => [true,  false],
+        ISelect::FMAX_S   => [true,  false],
+        ISelect::FMAX_D   => [true,  false],
+        ISelect::CLAMP_B  => [false, true],
+        ISelect::CLAMP_W  => [false, true],
+        ISelect::CLAMP_L  => [false, true],
+        ISelect::CLAMP_Q  => [false, true],
+        ISelect::CLAMPU_B => [false, true],
+        ISelect::CLAMPU_W => [false, true],
+        ISelect::CLAMPU_L => [false, true],
+        ISelect::CLAMPU_Q => [false, true],
+        ISelect::FCLAMP_S => [true,  true],
+        ISelect::FCLAMP_D => [true,  true],
+    ];
+
+    /** @var EffectiveAddress\IParser[][][] $aOrders, indexed by is float, is clamp */
+    private array $aOrders;
+
+    /**
+     * Constructor
+     */
+    public function __construct() {
+        $oIntReadable  = new EffectiveAddress\AllIntegerReadable();
+        $oIntWriteable = new EffectiveAddress\AllIntegerWriteable();
+        $oFltReadable  = new EffectiveAddress\AllFloatReadable();
+        $oFltWriteable = new EffectiveAddress\AllFloatWriteable();
+
+        $this->aOrders = [
+            0 => [
+                0 => [1 => $oIntWriteable, 0 => $oIntReadable],
+                1 => [2 => $oIntWriteable, 0 => $oIntReadable, 1 => $oIntReadable],
+            ],
+            1 => [
+                0 => [1 => $oFltWriteable, 0 => $oFltReadable],
+                1 => [2 => $oFltWriteable, 0 => $oFltReadable, 1 => $oFltReadable],
+            ],
+        ];
+    }
+
+    /**
+     * @inheritDoc
+     */
+    public function getOpcodes(): array {
+        return array_keys(self::OPCODES);
+    }
+
+    /**
+     * @inheritDoc
+     */
+    protected function getEncodingOrder(int $iOpcode): array {
+        [$bFloat, $bClamp] = self::OPCODES[$iOpcode];
+        return $this->aOrders[(int)$bFloat][(int)$bClamp];
+    }
+}
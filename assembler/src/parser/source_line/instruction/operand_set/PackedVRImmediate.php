@@ -0,0 +1,101 @@
+<?php
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+declare(strict_types = 1);
+
+namespace ABadCafe\MC64K\Parser\SourceLine\Instruction\OperandSet;
+use ABadCafe\MC64K\Parser\SourceLine\Instruction\Operand;
+use ABadCafe\MC64K\Parser\EffectiveAddress;
+use ABadCafe\MC64K\Defs\Mnemonic\IVector;
+use ABadCafe\MC64K\Defs;
+use ABadCafe\MC64K\State;
+
+use function \ord, \chr;
+
+/**
+ * PackedVRImmediate
+ *
+ * For vector register to register operations controlled by an immediate byte, e.g. shift count or shuffle selector.
+ * Expects #imm, vs, vd. The register pair is packed into a single byte, followed by the immediate.
+ */
+class PackedVRImmediate extends Triadic {
+
+    const OPCODES = [
+        IVector::VLSL_W,
+        IVector::VLSL_L,
+        IVector::VLSL_Q,
+        IVector::VLSR_W,
+        IVector::VLSR_L,
+        IVector::VLSR_Q,
+        IVector::VASR_W,
+        IVector::VASR_L,
+        IVector::VSHUF_L,
+    ];
+
+    const MIN_OPERAND_COUNT = 3;
+
+    /**
+     * Constructor
+     */
+    public function __construct() {
+        parent::__construct();
+        $this->oSrcParser  = new EffectiveAddress\Custom(new Operand\FixedInteger(Defs\IIntLimits::BYTE));
+        $this->oDstParser  =
+        $this->oSrc2Parser = new EffectiveAddress\VRDirect();
+    }
+
+    /**
+     * @inheritDoc
+     */
+    public function getOpcodes(): array {
+        return self::OPCODES;
+    }
+
+    /**
+     * @inheritDoc
+     */
+    public function parse(int $iOpcode, array $aOperands, array $aSizes = []): string {
+        $this->assertMinimumOperandCount($aOperands, self::MIN_OPERAND_COUNT);
+
+        State\Coordinator::get()
+            ->setCurrentStatementLength(Defs\IOpcodeLimits::SIZE_SUB);
+
+        $iDstIndex    = $this->getDestinationOperandIndex();
+        $sDstBytecode = $this->oDstParser->parse($aOperands[$iDstIndex]);
+        if (null === $sDstBytecode) {
+            throw new \UnexpectedValueException(
+                $aOperands[$iDstIndex] . ' not a valid destination operand'
+            );
+        }
+
+        $iImmIndex    = $this->getSource1OperandIndex();
+        $sImmBytecode = $this->oSrcParser->parse($aOperands[$iImmIndex]);
+        if (null === $sImmBytecode) {
+            throw new \UnexpectedValueException(
+                $aOperands[$iImmIndex] . ' not a valid immediate operand'
+            );
+        }
+
+        $iSrcIndex    = $this->getSource2OperandIndex();
+        $sSrcBytecode = $this->oSrc2Parser->parse($aOperands[$iSrcIndex]);
+        if (null === $sSrcBytecode) {
+            throw new \UnexpectedValueException(
+                $aOperands[$iSrcIndex] . ' not a valid source operand'
+            );
+        }
+
+        return chr(ord($sSrcBytecode) << 4 | ord($sDstBytecode)) . $sImmBytecode;
+    }
+}
@@ -0,0 +1,93 @@
+<?php
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+declare(strict_types = 1);
+
+namespace ABadCafe\MC64K\Parser\SourceLine\Instruction\OperandSet;
+use ABadCafe\MC64K\Parser\EffectiveAddress;
+use ABadCafe\MC64K\Defs\Mnemonic\IVector;
+
+/**
+ * PackedVRPair
+ *
+ * For vector register to register operations where both registers are packed into a single byte.
+ */
+class PackedVRPair extends PackedRegisterPair {
+
+    const OPCODES = [
+        IVector::VMOVE,
+        IVector::VAND,
+        IVector::VOR,
+        IVector::VEOR,
+        IVector::VANDN,
+        IVector::VADD_B,
+        IVector::VADD_W,
+        IVector::VADD_L,
+        IVector::VADD_Q,
+        IVector::VSUB_B,
+        IVector::VSUB_W,
+        IVector::VSUB_L,
+        IVector::VSUB_Q,
+        IVector::VADDS_B,
+        IVector::VADDS_W,
+        IVector::VADDUS_B,
+        IVector::VADDUS_W,
+        IVector::VSUBS_B,
+        IVector::VSUBS_W,
+        IVector::VSUBUS_B,
+        IVector::VSUBUS_W,
+        IVector::VMUL_W,
+        IVector::VMUL_L,
+        IVector::VFADD_S,
+        IVector::VFADD_D,
+        IVector::VFSUB_S,
+        IVector::VFSUB_D,
+        IVector::VFMUL_S,
+        IVector::VFMUL_D,
+        IVector::VFDIV_S,
+        IVector::VFDIV_D,
+        IVector::VFMIN_S,
+        IVector::VFMIN_D,
+        IVector::VFMAX_S,
+        IVector::VFMAX_D,
+        IVector::VCVTL_S,
+        IVector::VCVTS_L,
+        IVector::VPACKUS_W,
+        IVector::VEXTU_B,
+    ];
+
+    /**
+     * Constructor
+     */
+    public function __construct() {
+        $this->oSrcParser = new EffectiveAddress\VRDirect();
+        $this->oDstParser = new EffectiveAddress\VRDirect();
+        parent::__construct();
+    }
+
+    /**
+     * @inheritDoc
+     */
+    public function getOpcodes(): array {
+        return static::OPCODES;
+    }
+
+    /**
+     * @inheritDoc
+     */
+    protected function foldIfOperandsSame(int $iOpcode): bool {
+        return IVector::VMOVE === $iOpcode;
+    }
+}
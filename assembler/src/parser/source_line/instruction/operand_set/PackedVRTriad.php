@@ -0,0 +1,93 @@
+<?php
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+declare(strict_types = 1);
+
+namespace ABadCafe\MC64K\Parser\SourceLine\Instruction\OperandSet;
+use ABadCafe\MC64K\Parser\EffectiveAddress;
+use ABadCafe\MC64K\Defs\Mnemonic\IVector;
+use ABadCafe\MC64K\Defs;
+use ABadCafe\MC64K\State;
+
+use function \ord, \chr;
+
+/**
+ * PackedVRTriad
+ *
+ * For vector register operations that take a second source register. The destination and first source are packed
+ * into a single byte, followed by the second source.
+ */
+class PackedVRTriad extends Triadic {
+
+    const OPCODES = [
+        IVector::VFMA_S,
+        IVector::VFMA_D,
+    ];
+
+    const MIN_OPERAND_COUNT = 3;
+
+    /**
+     * Constructor
+     */
+    public function __construct() {
+        parent::__construct();
+        $this->oSrcParser  =
+        $this->oDstParser  =
+        $this->oSrc2Parser = new EffectiveAddress\VRDirect();
+    }
+
+    /**
+     * @inheritDoc
+     */
+    public function getOpcodes(): array {
+        return self::OPCODES;
+    }
+
+    /**
+     * @inheritDoc
+     */
+    public function parse(int $iOpcode, array $aOperands, array $aSizes = []): string {
+        $this->assertMinimumOperandCount($aOperands, self::MIN_OPERAND_COUNT);
+
+        State\Coordinator::get()
+            ->setCurrentStatementLength(Defs\IOpcodeLimits::SIZE_SUB);
+
+        $iDstIndex    = $this->getDestinationOperandIndex();
+        $sDstBytecode = $this->oDstParser->parse($aOperands[$iDstIndex]);
+        if (null === $sDstBytecode) {
+            throw new \UnexpectedValueException(
+                $aOperands[$iDstIndex] . ' not a valid destination operand'
+            );
+        }
+
+        $iSrc1Index    = $this->getSource1OperandIndex();
+        $sSrc1Bytecode = $this->oSrcParser->parse($aOperands[$iSrc1Index]);
+        if (null === $sSrc1Bytecode) {
+            throw new \UnexpectedValueException(
+                $aOperands[$iSrc1Index] . ' not a valid source 1 operand'
+            );
+        }
+
+        $iSrc2Index    = $this->getSource2OperandIndex();
+        $sSrc2Bytecode = $this->oSrc2Parser->parse($aOperands[$iSrc2Index]);
+        if (null === $sSrc2Bytecode) {
+            throw new \UnexpectedValueException(
+                $aOperands[$iSrc2Index] . ' not a valid source 2 operand'
+            );
+        }
+
+        return chr(ord($sSrc1Bytecode) << 4 | ord($sDstBytecode)) . $sSrc2Bytecode;
+    }
+}
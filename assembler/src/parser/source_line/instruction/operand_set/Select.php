@@ -0,0 +1,111 @@
+<?php
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+declare(strict_types = 1);
+
+namespace ABadCafe\MC64K\Parser\SourceLine\Instruction\OperandSet;
+use ABadCafe\MC64K\Parser\EffectiveAddress;
+use ABadCafe\MC64K\Defs\Mnemonic\ISelect;
+
+use function \array_fill_keys, \array_merge;
+
+/**
+ * Select
+ *
+ * For the conditional select operations. Expects <ea:a>, <ea:b>, <ea:x>, <ea:y>, <ea:d> and selects x into d when
+ * the condition holds for a and b, otherwise y. Encoded as d, a, b, x, y following the condition.
+ */
+class Select extends Polyadic {
+
+    const INTEGER_OPCODES = [
+        ISelect::SELLO_B, ISelect::SELLO_W, ISelect::SELLO_L, ISelect::SELLO_Q,
+        ISelect::SELLT_B, ISelect::SELLT_W, ISelect::SELLT_L, ISelect::SELLT_Q,
+        ISelect::SELLS_B, ISelect::SELLS_W, ISelect::SELLS_L, ISelect::SELLS_Q,
+        ISelect::SELLE_B, ISelect::SELLE_W, ISelect::SELLE_L, ISelect::SELLE_Q,
+        ISelect::SELEQ_B, ISelect::SELEQ_W, ISelect::SELEQ_L, ISelect::SELEQ_Q,
+        ISelect::SELHS_B, ISelect::SELHS_W, ISelect::SELHS_L, ISelect::SELHS_Q,
+        ISelect::SELGE_B, ISelect::SELGE_W, ISelect::SELGE_L, ISelect::SELGE_Q,
+        ISelect::SELHI_B, ISelect::SELHI_W, ISelect::SELHI_L, ISelect::SELHI_Q,
+        ISelect::SELGT_B, ISelect::SELGT_W, ISelect::SELGT_L, ISelect::SELGT_Q,
+        ISelect::SELNE_B, ISelect::SELNE_W, ISelect::SELNE_L, ISelect::SELNE_Q,
+        ISelect::SELBS_B, ISelect::SELBS_W, ISelect::SELBS_L, ISelect::SELBS_Q,
+        ISelect::SELBC_B, ISelect::SELBC_W, ISelect::SELBC_L, ISelect::SELBC_Q,
+    ];
+
+    const FLOAT_OPCODES = [
+        ISelect::FSELLT_S, ISelect::FSELLT_D,
+        ISelect::FSELLE_S, ISelect::FSELLE_D,
+        ISelect::FSELEQ_S, ISelect::FSELEQ_D,
+        ISelect::FSELGE_S, ISelect::FSELGE_D,
+        ISelect::FSELGT_S, ISelect::FSELGT_D,
+        ISelect::FSELNE_S, ISelect::FSELNE_D,
+    ];
+
+    const
+        OPERAND_A   = 0,
+        OPERAND_B   = 1,
+        OPERAND_X   = 2,
+        OPERAND_Y   = 3,
+        OPERAND_DST = 4
+    ;
+
+    /** @var bool[] $aFloat */
+    private array $aFloat;
+
+    /** @var EffectiveAddress\IParser[] $aIntegerOrder */
+    private array $aIntegerOrder;
+
+    /** @var EffectiveAddress\IParser[] $aFloatOrder */
+    private array $aFloatOrder;
+
+    /**
+     * Constructor
+     */
+    public function __construct() {
+        $this->aFloat = array_fill_keys(self::FLOAT_OPCODES, true);
+
+        $oIntReadable = new EffectiveAddress\AllIntegerReadable();
+        $this->aIntegerOrder = [
+            self::OPERAND_DST => new EffectiveAddress\AllIntegerWriteable(),
+            self::OPERAND_A   => $oIntReadable,
+            self::OPERAND_B   => $oIntReadable,
+            self::OPERAND_X   => $oIntReadable,
+            self::OPERAND_Y   => $oIntReadable,
+        ];
+
+        $oFltReadable = new EffectiveAddress\AllFloatReadable();
+        $this->aFloatOrder = [
+            self::OPERAND_DST => new EffectiveAddress\AllFloatWriteable(),
+            self::OPERAND_A   => $oFltReadable,
+            self::OPERAND_B   => $oFltReadable,
+            self::OPERAND_X   => $oFltReadable,
+            self::OPERAND_Y   => $oFltReadable,
+        ];
+    }
+
+    /**
+     * @inheritDoc
+     */
+    public function getOpcodes(): array {
+        return array_merge(self::INTEGER_OPCODES, self::FLOAT_OPCODES);
+    }
+
+    /**
+     * @inheritDoc
+     */
+    protected function getEncodingOrder(int $iOpcode): array {
+        return isset($this->aFloat[$iOpcode]) ? $this->aFloatOrder : $this->aIntegerOrder;
+    }
+}
@@ -0,0 +1,114 @@
+<?php
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+declare(strict_types = 1);
+
+namespace ABadCafe\MC64K\Parser\SourceLine\Instruction\OperandSet;
+use ABadCafe\MC64K\Parser\EffectiveAddress;
+use ABadCafe\MC64K\Defs\Mnemonic\IVector;
+use ABadCafe\MC64K\Defs;
+use ABadCafe\MC64K\State;
+
+use function \strlen;
+
+/**
+ * VectorMemory
+ *
+ * For transfers between a vector register and an effective address. The register is encoded in the first byte,
+ * followed by the effective address, regardless of the direction of the transfer.
+ */
+class VectorMemory extends Monadic {
+
+    const OPCODES = [
+        IVector::VLOAD,
+        IVector::VSTORE,
+        IVector::VSPLAT_B,
+        IVector::VSPLAT_W,
+        IVector::VSPLAT_L,
+        IVector::VSPLAT_Q,
+    ];
+
+    const
+        MIN_OPERAND_COUNT = 2,
+        REG_BYTE_SIZE     = 1
+    ;
+
+    private EffectiveAddress\IParser $oRegParser;
+    private EffectiveAddress\IParser $oMemoryParser;
+    private EffectiveAddress\IParser $oScalarParser;
+
+    /**
+     * Constructor
+     */
+    public function __construct() {
+        $this->oRegParser    = new EffectiveAddress\VRDirect();
+
+        // Whole register transfers must be in memory, anything else would overrun the operand
+        $this->oMemoryParser = new EffectiveAddress\AllMemoryAddressing();
+        $this->oScalarParser = new EffectiveAddress\AllIntegerReadable();
+    }
+
+    /**
+     * @inheritDoc
+     */
+    public function getOpcodes(): array {
+        return self::OPCODES;
+    }
+
+    /**
+     * @inheritDoc
+     */
+    public function parse(int $iOpcode, array $aOperands, array $aSizes = []): string {
+        $this->assertMinimumOperandCount($aOperands, self::MIN_OPERAND_COUNT);
+
+        // vstore vs, <ea> is the only form with the register first.
+        if (IVector::VSTORE === $iOpcode) {
+            $iRegIndex = self::DEF_OPERAND_SRC;
+            $iEAIndex  = self::DEF_OPERAND_SRC + 1;
+        } else {
+            $iRegIndex = self::DEF_OPERAND_SRC + 1;
+            $iEAIndex  = self::DEF_OPERAND_SRC;
+        }
+
+        $sRegBytecode = $this->oRegParser->parse($aOperands[$iRegIndex]);
+        if (null === $sRegBytecode) {
+            throw new \UnexpectedValueException(
+                $aOperands[$iRegIndex] . ' not a valid vector register operand'
+            );
+        }
+
+        $oEAParser = (IVector::VLOAD === $iOpcode || IVector::VSTORE === $iOpcode) ?
+            $this->oMemoryParser :
+            $this->oScalarParser;
+
+        $iInstructionSize = Defs\IOpcodeLimits::SIZE_SUB + self::REG_BYTE_SIZE;
+        $oState = State\Coordinator::get()
+            ->setCurrentStatementLength($iInstructionSize);
+
+        $sEABytecode = $oEAParser
+            ->setOperationSize($aSizes[$iEAIndex] ?? self::DEFAULT_SIZE)
+            ->parse($aOperands[$iEAIndex]);
+        if (null === $sEABytecode) {
+            throw new \UnexpectedValueException(
+                $aOperands[$iEAIndex] . ' not a valid operand'
+            );
+        }
+
+        $iInstructionSize += strlen($sEABytecode);
+        $oState->setCurrentStatementLength($iInstructionSize);
+
+        return $sRegBytecode . $sEABytecode;
+    }
+}
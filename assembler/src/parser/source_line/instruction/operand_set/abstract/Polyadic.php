@@ -0,0 +1,76 @@
+<?php
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+declare(strict_types = 1);
+
+namespace ABadCafe\MC64K\Parser\SourceLine\Instruction\OperandSet;
+use ABadCafe\MC64K\Parser\EffectiveAddress;
+use ABadCafe\MC64K\Defs;
+use ABadCafe\MC64K\State;
+
+use function \count, \strlen;
+
+/**
+ * Polyadic
+ *
+ * Base for extension operations with any number of effective address operands. The operands are encoded in an
+ * order given by the implementation, which need not match the source order. No "same as destination" substitution
+ * is made, since the operations do not necessarily keep the destination address in the same place at runtime.
+ */
+abstract class Polyadic extends Monadic {
+
+    /**
+     * Returns the operand parsers, keyed by source operand index, in encoding order.
+     *
+     * @param  int $iOpcode
+     * @return EffectiveAddress\IParser[]
+     */
+    abstract protected function getEncodingOrder(int $iOpcode): array;
+
+    /**
+     * @inheritDoc
+     */
+    public function parse(int $iOpcode, array $aOperands, array $aSizes = []): string {
+        $aEncodingOrder = $this->getEncodingOrder($iOpcode);
+        $this->assertMinimumOperandCount($aOperands, count($aEncodingOrder));
+
+        $iInstructionSize = $this->getInitialInstructionSize($iOpcode);
+        $oState = State\Coordinator::get()
+            ->setCurrentStatementLength($iInstructionSize);
+
+        $sBytecode = '';
+        foreach ($aEncodingOrder as $iIndex => $oParser) {
+            $sOperandBytecode = $oParser
+                ->setOperationSize($aSizes[$iIndex] ?? self::DEFAULT_SIZE)
+                ->parse($aOperands[$iIndex]);
+            if (null === $sOperandBytecode) {
+                throw new \UnexpectedValueException(
+                    $aOperands[$iIndex] . ' not a valid operand ' . ($iIndex + 1)
+                );
+            }
+            $sBytecode        .= $sOperandBytecode;
+            $iInstructionSize += strlen($sOperandBytecode);
+            $oState->setCurrentStatementLength($iInstructionSize);
+        }
+        return $sBytecode;
+    }
+
+    /**
+     * @inheritDoc
+     */
+    protected function getInitialInstructionSize(int $iOpcode): int {
+        return Defs\IOpcodeLimits::SIZE_SUB;
+    }
+}
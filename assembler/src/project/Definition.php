@@ -155,13 +155,27 @@ class Definition {
             ) {
                 throw new \Exception('Host section must not be empty');
             }
-            $this->oTarget
+            $oDependencySet = $this->oTarget
                 ->setFlags(State\Target::F_EXECUTABLE)
                 ->getDependencySet()
                 ->add(
                     (string)$oProjectData->target->host->name,
                     (string)$oProjectData->target->host->version
                 );
+
+            // Optional list of host libraries the binary uses. These are versioned with the host. When given, the
+            // host runtime only makes the listed libraries available.
+            if (isset($oProjectData->target->host->libraries)) {
+                if (!is_array($oProjectData->target->host->libraries)) {
+                    throw new \Exception('Host libraries must be a list');
+                }
+                foreach ($oProjectData->target->host->libraries as $sLibrary) {
+                    $oDependencySet->add(
+                        'host/' . (string)$sLibrary,
+                        (string)$oProjectData->target->host->version
+                    );
+                }
+            }
         }
     }
 
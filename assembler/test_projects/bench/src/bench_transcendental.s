@@ -0,0 +1,162 @@
+
+; Transcendental FPU operations. Build the interpreter with each VM_FPU_ACCURACY setting to compare the tiers.
+
+    @align  0, 8
+
+bench_fsin_d:
+    lea         .benchmark_info,    r8
+    hcf         io_print_string
+
+    fmove.d     #0.5,               fp0
+    move.q      max_loops,          loop_counter
+    nanotime
+    move.q      time_recorded,      time_started
+.benchmark_loop:
+    fsin.d      fp0,                fp1
+    fsin.d      fp0,                fp1
+    fsin.d      fp0,                fp1
+    fsin.d      fp0,                fp1
+    fsin.d      fp0,                fp1
+    fsin.d      fp0,                fp1
+    fsin.d      fp0,                fp1
+    fsin.d      fp0,                fp1
+    fsin.d      fp0,                fp1
+    fsin.d      fp0,                fp1
+    dbnz        loop_counter,       .benchmark_loop
+    nanotime
+    sub.q       calibration_time,   time_recorded
+    sub.q       time_started,       time_recorded
+    bsr         report_elapsed
+    bsr         report_relative
+    rts
+
+.benchmark_info:
+    dc.b "Benchmarking: fsin.d fp0, fp1\n\0"
+
+    @align  0, 8
+
+bench_fsincos_d:
+    lea         .benchmark_info,    r8
+    hcf         io_print_string
+
+    fmove.d     #0.5,               fp0
+    move.q      max_loops,          loop_counter
+    nanotime
+    move.q      time_recorded,      time_started
+.benchmark_loop:
+    fsincos.d   fp0,                fp1
+    fsincos.d   fp0,                fp1
+    fsincos.d   fp0,                fp1
+    fsincos.d   fp0,                fp1
+    fsincos.d   fp0,                fp1
+    fsincos.d   fp0,                fp1
+    fsincos.d   fp0,                fp1
+    fsincos.d   fp0,                fp1
+    fsincos.d   fp0,                fp1
+    fsincos.d   fp0,                fp1
+    dbnz        loop_counter,       .benchmark_loop
+    nanotime
+    sub.q       calibration_time,   time_recorded
+    sub.q       time_started,       time_recorded
+    bsr         report_elapsed
+    bsr         report_relative
+    rts
+
+.benchmark_info:
+    dc.b "Benchmarking: fsincos.d fp0, fp1\n\0"
+
+    @align  0, 8
+
+bench_fetox_d:
+    lea         .benchmark_info,    r8
+    hcf         io_print_string
+
+    fmove.d     #0.5,               fp0
+    move.q      max_loops,          loop_counter
+    nanotime
+    move.q      time_recorded,      time_started
+.benchmark_loop:
+    fetox.d     fp0,                fp1
+    fetox.d     fp0,                fp1
+    fetox.d     fp0,                fp1
+    fetox.d     fp0,                fp1
+    fetox.d     fp0,                fp1
+    fetox.d     fp0,                fp1
+    fetox.d     fp0,                fp1
+    fetox.d     fp0,                fp1
+    fetox.d     fp0,                fp1
+    fetox.d     fp0,                fp1
+    dbnz        loop_counter,       .benchmark_loop
+    nanotime
+    sub.q       calibration_time,   time_recorded
+    sub.q       time_started,       time_recorded
+    bsr         report_elapsed
+    bsr         report_relative
+    rts
+
+.benchmark_info:
+    dc.b "Benchmarking: fetox.d fp0, fp1\n\0"
+
+    @align  0, 8
+
+bench_flogn_d:
+    lea         .benchmark_info,    r8
+    hcf         io_print_string
+
+    fmove.d     #1.5,               fp0
+    move.q      max_loops,          loop_counter
+    nanotime
+    move.q      time_recorded,      time_started
+.benchmark_loop:
+    flogn.d     fp0,                fp1
+    flogn.d     fp0,                fp1
+    flogn.d     fp0,                fp1
+    flogn.d     fp0,                fp1
+    flogn.d     fp0,                fp1
+    flogn.d     fp0,                fp1
+    flogn.d     fp0,                fp1
+    flogn.d     fp0,                fp1
+    flogn.d     fp0,                fp1
+    flogn.d     fp0,                fp1
+    dbnz        loop_counter,       .benchmark_loop
+    nanotime
+    sub.q       calibration_time,   time_recorded
+    sub.q       time_started,       time_recorded
+    bsr         report_elapsed
+    bsr         report_relative
+    rts
+
+.benchmark_info:
+    dc.b "Benchmarking: flogn.d fp0, fp1\n\0"
+
+    @align  0, 8
+
+bench_fatan_d:
+    lea         .benchmark_info,    r8
+    hcf         io_print_string
+
+    fmove.d     #0.5,               fp0
+    move.q      max_loops,          loop_counter
+    nanotime
+    move.q      time_recorded,      time_started
+.benchmark_loop:
+    fatan.d     fp0,                fp1
+    fatan.d     fp0,                fp1
+    fatan.d     fp0,                fp1
+    fatan.d     fp0,                fp1
+    fatan.d     fp0,                fp1
+    fatan.d     fp0,                fp1
+    fatan.d     fp0,                fp1
+    fatan.d     fp0,                fp1
+    fatan.d     fp0,                fp1
+    fatan.d     fp0,                fp1
+    dbnz        loop_counter,       .benchmark_loop
+    nanotime
+    sub.q       calibration_time,   time_recorded
+    sub.q       time_started,       time_recorded
+    bsr         report_elapsed
+    bsr         report_relative
+    rts
+
+.benchmark_info:
+    dc.b "Benchmarking: fatan.d fp0, fp1\n\0"
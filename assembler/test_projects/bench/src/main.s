@@ -46,6 +46,11 @@ main:
     bsr         bench_link_unlk
     bsr         bench_vec3f_func
     bsr         bench_vec3f_hcf
+    bsr         bench_fsin_d
+    bsr         bench_fsincos_d
+    bsr         bench_fetox_d
+    bsr         bench_flogn_d
+    bsr         bench_fatan_d
 
 exit:
     hcf         io_done
@@ -18,7 +18,6 @@
     @def DISTANCE     0.5
     @def TEXTURE_DIM  7
     @def TEXTURE_SIZE 1 << TEXTURE_DIM
-    @def MAX_TEXEL    TEXTURE_SIZE - 1
 
 main:
     ; try to open the display
@@ -34,16 +33,12 @@ main:
     lea     .filth,      DISPLAY_REG_FILTH(a0)
 
     ; Set parameters
-    lea     .texel_data,  a2
-    fmove.s #STEP,        fp15
-    fmove.s #ZOOM,        fp14
-    fmove.s #DISTANCE,    fp13
-    fmove.s #0.0,         fp12 ; current angle
-
-    move.l  #MAX_TEXEL,   d4
-    move.l  #TEXTURE_DIM, d5
-    clr.q   d2
-    clr.q   d3
+    lea     .texture,    a1
+    lea     .texel_data, BLIT_SURFACE_PIXELS(a1)
+    fmove.s #STEP,       fp15
+    fmove.s #ZOOM,       fp14
+    fmove.s #DISTANCE,   fp13
+    fmove.s #0.0,        fp12 ; current angle
 
     ; Begin the main event loop
     hcf     display_begin
@@ -59,6 +54,7 @@ exit:
 
 ; renderer
 on_frame: ; a0 contains display context
+    move.q      a0, -(sp)
     fmove.s     fp12, fp10
     fsincos.s   fp10, fp11  ; fp10 = sin(angle), fp11 = cos(angle)
     fadd.s      fp15, fp12  ; angle += step
@@ -66,43 +62,25 @@ on_frame: ; a0 contains display context
     fmul.s      fp10, fp9
     fadd.s      fp13, fp9   ; fp9 = scale = (fsin * zoom) + dist
 
-    ; set address and counters
-    move.q      DISPLAY_REG_SOFT_BUFFER_ADDRESS(a0), a1
-    move.w      DISPLAY_REG_HEIGHT(a0), d2
-
-.yloop:
-    move.w      DISPLAY_REG_WIDTH(a0), d3
-    fmovel.s    d2, fp8     ; fp8 = y
-
-.xloop:
-    fmovel.s    d3, fp7     ; fp7 = x
-
-    ; calculate texel U
+    ; texel u = scale * ((fcos * x) - (fsin * y)), texel v = scale * ((fsin * x) + (fcos * y))
+    lea         .transform, a2
     fmove.s     fp11, fp6
-    fmul.s      fp7,  fp6   ; fp6 = (fcos * x)
-    fmove.s     fp10, fp5
-    fmul.s      fp8,  fp5   ; fp5 = (fsin * y)
-    fsub.s      fp5,  fp6   ; fp6 = (fcos * x) - (fsin * y)
-    fmul.s      fp9,  fp6   ; fp6 = scale * ((fcos * x) - (fsin * y))
-    fmoves.l    fp6,  d0    ; d0 = tex_u
-    and.l       d4,   d0    ; d0 = tex_u & (TEXTURE_SIZE - 1)
-    ; calculate texel V
+    fmul.s      fp9,  fp6   ; fp6 = scale * fcos
+    fmove.s     fp6,  RASTER_TRANSFORM_DUDX(a2)
+    fmove.s     fp6,  RASTER_TRANSFORM_DVDY(a2)
     fmove.s     fp10, fp6
-    fmul.s      fp7,  fp6   ; fp6 = (fsin * x)
-    fmove.s     fp11, fp5
-    fmul.s      fp8,  fp5   ; fp5 = (fcos * y)
-    fadd.s      fp5,  fp6   ; fp6 = (fsin * x) + (fcos * y)
-    fmul.s      fp9,  fp6   ; fp6 = scale * ((fsin * x) + (fcos * y))
-    fmoves.l    fp6,  d1    ; d1 = tex_v
-    and.l       d4,   d1    ; d1 = tex_v & (TEXTURE_SIZE - 1)
-    ; calculate texel address
-    lsl.l       d5,   d1
-    or.l        d1,   d0    ; d0 = tex_v << 7 | tex_u
-    ; plot
-    move.l      (a2, d0.l * 4), (a1)+
-
-    dbnz d3, .xloop
-    dbnz d2, .yloop
+    fmul.s      fp9,  fp6   ; fp6 = scale * fsin
+    fmove.s     fp6,  RASTER_TRANSFORM_DVDX(a2)
+    fneg.s      fp6,  RASTER_TRANSFORM_DUDY(a2)
+
+    ; the whole frame is one host call
+    lea         .target, a1
+    hcf         blit_display_surface
+    lea         .target,  a0
+    lea         .texture, a1
+    move.l      #RASTER_WRAP_REPEAT, d0
+    hcf         raster_affine
+    move.q      (sp)+, a0
     rts
 
 ; handlers
@@ -140,6 +118,21 @@ on_key_down: ; a0 contains display context
     ; format, target refresh Hz
     dc.b PXL_ARGB, 60
 
+    @align  0, 8
+.target:
+    dc.q 0, 0, 0, 0                  ; filled in by blit_display_surface
+
+.texture:
+    dc.q 0, 0                        ; pixels, remap
+    dc.l [TEXTURE_SIZE], [TEXTURE_SIZE] ; width, height
+    dc.l 0, PXL_ARGB                 ; stride, format
+
+.transform:
+    dc.l 0, 0, 640, 480              ; rect
+    dc.l 0, 0                        ; u, v
+    dc.l 0, 0, 0, 0                  ; du/dx, dv/dx, du/dy, dv/dy
+    dc.q 0                           ; no line table
+
 .texel_data:
     @incbin "../res/img.bin"
 
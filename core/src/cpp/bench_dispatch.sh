@@ -0,0 +1,30 @@
+#!/bin/sh
+#
+# Compares the interpreter dispatch backends: builds the interpreter once for each and runs the same binary on each
+# in turn, by default the bench test project. Any further arguments are passed to make, e.g. CXX=clang++.
+#
+# Only the interpreter object depends on the backend, so that is all that is rebuilt between them. The tail call
+# backend needs a compiler with musttail. Without one make warns and the jump table backend is built and measured in
+# its place, so its result is not a tail call measurement. See README.md for recorded results.
+#
+# Usage: ./bench_dispatch.sh [binary] [make arguments...]
+#
+
+BINARY=${1:-../../../assembler/test_projects/bench/bin/bench.64x}
+[ $# -gt 0 ] && shift
+
+if [ ! -f "$BINARY" ]; then
+    echo "Binary $BINARY not found, assemble the bench project first" >&2
+    exit 1
+fi
+
+for DISPATCH in switch jumptable tailcall; do
+    rm -f obj/x64_linux/machine/interpreter.o
+    make -s -f Makefile.x64_linux VM_DISPATCH=$DISPATCH BIN=bin/interpreter_x64_$DISPATCH "$@" || exit 1
+done
+
+for DISPATCH in switch jumptable tailcall; do
+    echo "Dispatch: $DISPATCH"
+    bin/interpreter_x64_$DISPATCH "$BINARY" 2>/dev/null
+    echo
+done
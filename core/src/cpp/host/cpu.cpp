@@ -0,0 +1,84 @@
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <host/cpu.hpp>
+
+namespace MC64K::Host::CPU {
+
+namespace {
+
+char const* const asLevelNames[LEVEL_MAX] = {
+    "baseline",
+    "sse4",
+    "avx2"
+};
+
+/**
+ * Query the CPU. Uses cpuid via the compiler builtins, which also check that the OS saves the AVX state.
+ */
+Level detect() {
+#if defined(__GNUC__) && defined(__x86_64__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return AVX2;
+    }
+    if (__builtin_cpu_supports("sse4.2")) {
+        return SSE4;
+    }
+#endif
+    return BASELINE;
+}
+
+/**
+ * Apply any MC64K_CPU_LEVEL override. Unknown names and levels above the detected one are ignored.
+ */
+Level select() {
+    Level eLevel = getDetectedLevel();
+    if (char const* sLevel = std::getenv("MC64K_CPU_LEVEL")) {
+        for (unsigned u = 0; u < eLevel; ++u) {
+            if (!std::strcmp(sLevel, asLevelNames[u])) {
+                return (Level)u;
+            }
+        }
+    }
+    return eLevel;
+}
+
+} // namespace
+
+/**
+ * @inheritDoc
+ */
+Level getDetectedLevel() {
+    static Level const eDetected = detect();
+    return eDetected;
+}
+
+/**
+ * @inheritDoc
+ */
+Level getLevel() {
+    static Level const eSelected = select();
+    return eSelected;
+}
+
+/**
+ * @inheritDoc
+ */
+char const* getLevelName(Level eLevel) {
+    return eLevel < LEVEL_MAX ? asLevelNames[eLevel] : "unknown";
+}
+
+} // namespace
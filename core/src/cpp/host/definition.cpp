@@ -26,24 +26,49 @@ namespace MC64K::Host {
 Definition::Definition(
     char const* sName,
     Misc::Version const oVersion,
-    std::initializer_list<Machine::Interpreter::HCFVector> const& roHCFVectors,
+    std::initializer_list<Library> const& roLibraries,
     std::initializer_list<Loader::Symbol> const& roExportedSymbols,
     std::initializer_list<Loader::Symbol> const& roImportedSymbols
 ) :
     sHostName(sName),
     pcHCFVectors(0),
+    pcHostCalls(0),
+    poLibraries(0),
     oExportSet(roExportedSymbols),
     oImportSet(roImportedSymbols),
     oVersion(oVersion),
     uNumHCFVectors(0)
 {
-    assert(roHCFVectors.size() <= Machine::Limits::MAX_HCF_VECTORS);
-    if ((uNumHCFVectors = (uint32)roHCFVectors.size())) {
+    assert(roLibraries.size() <= Machine::Limits::MAX_HCF_VECTORS);
+    if ((uNumHCFVectors = (uint32)roLibraries.size())) {
         size_t uSize = sizeof(Machine::Interpreter::HCFVector) * uNumHCFVectors;
         if (!(pcHCFVectors = (Machine::Interpreter::HCFVector*)std::malloc(uSize))) {
             throw MC64K::OutOfMemoryException();
         }
-        std::memcpy(pcHCFVectors, roHCFVectors.begin(), uSize);
+        uSize = sizeof(Library) * uNumHCFVectors;
+        if (!(poLibraries = (Library*)std::malloc(uSize))) {
+            std::free((void*)pcHCFVectors);
+            throw MC64K::OutOfMemoryException();
+        }
+        std::memcpy(poLibraries, roLibraries.begin(), uSize);
+
+        uSize = sizeof(Machine::Interpreter::HostCall) * Machine::Limits::HOST_CALLS_PER_VECTOR * uNumHCFVectors;
+        if (!(pcHostCalls = (Machine::Interpreter::HostCall*)std::calloc(1, uSize))) {
+            std::free((void*)poLibraries);
+            std::free((void*)pcHCFVectors);
+            throw MC64K::OutOfMemoryException();
+        }
+        for (uint32 u = 0; u < uNumHCFVectors; ++u) {
+            pcHCFVectors[u] = poLibraries[u].cHCFVector;
+            if (poLibraries[u].pcHostCalls) {
+                assert(poLibraries[u].uNumHostCalls <= Machine::Limits::HOST_CALLS_PER_VECTOR);
+                std::memcpy(
+                    pcHostCalls + u * Machine::Limits::HOST_CALLS_PER_VECTOR,
+                    poLibraries[u].pcHostCalls,
+                    sizeof(Machine::Interpreter::HostCall) * poLibraries[u].uNumHostCalls
+                );
+            }
+        }
     }
 }
 
@@ -51,7 +76,21 @@ Definition::Definition(
  * @inheritDoc
  */
 Definition::~Definition() {
+    std::free((void*)pcHostCalls);
+    std::free((void*)poLibraries);
     std::free((void*)pcHCFVectors);
 }
 
+/**
+ * @inheritDoc
+ */
+int32 Definition::findLibrary(char const* sName) const {
+    for (uint32 u = 0; u < uNumHCFVectors; ++u) {
+        if (0 == std::strcmp(sName, poLibraries[u].sName)) {
+            return (int32)u;
+        }
+    }
+    return -1;
+}
+
 } // namespace
@@ -0,0 +1,206 @@
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <host/memory.hpp>
+#include <host/frame_arena.hpp>
+
+namespace MC64K::Host::Memory {
+
+namespace {
+
+enum {
+    // Allocations start this far into the block, leaving the header on its own cache line
+    HEADER_SPACE = 64,
+    RECORD_ALIGN = 16
+};
+
+/**
+ * When checks are enabled, each allocation is preceded by one of these, aligned to RECORD_ALIGN. The next record
+ * follows the guard of the allocation, so the allocations can be walked from the base.
+ */
+struct Record {
+    uint64 uOffset;
+    uint64 uSize;
+};
+
+inline uint8* alignUp(uint8* puAddress, uint64 uAlign) {
+    return (uint8*)(((uint64)puAddress + uAlign - 1) & ~(uAlign - 1));
+}
+
+} // namespace
+
+/**
+ * Magic value for an arena at a given address
+ */
+uint64 FrameArena::getMagic(FrameArena const* poArena) {
+    return 0x4652414D45415245ULL ^ (uint64)poArena;
+}
+
+/**
+ * @inheritDoc
+ */
+FrameArena* FrameArena::create(uint64 uCapacity, uint32 uFlags) {
+    if (uCapacity > ~0ULL - HEADER_SPACE - RECORD_ALIGN) {
+        return nullptr;
+    }
+    uCapacity = (uCapacity + RECORD_ALIGN - 1) & ~(uint64)(RECORD_ALIGN - 1);
+    FrameArena* poArena = (FrameArena*)Arena::allocate(HEADER_SPACE + uCapacity);
+    if (poArena) {
+        poArena->uMagic = getMagic(poArena);
+        poArena->puBase = (uint8*)poArena + HEADER_SPACE;
+        poArena->puNext = poArena->puBase;
+        poArena->puTop  = poArena->puBase + uCapacity;
+        poArena->uFlags = uFlags & FLAGS_ALL;
+        std::fprintf(
+            stderr,
+            "Frame Arena allocated at %p\n"
+            "\tCapacity: %lu\n"
+            "\tBase:     %p\n"
+            "\tChecks:   %s%s\n",
+            poArena,
+            uCapacity,
+            poArena->puBase,
+            (poArena->uFlags & GUARD)  ? "guard " : "",
+            (poArena->uFlags & POISON) ? "poison" : ""
+        );
+    }
+    return poArena;
+}
+
+/**
+ * @inheritDoc
+ */
+FrameArena::Result FrameArena::destroy(FrameArena* poArena) {
+    Result eResult = validate(poArena);
+    if (SUCCESS != eResult) {
+        std::fprintf(stderr, "Error destroying FrameArena: %d\n", eResult);
+        return eResult;
+    }
+    if (poArena->uFlags & GUARD) {
+        eResult = poArena->check();
+    }
+    std::fprintf(
+        stderr,
+        "Freeing Frame Arena at %p, %lu of %lu bytes in use\n",
+        poArena,
+        (uint64)(poArena->puNext - poArena->puBase),
+        (uint64)(poArena->puTop - poArena->puBase)
+    );
+    poArena->uMagic = 0; // should help protect against double-free
+    Arena::release(poArena);
+    return eResult;
+}
+
+/**
+ * @inheritDoc
+ */
+FrameArena::Result FrameArena::validate(void const* pRawArena) {
+    if (
+        !pRawArena ||
+        ((uint64)pRawArena) & (alignof(FrameArena) - 1)
+    ) {
+        return INVALID_ARENA;
+    }
+    FrameArena const* poArena = (FrameArena const*)pRawArena;
+    if (getMagic(poArena) != poArena->uMagic) {
+        return INVALID_ARENA;
+    }
+    return SUCCESS;
+}
+
+/**
+ * Allocation with records, guards and poison as enabled
+ */
+void* FrameArena::allocateChecked(uint64 uSize, uint64 uAlign) {
+    uint8* puRecord = alignUp(puNext, RECORD_ALIGN);
+    uint8* puBlock  = alignUp(puRecord + sizeof(Record), uAlign);
+    if (
+        puBlock > puTop ||
+        (uint64)(puTop - puBlock) < GUARD_SIZE ||
+        uSize > (uint64)(puTop - puBlock) - GUARD_SIZE
+    ) {
+        return nullptr;
+    }
+    Record* poRecord  = (Record*)puRecord;
+    poRecord->uOffset = (uint64)(puBlock - puRecord);
+    poRecord->uSize   = uSize;
+    if (uFlags & POISON) {
+        std::memset(puBlock, ALLOC_POISON, uSize);
+    }
+    std::memset(puBlock + uSize, GUARD_BYTE, GUARD_SIZE);
+    puNext = puBlock + uSize + GUARD_SIZE;
+    return puBlock;
+}
+
+/**
+ * Report corruption found by check() and mark the arena so that it is not walked again
+ */
+FrameArena::Result FrameArena::corrupted(char const* sWhat, uint8 const* puBlock) {
+    std::fprintf(stderr, "FrameArena %p: %s at %p\n", this, sWhat, puBlock);
+    uFlags |= CORRUPTED;
+    return CORRUPT;
+}
+
+/**
+ * Check the guard of every allocation since the last reset, stopping at the first that has been overwritten. The
+ * records live in guest writable memory, so each is bounded by the allocated range before it is followed.
+ */
+FrameArena::Result FrameArena::check() {
+    if (uFlags & CORRUPTED) {
+        return CORRUPT;
+    }
+    uint8* puRecord = alignUp(puBase, RECORD_ALIGN);
+    while (puRecord < puNext) {
+        uint64 uSpace = (uint64)(puNext - puRecord);
+        if (uSpace < sizeof(Record)) {
+            return corrupted("Truncated record", puRecord);
+        }
+        Record const* poRecord = (Record const*)puRecord;
+        if (
+            poRecord->uOffset < sizeof(Record) ||
+            poRecord->uOffset > uSpace ||
+            poRecord->uSize > uSpace - poRecord->uOffset ||
+            GUARD_SIZE > uSpace - poRecord->uOffset - poRecord->uSize
+        ) {
+            return corrupted("Record overwritten", puRecord);
+        }
+        uint8 const* puBlock = puRecord + poRecord->uOffset;
+        uint8 const* puGuard = puBlock + poRecord->uSize;
+        for (unsigned u = 0; u < GUARD_SIZE; ++u) {
+            if (GUARD_BYTE != puGuard[u]) {
+                return corrupted("Guard overwritten after block", puBlock);
+            }
+        }
+        puRecord = alignUp((uint8*)puGuard + GUARD_SIZE, RECORD_ALIGN);
+    }
+    return SUCCESS;
+}
+
+/**
+ * @inheritDoc
+ */
+FrameArena::Result FrameArena::reset() {
+    Result eResult = SUCCESS;
+    if (uFlags & GUARD) {
+        eResult = check();
+    }
+    if (uFlags & POISON) {
+        std::memset(puBase, FREE_POISON, (size_t)(puNext - puBase));
+    }
+    puNext = puBase;
+    return eResult;
+}
+
+} // namespace
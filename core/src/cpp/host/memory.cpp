@@ -14,21 +14,96 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <unordered_map>
+#include <sys/mman.h>
+#include <unistd.h>
 #include <misc/scalar.hpp>
 #include <host/memory.hpp>
 
-#if defined(__AVX2__)
-    #include <host/mem/avx2/functions.hpp>
-    #include <host/mem/generic/swap.hpp>
-    #include <host/mem/generic/find.hpp>
-#else
-    #include <host/mem/generic/functions.hpp>
-    #include <host/mem/generic/swap.hpp>
-    #include <host/mem/generic/find.hpp>
-#endif
+#include <host/cpu.hpp>
+#include <host/mem/generic/functions.hpp>
+#include <host/mem/generic/swap.hpp>
+#include <host/mem/generic/find.hpp>
+#include <host/mem/avx2/functions.hpp>
 
 namespace MC64K::Host::Memory {
 
+namespace {
+
+/**
+ * The block operation kernels for a given word size. There is a generic and an AVX2 version of each. The generic
+ * versions are already vectorised to the baseline SSE by the compiler and gain nothing from SSE4, so the SSE4 level
+ * uses them too. Selected the first time the word size is used.
+ */
+template<typename T>
+struct Kernels {
+    typedef void     (*Modify)(void* pBuffer, T uValue, uint64 uSize);
+    typedef void     (*Swap)(void* pDestination, void const* pSource, uint64 uCount);
+    typedef T const* (*Find)(void const* pBuffer, T uValue, uint64 uSize);
+
+    Modify cFill;
+    Modify cAnd;
+    Modify cOr;
+    Modify cXor;
+    Swap   cByteswap;
+    Find   cFind;
+
+    Kernels() {
+        if (CPU::getLevel() >= CPU::AVX2) {
+            cFill     = AVX2::fill<T>;
+            cAnd      = AVX2::bitwiseAnd<T>;
+            cOr       = AVX2::bitwiseOr<T>;
+            cXor      = AVX2::bitwiseXor<T>;
+            cByteswap = AVX2::byteswap<T>;
+            cFind     = AVX2::find<T>;
+        } else {
+            cFill     = Generic::fill<T>;
+            cAnd      = Generic::bitwiseAnd<T>;
+            cOr       = Generic::bitwiseOr<T>;
+            cXor      = Generic::bitwiseXor<T>;
+            cByteswap = Generic::byteswap<T>;
+            cFind     = Generic::find<T>;
+        }
+    }
+
+    static Kernels const& get() {
+        static Kernels const oKernels;
+        return oKernels;
+    }
+};
+
+} // namespace
+
+template<typename T>
+void fill(void* pBuffer, T uValue, uint64 uSize) {
+    Kernels<T>::get().cFill(pBuffer, uValue, uSize);
+}
+
+template<typename T>
+void bitwiseAnd(void* pBuffer, T uValue, uint64 uSize) {
+    Kernels<T>::get().cAnd(pBuffer, uValue, uSize);
+}
+
+template<typename T>
+void bitwiseOr(void* pBuffer, T uValue, uint64 uSize) {
+    Kernels<T>::get().cOr(pBuffer, uValue, uSize);
+}
+
+template<typename T>
+void bitwiseXor(void* pBuffer, T uValue, uint64 uSize) {
+    Kernels<T>::get().cXor(pBuffer, uValue, uSize);
+}
+
+template<typename T>
+void byteswap(void* pDestination, void const* pSource, uint64 uCount) {
+    Kernels<T>::get().cByteswap(pDestination, pSource, uCount);
+}
+
+template<typename T>
+T const* find(void const* pBuffer, T uValue, uint64 uSize) {
+    return Kernels<T>::get().cFind(pBuffer, uValue, uSize);
+}
+
 // Template instantiations
 template void fill<uint8>(void* pBuffer, uint8 uValue, uint64 uSize);
 template void fill<uint16>(void* pBuffer, uint16 uValue, uint64 uSize);
@@ -110,7 +185,7 @@ ElementBuffer* ElementBuffer::allocateBuffer(uint16 uElementCount, uint16 uEleme
     // Determine the header size. This is the element buffer, with the map entry extended to have
     // enough bits to cover the rounded element count.
     size_t uHeaderSize      = sizeof(ElementBuffer) + (uMapCount - 1) * sizeof(uint64);
-    ElementBuffer* pBuffer  = (ElementBuffer*)std::calloc(uHeaderSize + uAllocCount * uAllocSize, sizeof(uint8));
+    ElementBuffer* pBuffer  = (ElementBuffer*)Arena::allocate(uHeaderSize + uAllocCount * uAllocSize, true);
 
     // Record the actual allocation count and size
     if (pBuffer) {
@@ -177,7 +252,7 @@ ElementBuffer::Result ElementBuffer::freeBuffer(ElementBuffer* pBuffer) {
             (unsigned)pBuffer->uAlignedSize
         );
         pBuffer->uMagic = 0; // should help protect against double-free
-        std::free(pBuffer);
+        Arena::release(pBuffer);
     }
     return eResult;
 }
@@ -248,5 +323,148 @@ ElementBuffer::Result ElementBuffer::free(void* pElement) {
 }
 
 
+namespace {
+
+/**
+ * A region handed out by the Arena that did not come from the heap
+ */
+struct Mapping {
+    void*  pBase;
+    uint64 uSize;
+};
+
+/**
+ * Mapped regions, keyed by the address handed out. Never destroyed, as blocks may still be released by the
+ * destructors of other statics after this one would have gone.
+ */
+std::unordered_map<void const*, Mapping>& mappings() {
+    static auto& roMappings = *new std::unordered_map<void const*, Mapping>;
+    return roMappings;
+}
+
+bool enableArena() {
+    if (!std::getenv("MC64K_HUGE_PAGES")) {
+        return false;
+    }
+    std::fprintf(
+        stderr,
+        "Arena: Huge page backing enabled for blocks of %u KiB or more\n",
+        (unsigned)(Arena::BLOCK_THRESHOLD >> 10)
+    );
+    return true;
+}
+
+/**
+ * Map a cleared, huge page aligned region. The size must be a multiple of the huge page size.
+ */
+void* mapHugePages(uint64 uSize) {
+#ifdef MAP_HUGETLB
+    // Explicit huge pages, only succeeds if the administrator reserved some
+    void* pBlock = mmap(nullptr, uSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (MAP_FAILED != pBlock) {
+        return pBlock;
+    }
+#endif
+
+    // Otherwise, over allocate by a huge page and trim the ends to get the alignment transparent huge pages need
+    uint8* puMap = (uint8*)mmap(
+        nullptr,
+        uSize + Arena::HUGE_PAGE_SIZE,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS,
+        -1,
+        0
+    );
+    if (MAP_FAILED == (void*)puMap) {
+        return nullptr;
+    }
+    uint8* puBlock = (uint8*)(((uint64)puMap + Arena::HUGE_PAGE_MASK) & ~(uint64)Arena::HUGE_PAGE_MASK);
+    uint8* puEnd   = puMap + uSize + Arena::HUGE_PAGE_SIZE;
+    if (puBlock > puMap) {
+        munmap(puMap, (size_t)(puBlock - puMap));
+    }
+    if (puEnd > puBlock + uSize) {
+        munmap(puBlock + uSize, (size_t)(puEnd - puBlock - uSize));
+    }
+#ifdef MADV_HUGEPAGE
+    madvise(puBlock, uSize, MADV_HUGEPAGE);
+#endif
+    return puBlock;
+}
+
+} // namespace
+
+/**
+ * @inheritDoc
+ */
+bool Arena::isEnabled() {
+    static bool const bEnabled = enableArena();
+    return bEnabled;
+}
+
+/**
+ * @inheritDoc
+ */
+void* Arena::allocate(uint64 uSize, bool bClear) {
+    if (uSize >= BLOCK_THRESHOLD && isEnabled()) {
+        uint64 uMapSize = (uSize + HUGE_PAGE_MASK) & ~(uint64)HUGE_PAGE_MASK;
+        if (void* pBlock = mapHugePages(uMapSize)) {
+            mappings()[pBlock] = { pBlock, uMapSize };
+            return pBlock;
+        }
+        // Fall back to the heap
+    }
+    return bClear ? std::calloc(uSize, 1) : std::malloc(uSize);
+}
+
+/**
+ * @inheritDoc
+ */
+void* Arena::allocateStack(uint64 uSize) {
+    if (!isEnabled()) {
+        return std::calloc(uSize, 1);
+    }
+    uint64 uPageSize = (uint64)sysconf(_SC_PAGESIZE);
+    uSize = (uSize + uPageSize - 1) & ~(uPageSize - 1);
+
+    // Map the whole region inaccessible then open up all but the first and last page. The stack grows down, so the
+    // base is placed directly above the lower guard page.
+    uint64 uMapSize = uSize + 2 * uPageSize;
+    uint8* puMap    = (uint8*)mmap(nullptr, uMapSize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (MAP_FAILED == (void*)puMap) {
+        return nullptr;
+    }
+    uint8* puBase = puMap + uPageSize;
+    if (mprotect(puBase, uSize, PROT_READ | PROT_WRITE)) {
+        munmap(puMap, uMapSize);
+        return nullptr;
+    }
+#ifdef MADV_HUGEPAGE
+    if (uSize >= BLOCK_THRESHOLD) {
+        madvise(puBase, uSize, MADV_HUGEPAGE);
+    }
+#endif
+    mappings()[puBase] = { puMap, uMapSize };
+    return puBase;
+}
+
+/**
+ * @inheritDoc
+ */
+void Arena::release(void* pBlock) {
+    if (!pBlock) {
+        return;
+    }
+    if (isEnabled()) {
+        auto oMapping = mappings().find(pBlock);
+        if (oMapping != mappings().end()) {
+            munmap(oMapping->second.pBase, oMapping->second.uSize);
+            mappings().erase(oMapping);
+            return;
+        }
+    }
+    std::free(pBlock);
+}
+
 } // namespace
 
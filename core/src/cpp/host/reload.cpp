@@ -0,0 +1,144 @@
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <climits>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/inotify.h>
+#include <host/reload.hpp>
+#include <loader/error.hpp>
+#include <machine/timing.hpp>
+
+namespace MC64K::Host {
+
+using Machine::Nanoseconds;
+
+/**
+ * @inheritDoc
+ */
+BinaryWatcher::BinaryWatcher(Definition const& roDefinition, char const* sBinaryPath) :
+    roDefinition(roDefinition),
+    sBinaryPath(sBinaryPath),
+    sBinaryName(sBinaryPath),
+    poPending(0),
+    bStop(false),
+    iNotifyFD(-1)
+{
+    // Editors and build tools frequently replace the file rather than rewrite it, so watch the directory
+    // and filter on the name.
+    char const* sSlash = std::strrchr(sBinaryPath, '/');
+    char sDirectory[PATH_MAX] = ".";
+    if (sSlash) {
+        size_t uLength = (size_t)(sSlash - sBinaryPath);
+        if (uLength >= sizeof(sDirectory)) {
+            throw MC64K::Exception("Binary path too long to watch");
+        }
+        if (uLength) {
+            std::memcpy(sDirectory, sBinaryPath, uLength);
+            sDirectory[uLength] = 0;
+        } else {
+            sDirectory[0] = '/';
+            sDirectory[1] = 0;
+        }
+        sBinaryName = sSlash + 1;
+    }
+
+    if (
+        (iNotifyFD = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC)) < 0 ||
+        ::inotify_add_watch(iNotifyFD, sDirectory, IN_CLOSE_WRITE | IN_MOVED_TO) < 0
+    ) {
+        if (iNotifyFD >= 0) {
+            ::close(iNotifyFD);
+        }
+        throw MC64K::Exception("Unable to watch binary for changes");
+    }
+
+    std::fprintf(stderr, "Runtime: Watching \'%s\' in \'%s\' for changes\n", sBinaryName, sDirectory);
+
+    oThread = std::thread(&BinaryWatcher::watch, this);
+}
+
+/**
+ * @inheritDoc
+ */
+BinaryWatcher::~BinaryWatcher() {
+    bStop.store(true);
+    if (oThread.joinable()) {
+        oThread.join();
+    }
+    ::close(iNotifyFD);
+    delete takePending();
+}
+
+/**
+ * @inheritDoc
+ */
+void BinaryWatcher::watch() {
+    enum {
+        POLL_TIMEOUT_MS = 200,
+        SETTLE_TIME_NS  = 50000000 // Let the writer finish before we read
+    };
+
+    alignas(inotify_event) char aBuffer[4096];
+    pollfd oPoll = { iNotifyFD, POLLIN, 0 };
+
+    while (!bStop.load(std::memory_order_relaxed)) {
+        if (::poll(&oPoll, 1, POLL_TIMEOUT_MS) <= 0) {
+            continue;
+        }
+        bool bChanged = false;
+        ssize_t iRead;
+        while ((iRead = ::read(iNotifyFD, aBuffer, sizeof(aBuffer))) > 0) {
+            for (char const* pEvent = aBuffer; pEvent < aBuffer + iRead; ) {
+                inotify_event const* poEvent = (inotify_event const*)pEvent;
+                if (poEvent->len && 0 == std::strcmp(poEvent->name, sBinaryName)) {
+                    bChanged = true;
+                }
+                pEvent += sizeof(inotify_event) + poEvent->len;
+            }
+        }
+        if (bChanged) {
+            Nanoseconds::sleep(SETTLE_TIME_NS);
+            reload();
+        }
+    }
+}
+
+/**
+ * @inheritDoc
+ */
+void BinaryWatcher::reload() {
+    Nanoseconds::Value uStart = Nanoseconds::mark();
+    Loader::Executable* poExecutable = 0;
+    try {
+        Loader::Binary oBinary(roDefinition);
+        poExecutable = oBinary.load(sBinaryPath);
+    } catch (Loader::Error& oError) {
+        std::fprintf(stderr, "Runtime: Reload of \'%s\' failed, %s\n", sBinaryPath, oError.sIssue);
+        return;
+    } catch (Loader::LinkError&) {
+        std::fprintf(stderr, "Runtime: Reload of \'%s\' failed, unresolved imports\n", sBinaryPath);
+        return;
+    }
+    std::fprintf(
+        stderr,
+        "Runtime: Reloaded \'%s\' in %.3f ms, pending swap\n",
+        sBinaryPath,
+        1e-6 * (float64)(Nanoseconds::mark() - uStart)
+    );
+    delete poPending.exchange(poExecutable, std::memory_order_release);
+}
+
+} // namespace
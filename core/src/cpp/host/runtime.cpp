@@ -16,19 +16,47 @@
 #include <cstdlib>
 #include <cassert>
 #include <host/runtime.hpp>
+#include <host/cpu.hpp>
+#include <host/memory.hpp>
 #include <loader/executable.hpp>
+#include <loader/error.hpp>
+#include <machine/error.hpp>
 
 namespace MC64K::Host {
 
+using Machine::Nanoseconds;
+
+Runtime* Runtime::poActive = 0;
+
+/**
+ * The machine stack comes from the guest memory arena and block fills use the host memory kernels
+ */
+Machine::Interpreter::MemoryHooks const Runtime::oMemoryHooks = {
+    Memory::Arena::allocateStack,
+    Memory::Arena::release,
+    Memory::fill<uint8>,
+    Memory::fill<uint16>,
+    Memory::fill<uint32>,
+    Memory::fill<uint64>
+};
+
 /**
  * @inheritDoc
  */
 Runtime::Runtime(Definition& roDefinition, char const* sBinaryPath) :
     roDefinition(roDefinition),
-    poExecutable(0)
+    poExecutable(0),
+    poVerifier(0),
+    sBinaryPath(sBinaryPath),
+    poWatcher(0)
 {
+    assert(!poActive);
+
+    Nanoseconds::Value uStart = Nanoseconds::mark();
+
     Loader::Binary oBinary(roDefinition);
-    poExecutable = oBinary.load(sBinaryPath);
+    Loader::Executable* poLoaded = oBinary.load(sBinaryPath);
+    poExecutable = poLoaded;
 
     std::fprintf(
         stderr,
@@ -37,25 +65,88 @@ Runtime::Runtime(Definition& roDefinition, char const* sBinaryPath) :
         sBinaryPath
     );
 
+    try {
+        roDefinition.getImportedSymbolSet().linkAgainst(*poExecutable->getExportedSymbolSet());
+        poVerifier = new Machine::Verifier(*poExecutable);
+    } catch (Loader::LinkError&) {
+        delete poExecutable;
+        throw;
+    } catch (Machine::Error&) {
+        delete poExecutable;
+        throw;
+    }
+    poLoaded->bindImportReferences(poVerifier->getImportReferences());
+
+    Nanoseconds::Value uLoaded = Nanoseconds::mark();
+
+    uint32 uNumLibraries;
+    try {
+        uNumLibraries = initLibraries(sBinaryPath);
+    } catch (Loader::Error&) {
+        delete poVerifier;
+        delete poExecutable;
+        throw;
+    }
+    poActive = this;
+
+    Nanoseconds::Value uLibraries = Nanoseconds::mark();
+
     // If the binary loaded without throwing stuff all over the shop, initialise the Interpreter
+    Machine::Interpreter::initMemoryHooks(&oMemoryHooks);
     Machine::Interpreter::allocateStack(poExecutable->getStackSize());
     Machine::Interpreter::initHCFVectors(
-        roDefinition.getHCFVectors(),
+        aHCFVectors,
         roDefinition.getNumHCFVectors()
     );
+    Machine::Interpreter::initHostCalls(acHostCalls.data());
     Machine::Interpreter::initImportSymbols(
         poExecutable->getImportedSymbolSet()->getSymbols(),
         (uint32)poExecutable->getImportedSymbolSet()->getCount()
     );
+    Machine::Interpreter::setVerifier(poVerifier);
+
+    Nanoseconds::Value uReady = Nanoseconds::mark();
+
+    std::fprintf(
+        stderr,
+        "Runtime: Startup %.3f ms [load and verify %.3f ms, libraries %.3f ms (%u of %u available), interpreter %.3f ms]\n",
+        1e-6 * (float64)(uReady - uStart),
+        1e-6 * (float64)(uLoaded - uStart),
+        1e-6 * (float64)(uLibraries - uLoaded),
+        uNumLibraries,
+        roDefinition.getNumHCFVectors(),
+        1e-6 * (float64)(uReady - uLibraries)
+    );
+
+    std::fprintf(
+        stderr,
+        "Runtime: CPU kernels selected for %s [detected %s]\n",
+        CPU::getLevelName(CPU::getLevel()),
+        CPU::getLevelName(CPU::getDetectedLevel())
+    );
 }
 
 /**
  * @inheritDoc
  */
 Runtime::~Runtime() {
+    delete poWatcher;
     Machine::Interpreter::dumpState(stderr, 0xFFFFFFFF);
+    Definition::Library const* poLibraries = roDefinition.getLibraries();
+    for (uint32 u = roDefinition.getNumHCFVectors(); u-- > 0; ) {
+        if (LIB_BOUND == auLibraryState[u] && poLibraries[u].cDone) {
+            poLibraries[u].cDone();
+        }
+    }
+    Machine::Interpreter::setVerifier(0);
+    delete poVerifier;
     delete poExecutable;
+    for (auto poRetired : aRetired) {
+        delete poRetired;
+    }
     Machine::Interpreter::freeStack();
+    Machine::Interpreter::initMemoryHooks(0);
+    poActive = 0;
 }
 
 /**
@@ -69,4 +160,220 @@ Machine::Interpreter::Status Runtime::invoke(size_t uFunctionID) {
     return Machine::Interpreter::getStatus();
 }
 
+/**
+ * @inheritDoc
+ */
+uint32 Runtime::initLibraries(char const* sBinaryPath) {
+    uint32 uNumLibraries = roDefinition.getNumHCFVectors();
+    uint32 uAvailable    = 0;
+
+    // Entries 0 and 1 of the dependency table are the target and the host. Anything after that names a library.
+    Loader::Dependency const* poDependencies = poExecutable->getDependencies();
+    uint32 uNumDependencies = poExecutable->getNumDependencies();
+
+    if (uNumDependencies > 2) {
+        std::memset(auLibraryState, LIB_UNAVAILABLE, sizeof(auLibraryState));
+        for (uint32 u = 2; u < uNumDependencies; ++u) {
+            int32 iSlot = roDefinition.findLibrary(poDependencies[u].sName);
+            if (iSlot < 0) {
+                std::fprintf(stderr, "Runtime: Unknown host library \'%s\'\n", poDependencies[u].sName);
+                throw Loader::Error(sBinaryPath, "requires an unknown host library");
+            }
+            if (!roDefinition.getVersion().isCompatible(poDependencies[u].oVersion)) {
+                std::fprintf(
+                    stderr,
+                    "Runtime: Host library \'%s\' version check failed: Need %u.%u.%u, have %u.%u.%u\n",
+                    poDependencies[u].sName,
+                    poDependencies[u].oVersion.getMajor(),
+                    poDependencies[u].oVersion.getMinor(),
+                    poDependencies[u].oVersion.getPatch(),
+                    roDefinition.getVersion().getMajor(),
+                    roDefinition.getVersion().getMinor(),
+                    roDefinition.getVersion().getPatch()
+                );
+                throw Loader::Error(sBinaryPath, "requires an incompatible host library");
+            }
+            auLibraryState[iSlot] = LIB_DECLARED;
+        }
+    } else {
+        // No libraries declared, assume the binary may use any of them.
+        std::memset(auLibraryState, LIB_DECLARED, sizeof(auLibraryState));
+    }
+
+    acHostCalls.assign((size_t)uNumLibraries * Machine::Limits::HOST_CALLS_PER_VECTOR, nullptr);
+
+    Definition::Library const* poLibraries = roDefinition.getLibraries();
+    for (uint32 u = 0; u < uNumLibraries; ++u) {
+        if (LIB_UNAVAILABLE == auLibraryState[u]) {
+            aHCFVectors[u] = unavailableVector;
+            continue;
+        }
+        ++uAvailable;
+        if (poLibraries[u].cInit) {
+            poLibraries[u].cInit();
+        }
+        aHCFVectors[u]    = poLibraries[u].cHCFVector;
+        auLibraryState[u] = LIB_BOUND;
+        bindHostCalls(u);
+    }
+    return uAvailable;
+}
+
+/**
+ * @inheritDoc
+ */
+void Runtime::bindHostCalls(uint32 const uSlot) {
+    size_t uOffset = (size_t)uSlot * Machine::Limits::HOST_CALLS_PER_VECTOR;
+    std::memcpy(
+        acHostCalls.data() + uOffset,
+        roDefinition.getHostCalls() + uOffset,
+        sizeof(Machine::Interpreter::HostCall) * Machine::Limits::HOST_CALLS_PER_VECTOR
+    );
+}
+
+/**
+ * @inheritDoc
+ */
+void Runtime::enableHotReload() {
+    if (!poWatcher) {
+        poWatcher = new BinaryWatcher(roDefinition, sBinaryPath);
+    }
+}
+
+/**
+ * @inheritDoc
+ */
+bool Runtime::canReplaceWith(Loader::Executable const* poReplacement) const {
+    if (poReplacement->getStackSize() > poExecutable->getStackSize()) {
+        std::fprintf(stderr, "Runtime: Reloaded executable requires a larger stack\n");
+        return false;
+    }
+    Loader::SymbolSet const* poOld = poExecutable->getImportedSymbolSet();
+    Loader::SymbolSet const* poNew = poReplacement->getImportedSymbolSet();
+    if (poNew->getCount() < poOld->getCount()) {
+        std::fprintf(stderr, "Runtime: Reloaded executable removes imported symbols\n");
+        return false;
+    }
+    for (size_t u = 0; u < poOld->getCount(); ++u) {
+        if (
+            (*poOld)[u].uFlags != (*poNew)[u].uFlags ||
+            std::strcmp((*poOld)[u].sIdentifier, (*poNew)[u].sIdentifier)
+        ) {
+            std::fprintf(
+                stderr,
+                "Runtime: Reloaded executable changes imported symbol %zu \'%s\'\n",
+                u,
+                (*poOld)[u].sIdentifier
+            );
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @inheritDoc
+ */
+void Runtime::releaseRetired(Machine::Interpreter::VMCodeEntryPoint const* apEntryPoints, uint32 const uCount) {
+    size_t uNumKept = 0;
+    for (auto poRetired : aRetired) {
+        uint8 const* puByteCode = poRetired->getByteCode();
+        uint64       uSize      = poRetired->getByteCodeSize();
+        bool bReferenced = Machine::Interpreter::isReferenced(puByteCode, uSize);
+        for (uint32 u = 0; !bReferenced && u < uCount; ++u) {
+            bReferenced = apEntryPoints[u] && (uint64)(apEntryPoints[u] - puByteCode) < uSize;
+        }
+        if (bReferenced) {
+            aRetired[uNumKept++] = poRetired;
+        } else {
+            std::fprintf(stderr, "Runtime: Released retired executable instance at %p\n", poRetired);
+            delete poRetired;
+        }
+    }
+    aRetired.resize(uNumKept);
+}
+
+/**
+ * @inheritDoc
+ */
+bool Runtime::adoptPending(Machine::Interpreter::VMCodeEntryPoint* apEntryPoints, uint32 const uCount) {
+    Loader::Executable* poReplacement = poWatcher->takePending();
+    if (!poReplacement) {
+        return false;
+    }
+
+    if (!canReplaceWith(poReplacement)) {
+        std::fprintf(stderr, "Runtime: Keeping current executable, restart to pick up the change\n");
+        delete poReplacement;
+        return false;
+    }
+
+    // The host imports, e.g. main, are only linked here, on the interpreter thread, once the replacement has been
+    // accepted. Until then the current links are left untouched.
+    try {
+        roDefinition.getImportedSymbolSet().checkAgainst(*poReplacement->getExportedSymbolSet());
+    } catch (Loader::LinkError&) {
+        std::fprintf(stderr, "Runtime: Keeping current executable, replacement does not export the host imports\n");
+        delete poReplacement;
+        return false;
+    }
+
+    Machine::Verifier* poReplacementVerifier;
+    try {
+        poReplacementVerifier = new Machine::Verifier(*poReplacement);
+    } catch (Machine::Error& oError) {
+        std::fprintf(stderr, "Runtime: Keeping current executable, replacement rejected: %s\n", oError.sIssue);
+        delete poReplacement;
+        return false;
+    }
+    roDefinition.getImportedSymbolSet().linkAgainst(*poReplacement->getExportedSymbolSet());
+    poReplacement->bindImportReferences(poReplacementVerifier->getImportReferences());
+
+    // Remap entry points that refer to exported code in the current executable. Anything else is left alone
+    // and continues to run the retired code.
+    Loader::SymbolSet const* poOldExports = poExecutable->getExportedSymbolSet();
+    Loader::SymbolSet const* poNewExports = poReplacement->getExportedSymbolSet();
+    uint32 uRemapped = 0;
+    for (uint32 u = 0; u < uCount; ++u) {
+        if (!apEntryPoints[u]) {
+            continue;
+        }
+        for (size_t uSymbol = 0; uSymbol < poOldExports->getCount(); ++uSymbol) {
+            Loader::Symbol const& roOld = (*poOldExports)[uSymbol];
+            if (roOld.puByteCode == apEntryPoints[u]) {
+                Loader::Symbol const* poNew = poNewExports->find(roOld.sIdentifier, Loader::Symbol::EXECUTE);
+                if (poNew) {
+                    apEntryPoints[u] = poNew->puByteCode;
+                    ++uRemapped;
+                }
+                break;
+            }
+        }
+    }
+
+    aRetired.push_back(poExecutable);
+    poExecutable = poReplacement;
+    Machine::Interpreter::initImportSymbols(
+        poExecutable->getImportedSymbolSet()->getSymbols(),
+        (uint32)poExecutable->getImportedSymbolSet()->getCount()
+    );
+
+    // Retired code no longer counts as verified, anything still running it carries on in the checked loop.
+    Machine::Interpreter::setVerifier(poReplacementVerifier);
+    delete poVerifier;
+    poVerifier = poReplacementVerifier;
+
+    std::fprintf(stderr, "Runtime: Swapped executable, remapped %u of %u entry points\n", uRemapped, uCount);
+    return true;
+}
+
+/**
+ * @inheritDoc
+ */
+Machine::Interpreter::Status Runtime::unavailableVector(uint8 uFunctionID) {
+    (void)uFunctionID;
+    std::fprintf(stderr, "Runtime: Call to a host library the executable did not declare\n");
+    return Machine::Interpreter::UNKNOWN_HOST_CALL;
+}
+
 } // namespace
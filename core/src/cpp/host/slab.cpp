@@ -0,0 +1,232 @@
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <host/memory.hpp>
+#include <host/slab.hpp>
+
+namespace MC64K::Host::Memory {
+
+/**
+ * Block header. The block address handed out follows immediately. The magic identifies a live block of this
+ * allocator since the last reset, it is inverted while the block is free. While a block is free, pNext links it into
+ * the free list for the class, otherwise uSize is the requested size.
+ */
+struct Slab::Header {
+    uint32 uMagic;
+    uint32 uClass;
+    union {
+        uint64  uSize;
+        Header* pNext;
+    };
+};
+
+namespace {
+
+/**
+ * Size class for a block size, including the header. Sizes beyond the largest class give LARGE_CLASS.
+ */
+inline uint32 sizeClass(uint64 uBlockSize) {
+    if (uBlockSize <= (1ULL << Slab::MIN_CLASS_EXP)) {
+        return 0;
+    }
+    uint32 uExp = 64 - (uint32)__builtin_clzll(uBlockSize - 1);
+    return uExp > Slab::MAX_CLASS_EXP ? (uint32)Slab::LARGE_CLASS : uExp - Slab::MIN_CLASS_EXP;
+}
+
+} // namespace
+
+/**
+ * @inheritDoc
+ */
+Slab::Slab() :
+    puNext(nullptr),
+    puEnd(nullptr),
+    uSlab(0),
+    uMagic((uint32)((uint64)this >> 4) ^ 0x51AB51AB)
+{
+    static_assert(16 == sizeof(Header), "Invalid Slab::Header size");
+    std::memset(apFree, 0, sizeof(apFree));
+    std::memset(&oStatistics, 0, sizeof(oStatistics));
+}
+
+/**
+ * @inheritDoc
+ */
+Slab::~Slab() {
+    reset();
+    for (uint8* puSlab : vSlabs) {
+        Arena::release(puSlab);
+    }
+}
+
+/**
+ * Check if an address lies in a slab
+ */
+bool Slab::isSlabAddress(void const* pAddress) const {
+    auto pSlab = std::upper_bound(vSorted.begin(), vSorted.end(), (uint8 const*)pAddress);
+    return pSlab != vSorted.begin() && (uint8 const*)pAddress < *(pSlab - 1) + SLAB_SIZE;
+}
+
+/**
+ * Carve a block from the current slab, moving on to the next, or a new one, when it is exhausted. The remainder of
+ * an exhausted slab is not used until the next reset.
+ */
+uint8* Slab::carve(uint64 uBlockSize) {
+    if (puNext + uBlockSize > puEnd) {
+        if (uSlab == vSlabs.size()) {
+            uint8* puSlab = (uint8*)Arena::allocate(SLAB_SIZE);
+            if (!puSlab) {
+                return nullptr;
+            }
+            vSlabs.push_back(puSlab);
+            vSorted.insert(std::upper_bound(vSorted.begin(), vSorted.end(), puSlab), puSlab);
+            oStatistics.uSlabBytes += SLAB_SIZE;
+        }
+        puNext = vSlabs[uSlab++];
+        puEnd  = puNext + SLAB_SIZE;
+    }
+    uint8* puBlock = puNext;
+    puNext += uBlockSize;
+    return puBlock;
+}
+
+/**
+ * @inheritDoc
+ */
+void* Slab::allocate(uint64 uSize) {
+    if (uSize > ~0ULL - sizeof(Header)) {
+        return nullptr;
+    }
+    uint32  uClass = sizeClass(uSize + sizeof(Header));
+    Header* pHeader;
+    if (uClass == LARGE_CLASS) {
+        pHeader = (Header*)Arena::allocate(uSize + sizeof(Header));
+        if (!pHeader) {
+            return nullptr;
+        }
+        oLarge.insert(pHeader);
+    } else if ( (pHeader = apFree[uClass]) ) {
+        apFree[uClass] = pHeader->pNext;
+    } else if ( !(pHeader = (Header*)carve(1ULL << (uClass + MIN_CLASS_EXP))) ) {
+        return nullptr;
+    }
+    pHeader->uMagic = uMagic;
+    pHeader->uClass = uClass;
+    pHeader->uSize  = uSize;
+
+    ++oStatistics.auAllocations[uClass];
+    ++oStatistics.auLive[uClass];
+    ++oStatistics.uLiveBlocks;
+    oStatistics.uLiveBytes += uSize;
+    if (oStatistics.uLiveBytes > oStatistics.uPeakBytes) {
+        oStatistics.uPeakBytes = oStatistics.uLiveBytes;
+    }
+    return pHeader + 1;
+}
+
+/**
+ * @inheritDoc
+ */
+bool Slab::release(void* pBlock) {
+    if (!pBlock) {
+        return true;
+    }
+    if ((uint64)pBlock & (sizeof(Header) - 1)) {
+        return false;
+    }
+    Header* pHeader = (Header*)pBlock - 1;
+
+    // Large blocks are returned to the Arena on release, so check for them before touching the header
+    if (oLarge.erase(pHeader)) {
+        --oStatistics.auLive[LARGE_CLASS];
+        --oStatistics.uLiveBlocks;
+        oStatistics.uLiveBytes -= pHeader->uSize;
+        Arena::release(pHeader);
+        return true;
+    }
+
+    // Slabs are only released on destruction, so any header within one can be read safely
+    if (!isSlabAddress(pHeader) || pHeader->uMagic != uMagic || pHeader->uClass >= LARGE_CLASS) {
+        return false;
+    }
+    uint32 uClass = pHeader->uClass;
+
+    --oStatistics.auLive[uClass];
+    --oStatistics.uLiveBlocks;
+    oStatistics.uLiveBytes -= pHeader->uSize;
+
+    pHeader->uMagic = ~uMagic;
+    pHeader->pNext  = apFree[uClass];
+    apFree[uClass]  = pHeader;
+    return true;
+}
+
+/**
+ * @inheritDoc
+ */
+void Slab::reset() {
+    for (Header* pHeader : oLarge) {
+        Arena::release(pHeader);
+    }
+    oLarge.clear();
+
+    // Changing the magic invalidates every block handed out so far without touching them
+    uMagic += 0x9E3779B9;
+
+    std::memset(apFree, 0, sizeof(apFree));
+    puNext = puEnd = nullptr;
+    uSlab  = 0;
+
+    oStatistics.uLiveBytes  = 0;
+    oStatistics.uLiveBlocks = 0;
+    std::memset(oStatistics.auLive, 0, sizeof(oStatistics.auLive));
+    ++oStatistics.uResets;
+}
+
+/**
+ * @inheritDoc
+ */
+void Slab::report(char const* sName) const {
+    std::fprintf(
+        stderr,
+        "%s: Live %lu bytes in %lu blocks, peak %lu bytes, %lu KiB in %lu slabs, %lu resets\n",
+        sName,
+        oStatistics.uLiveBytes,
+        oStatistics.uLiveBlocks,
+        oStatistics.uPeakBytes,
+        oStatistics.uSlabBytes >> 10,
+        (uint64)vSlabs.size(),
+        oStatistics.uResets
+    );
+    for (unsigned u = 0; u <= LARGE_CLASS; ++u) {
+        if (oStatistics.auAllocations[u]) {
+            if (u == LARGE_CLASS) {
+                std::fprintf(stderr, "\tLarge:  %lu allocated, %lu live\n",
+                    oStatistics.auAllocations[u],
+                    oStatistics.auLive[u]
+                );
+            } else {
+                std::fprintf(stderr, "\t%6u: %lu allocated, %lu live\n",
+                    1U << (u + MIN_CLASS_EXP),
+                    oStatistics.auAllocations[u],
+                    oStatistics.auLive[u]
+                );
+            }
+        }
+    }
+}
+
+} // namespace
@@ -127,25 +127,37 @@ void writeAudio() {
 }
 
 /**
- * Display::hostVector(uint8 uFunctionID)
+ * No operation
+ */
+void nop() {
+}
+
+/**
+ * Builds the host call table
+ */
+constexpr ABI::HostCallTable<CALL_MAX> makeHostCalls() {
+    ABI::HostCallTable<CALL_MAX> acHostCalls = {};
+
+    acHostCalls[INIT]  = ABI::call<nop>;
+    acHostCalls[DONE]  = ABI::call<nop>;
+    acHostCalls[OPEN]  = ABI::call<openAudio>;
+    acHostCalls[CLOSE] = ABI::call<closeAudio>;
+    acHostCalls[WRITE] = ABI::call<writeAudio>;
+
+    return acHostCalls;
+}
+
+ABI::HostCallTable<CALL_MAX> const acHostCalls = makeHostCalls();
+
+/**
+ * Audio::hostVector(uint8 uFunctionID)
  */
 Interpreter::Status hostVector(uint8 uFunctionID) {
-    Call iOperation = (Call) uFunctionID;
-    switch (iOperation) {
-        case INIT:
-        case DONE:
-            break;
-        case OPEN:  openAudio();  break;
-        case CLOSE: closeAudio(); break;
-        case WRITE: writeAudio(); break;
-        default:
-            std::fprintf(stderr, "Unknown Audio operation %d\n", iOperation);
-            return Interpreter::UNKNOWN_HOST_CALL;
-            break;
+    if (uFunctionID < CALL_MAX && acHostCalls[uFunctionID]) {
+        return acHostCalls[uFunctionID]();
     }
-
-    return Interpreter::RUNNING;
+    std::fprintf(stderr, "Unknown Audio operation %d\n", (int)uFunctionID);
+    return Interpreter::UNKNOWN_HOST_CALL;
 }
 
 } // namespace
-
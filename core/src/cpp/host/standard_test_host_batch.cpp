@@ -0,0 +1,164 @@
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+#include <cstdio>
+#include <machine/register.hpp>
+#include <host/standard_test_host_batch.hpp>
+
+using MC64K::Machine::Interpreter;
+using MC64K::Machine::GPRegister;
+using MC64K::Machine::FPRegister;
+
+namespace MC64K::StandardTestHost::Batch {
+
+/**
+ * Number of register values following a command
+ */
+inline uint32 numValues(Command const* poCommand) {
+    return (uint32)__builtin_popcount(poCommand->uLoad);
+}
+
+/**
+ * Current batch_exec nesting depth
+ */
+uint32 uDepth = 0;
+
+/**
+ * Counts one level of batch_exec nesting for as long as it is in scope
+ */
+struct DepthGuard {
+    DepthGuard()  { ++uDepth; }
+    ~DepthGuard() { --uDepth; }
+};
+
+/**
+ * No operation
+ */
+void nop() {
+}
+
+/**
+ * EXEC
+ */
+Interpreter::Status exec() {
+    Command const* poCommand = Interpreter::gpr<ABI::PTR_REG_0>().address<Command const>();
+    uint32 uCount            = Interpreter::gpr<ABI::INT_REG_0>().uLong;
+    if (!poCommand && uCount) {
+        Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_NULL_PTR;
+        Interpreter::gpr<ABI::INT_REG_1>().uQuad = 0;
+        return Interpreter::RUNNING;
+    }
+
+    // A command may itself be a batch_exec. Refuse before loading anything rather than recurse without bound.
+    if (uDepth >= MAX_DEPTH) {
+        Interpreter::gpr<ABI::INT_REG_0>().uQuad = ERR_TOO_DEEP;
+        Interpreter::gpr<ABI::INT_REG_1>().uQuad = 0;
+        return Interpreter::RUNNING;
+    }
+    DepthGuard oGuard;
+
+    // Load destinations, in Load bit order
+    GPRegister* poGPR = Interpreter::gpr();
+    FPRegister* poFPR = Interpreter::fpr();
+    uint64* const apuLoad[] = {
+        &poGPR[ABI::INT_REG_0].uQuad,   &poGPR[ABI::INT_REG_1].uQuad,   &poGPR[ABI::INT_REG_2].uQuad,
+        &poGPR[ABI::PTR_REG_0].uQuad,   &poGPR[ABI::PTR_REG_1].uQuad,   &poGPR[ABI::PTR_REG_2].uQuad,
+        &poFPR[ABI::FLT_REG_0].uBinary, &poFPR[ABI::FLT_REG_1].uBinary, &poFPR[ABI::FLT_REG_2].uBinary
+    };
+
+    // A command that ran VM code (e.g. the display event loop) needs the caller to restore the program counter.
+    Interpreter::Status eResult = Interpreter::RUNNING;
+    for (uint32 u = 0; u < uCount; ++u) {
+        uint64 const* puValue = (uint64 const*)(poCommand + 1);
+        for (uint32 uLoad = poCommand->uLoad & LOAD_ALL, uBit = 0; uLoad; uLoad >>= 1, ++uBit) {
+            if (uLoad & 1) {
+                *apuLoad[uBit] = *puValue++;
+            }
+        }
+        Interpreter::Status eCallStatus = Interpreter::callHost(poCommand->uVector, poCommand->uFunction);
+        if (Interpreter::INITIALISED == eCallStatus) {
+            eResult = eCallStatus;
+        } else if (Interpreter::RUNNING != eCallStatus) {
+            return eCallStatus;
+        }
+        if ((poCommand->uFlags & STOP_ON_ERROR) && poGPR[ABI::INT_REG_0].uQuad) {
+            poGPR[ABI::INT_REG_1].uQuad = u;
+            return eResult;
+        }
+        poCommand = (Command const*)puValue;
+    }
+    poGPR[ABI::INT_REG_0].uQuad = ABI::ERR_NONE;
+    poGPR[ABI::INT_REG_1].uQuad = uCount;
+    return eResult;
+}
+
+/**
+ * VALIDATE
+ */
+void validate() {
+    Command const* poCommand = Interpreter::gpr<ABI::PTR_REG_0>().address<Command const>();
+    uint32 uCount            = Interpreter::gpr<ABI::INT_REG_0>().uLong;
+    uint32 uNumVectors       = instance.getNumHCFVectors();
+    Host::Definition::Library const* poLibraries = instance.getLibraries();
+    uint64 uResult           = ABI::ERR_NONE;
+    uint32 u                 = 0;
+    if (!poCommand && uCount) {
+        uResult = ABI::ERR_NULL_PTR;
+    } else {
+        for (; u < uCount; ++u) {
+            if (poCommand->uVector >= uNumVectors) {
+                uResult = ERR_BAD_VECTOR;
+                break;
+            }
+            if (poCommand->uFunction >= poLibraries[poCommand->uVector].uNumHostCalls) {
+                uResult = ERR_BAD_FUNCTION;
+                break;
+            }
+            if ((poCommand->uLoad & ~LOAD_ALL) || (poCommand->uFlags & ~FLAG_ALL) || poCommand->uReserved) {
+                uResult = ERR_BAD_COMMAND;
+                break;
+            }
+            poCommand = (Command const*)((uint64 const*)(poCommand + 1) + numValues(poCommand));
+        }
+    }
+    Interpreter::gpr<ABI::INT_REG_0>().uQuad = uResult;
+    Interpreter::gpr<ABI::INT_REG_1>().uQuad = u;
+}
+
+/**
+ * Builds the host call table
+ */
+constexpr ABI::HostCallTable<CALL_MAX> makeHostCalls() {
+    ABI::HostCallTable<CALL_MAX> acHostCalls = {};
+
+    acHostCalls[INIT]     = ABI::call<nop>;
+    acHostCalls[DONE]     = ABI::call<nop>;
+    acHostCalls[EXEC]     = exec;
+    acHostCalls[VALIDATE] = ABI::call<validate>;
+
+    return acHostCalls;
+}
+
+ABI::HostCallTable<CALL_MAX> const acHostCalls = makeHostCalls();
+
+/**
+ * Batch::hostVector(uint8 uFunctionID)
+ */
+Interpreter::Status hostVector(uint8 uFunctionID) {
+    if (uFunctionID < CALL_MAX && acHostCalls[uFunctionID]) {
+        return acHostCalls[uFunctionID]();
+    }
+    std::fprintf(stderr, "Unknown Batch operation %d\n", (int)uFunctionID);
+    return Interpreter::UNKNOWN_HOST_CALL;
+}
+
+} // namespace
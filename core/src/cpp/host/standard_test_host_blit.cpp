@@ -0,0 +1,413 @@
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <host/standard_test_host_blit.hpp>
+#include <host/display/context.hpp>
+#include <host/blit/kernels.hpp>
+
+using MC64K::Machine::Interpreter;
+
+namespace MC64K::StandardTestHost::Blit {
+
+using Host::Blit::Kernels;
+
+/**
+ * Size of a pixel in a supported format, zero for any other.
+ */
+inline uint32 pixelSize(uint32 uFormat) {
+    switch (uFormat) {
+        case Display::PXL_LUT_8:   return sizeof(uint8);
+        case Display::PXL_RGB_555: return sizeof(uint16);
+        case Display::PXL_ARGB_32: return sizeof(uint32);
+        default:
+            return 0;
+    }
+}
+
+/**
+ * The rows to process once clipped. The width is in pixels and the strides are in bytes.
+ */
+struct Area {
+    uint8*       puTarget;
+    uint8 const* puSource;
+    int64        iTargetStride;
+    int64        iSourceStride;
+    uint32       uWidth;
+    uint32       uHeight;
+};
+
+/**
+ * @inheritDoc
+ */
+uint64 view(Surface const* poSurface, View& oView) {
+    if (!poSurface || !poSurface->pPixels) {
+        return ABI::ERR_NULL_PTR;
+    }
+    oView.uFormat    = poSurface->uFormat;
+    oView.uPixelSize = pixelSize(oView.uFormat);
+    if (!oView.uPixelSize) {
+        return ERR_BAD_FORMAT;
+    }
+    uint64 uRowSize = (uint64)poSurface->uWidth * oView.uPixelSize;
+    oView.uStride   = poSurface->uStride ? poSurface->uStride : uRowSize;
+    if (oView.uStride < uRowSize || oView.uStride % oView.uPixelSize) {
+        return ERR_BAD_SURFACE;
+    }
+    oView.puPixels = (uint8*)poSurface->pPixels;
+    oView.iWidth   = poSurface->uWidth;
+    oView.iHeight  = poSurface->uHeight;
+    return ABI::ERR_NONE;
+}
+
+/**
+ * Clip a rectangle of the source, placed at iX, iY in the target, against both. Returns false if nothing is left.
+ */
+bool clip(View const& oSource, View const& oTarget, Rect const* poRect, int64 iX, int64 iY, Area& oArea) {
+    int64 iSourceX = 0;
+    int64 iSourceY = 0;
+    int64 iWidth   = oSource.iWidth;
+    int64 iHeight  = oSource.iHeight;
+    if (poRect) {
+        iSourceX = poRect->iX;
+        iSourceY = poRect->iY;
+        iWidth   = poRect->uWidth;
+        iHeight  = poRect->uHeight;
+    }
+
+    // Left and top edges of the source, then of the target
+    if (iSourceX < 0) {
+        iWidth += iSourceX;
+        iX     -= iSourceX;
+        iSourceX = 0;
+    }
+    if (iSourceY < 0) {
+        iHeight += iSourceY;
+        iY      -= iSourceY;
+        iSourceY = 0;
+    }
+    if (iX < 0) {
+        iWidth   += iX;
+        iSourceX -= iX;
+        iX = 0;
+    }
+    if (iY < 0) {
+        iHeight  += iY;
+        iSourceY -= iY;
+        iY = 0;
+    }
+
+    // Right and bottom edges of both
+    iWidth  = std::min({iWidth,  oSource.iWidth  - iSourceX, oTarget.iWidth  - iX});
+    iHeight = std::min({iHeight, oSource.iHeight - iSourceY, oTarget.iHeight - iY});
+    if (iWidth <= 0 || iHeight <= 0) {
+        return false;
+    }
+    oArea.puSource      = oSource.puPixels + (uint64)iSourceY * oSource.uStride + (uint64)iSourceX * oSource.uPixelSize;
+    oArea.puTarget      = oTarget.puPixels + (uint64)iY * oTarget.uStride + (uint64)iX * oTarget.uPixelSize;
+    oArea.iSourceStride = (int64)oSource.uStride;
+    oArea.iTargetStride = (int64)oTarget.uStride;
+    oArea.uWidth        = (uint32)iWidth;
+    oArea.uHeight       = (uint32)iHeight;
+    return true;
+}
+
+/**
+ * Apply a row function to every row of the area, in pixels of the given types
+ */
+template<typename T, typename S, typename F>
+inline void eachRow(Area const& oArea, F cRow) {
+    uint8*       puTarget = oArea.puTarget;
+    uint8 const* puSource = oArea.puSource;
+    for (uint32 u = 0; u < oArea.uHeight; ++u) {
+        cRow((T*)puTarget, (S const*)puSource, oArea.uWidth);
+        puTarget += oArea.iTargetStride;
+        puSource += oArea.iSourceStride;
+    }
+}
+
+/**
+ * Shared entry checks of the surface to surface operations. The target format must match the source unless bMatch is
+ * false.
+ */
+uint64 prepare(
+    Surface const* poSource,
+    Surface const* poTarget,
+    Rect const*    poRect,
+    int32          iX,
+    int32          iY,
+    bool           bMatch,
+    View&          oSource,
+    View&          oTarget,
+    Area&          oArea,
+    bool&          bAny
+) {
+    uint64 uResult;
+    if (
+        ABI::ERR_NONE != (uResult = view(poSource, oSource)) ||
+        ABI::ERR_NONE != (uResult = view(poTarget, oTarget))
+    ) {
+        return uResult;
+    }
+    if (bMatch && oSource.uFormat != oTarget.uFormat) {
+        return ERR_BAD_FORMAT;
+    }
+    bAny = clip(oSource, oTarget, poRect, iX, iY, oArea);
+    return ABI::ERR_NONE;
+}
+
+/**
+ * No operation
+ */
+void nop() {
+}
+
+/**
+ * DISPLAY_SURFACE
+ */
+uint64 displaySurface(Display::Context const* poContext, Surface* poSurface) {
+    if (!poContext || !poSurface) {
+        return ABI::ERR_NULL_PTR;
+    }
+    uint32 uPixelSize = pixelSize(poContext->uPixelFormat);
+    poSurface->pPixels = poContext->oDisplayBuffer.puAny;
+    poSurface->pRemap  = nullptr;
+    poSurface->uWidth  = poContext->uBufferWidth;
+    poSurface->uHeight = poContext->uBufferHeight;
+    poSurface->uStride = poContext->uBufferWidth * (uPixelSize ? uPixelSize : (uint32)sizeof(uint8));
+    poSurface->uFormat = poContext->uPixelFormat;
+    return ABI::ERR_NONE;
+}
+
+/**
+ * FILL
+ */
+uint64 fill(Surface const* poTarget, Rect const* poRect, uint32 uPixel) {
+    View   oTarget;
+    Area   oArea;
+    uint64 uResult = view(poTarget, oTarget);
+    if (ABI::ERR_NONE != uResult) {
+        return uResult;
+    }
+    // Clipping the target against itself, at the position of the rectangle, places the rectangle in it
+    if (!clip(oTarget, oTarget, poRect, poRect ? poRect->iX : 0, poRect ? poRect->iY : 0, oArea)) {
+        return ABI::ERR_NONE;
+    }
+    switch (oTarget.uPixelSize) {
+        case sizeof(uint8): {
+            auto cFill = Kernels<uint8>::get().cFill;
+            eachRow<uint8, uint8>(oArea, [=](uint8* puRow, uint8 const*, uint32 uCount) {
+                cFill(puRow, (uint8)uPixel, uCount);
+            });
+            break;
+        }
+        case sizeof(uint16): {
+            auto cFill = Kernels<uint16>::get().cFill;
+            eachRow<uint16, uint8>(oArea, [=](uint16* puRow, uint8 const*, uint32 uCount) {
+                cFill(puRow, (uint16)uPixel, uCount);
+            });
+            break;
+        }
+        default: {
+            auto cFill = Kernels<uint32>::get().cFill;
+            eachRow<uint32, uint8>(oArea, [=](uint32* puRow, uint8 const*, uint32 uCount) {
+                cFill(puRow, uPixel, uCount);
+            });
+            break;
+        }
+    }
+    return ABI::ERR_NONE;
+}
+
+/**
+ * COPY
+ */
+uint64 copy(Surface const* poSource, Surface const* poTarget, Rect const* poRect, int32 iX, int32 iY) {
+    View   oSource, oTarget;
+    Area   oArea;
+    bool   bAny    = false;
+    uint64 uResult = prepare(poSource, poTarget, poRect, iX, iY, true, oSource, oTarget, oArea, bAny);
+    if (ABI::ERR_NONE != uResult || !bAny) {
+        return uResult;
+    }
+    uint64 uRowSize = (uint64)oArea.uWidth * oSource.uPixelSize;
+
+    // Whole rows of gapless surfaces are a single block
+    if ((int64)uRowSize == oArea.iSourceStride && (int64)uRowSize == oArea.iTargetStride) {
+        std::memmove(oArea.puTarget, oArea.puSource, uRowSize * oArea.uHeight);
+        return ABI::ERR_NONE;
+    }
+
+    // Work from the bottom up when the target follows the source, so that overlapping rows are read first
+    if (oArea.puTarget > oArea.puSource) {
+        int64 iLast = oArea.uHeight - 1;
+        oArea.puTarget += iLast * oArea.iTargetStride;
+        oArea.puSource += iLast * oArea.iSourceStride;
+        oArea.iTargetStride = -oArea.iTargetStride;
+        oArea.iSourceStride = -oArea.iSourceStride;
+    }
+    eachRow<uint8, uint8>(oArea, [=](uint8* puTarget, uint8 const* puSource, uint32) {
+        std::memmove(puTarget, puSource, uRowSize);
+    });
+    return ABI::ERR_NONE;
+}
+
+/**
+ * COPY_KEY
+ */
+uint64 copyKey(Surface const* poSource, Surface const* poTarget, Rect const* poRect, int32 iX, int32 iY, uint32 uKey) {
+    View   oSource, oTarget;
+    Area   oArea;
+    bool   bAny    = false;
+    uint64 uResult = prepare(poSource, poTarget, poRect, iX, iY, true, oSource, oTarget, oArea, bAny);
+    if (ABI::ERR_NONE != uResult || !bAny) {
+        return uResult;
+    }
+    switch (oSource.uPixelSize) {
+        case sizeof(uint8): {
+            auto cCopyKey = Kernels<uint8>::get().cCopyKey;
+            eachRow<uint8, uint8>(oArea, [=](uint8* puTarget, uint8 const* puSource, uint32 uCount) {
+                cCopyKey(puTarget, puSource, uCount, (uint8)uKey);
+            });
+            break;
+        }
+        case sizeof(uint16): {
+            auto cCopyKey = Kernels<uint16>::get().cCopyKey;
+            eachRow<uint16, uint16>(oArea, [=](uint16* puTarget, uint16 const* puSource, uint32 uCount) {
+                cCopyKey(puTarget, puSource, uCount, (uint16)uKey);
+            });
+            break;
+        }
+        default: {
+            auto cCopyKey = Kernels<uint32>::get().cCopyKey;
+            eachRow<uint32, uint32>(oArea, [=](uint32* puTarget, uint32 const* puSource, uint32 uCount) {
+                cCopyKey(puTarget, puSource, uCount, uKey);
+            });
+            break;
+        }
+    }
+    return ABI::ERR_NONE;
+}
+
+/**
+ * COPY_REMAP
+ */
+uint64 copyRemap(Surface const* poSource, Surface const* poTarget, Rect const* poRect, int32 iX, int32 iY) {
+    View   oSource, oTarget;
+    Area   oArea;
+    bool   bAny    = false;
+    uint64 uResult = prepare(poSource, poTarget, poRect, iX, iY, false, oSource, oTarget, oArea, bAny);
+    if (ABI::ERR_NONE != uResult) {
+        return uResult;
+    }
+    if (Display::PXL_LUT_8 != oSource.uFormat) {
+        return ERR_BAD_FORMAT;
+    }
+    void const* pTable = poSource->pRemap;
+    if (!pTable) {
+        return ABI::ERR_NULL_PTR;
+    }
+    if (!bAny) {
+        return ABI::ERR_NONE;
+    }
+    switch (oTarget.uPixelSize) {
+        case sizeof(uint8): {
+            auto cRemap = Kernels<uint8>::get().cRemap;
+            eachRow<uint8, uint8>(oArea, [=](uint8* puTarget, uint8 const* puSource, uint32 uCount) {
+                cRemap(puTarget, puSource, uCount, (uint8 const*)pTable);
+            });
+            break;
+        }
+        case sizeof(uint16): {
+            auto cRemap = Kernels<uint16>::get().cRemap;
+            eachRow<uint16, uint8>(oArea, [=](uint16* puTarget, uint8 const* puSource, uint32 uCount) {
+                cRemap(puTarget, puSource, uCount, (uint16 const*)pTable);
+            });
+            break;
+        }
+        default: {
+            auto cRemap = Kernels<uint32>::get().cRemap;
+            eachRow<uint32, uint8>(oArea, [=](uint32* puTarget, uint8 const* puSource, uint32 uCount) {
+                cRemap(puTarget, puSource, uCount, (uint32 const*)pTable);
+            });
+            break;
+        }
+    }
+    return ABI::ERR_NONE;
+}
+
+/**
+ * BLEND
+ */
+uint64 blend(Surface const* poSource, Surface const* poTarget, Rect const* poRect, int32 iX, int32 iY, uint32 uAlpha) {
+    View   oSource, oTarget;
+    Area   oArea;
+    bool   bAny    = false;
+    uint64 uResult = prepare(poSource, poTarget, poRect, iX, iY, true, oSource, oTarget, oArea, bAny);
+    if (ABI::ERR_NONE != uResult) {
+        return uResult;
+    }
+    if (Display::PXL_LUT_8 == oSource.uFormat) {
+        return ERR_BAD_FORMAT;
+    }
+    if (!bAny) {
+        return ABI::ERR_NONE;
+    }
+    uAlpha = std::min(uAlpha, 255U);
+    if (sizeof(uint16) == oSource.uPixelSize) {
+        auto cBlend = Kernels<uint16>::get().cBlend;
+        eachRow<uint16, uint16>(oArea, [=](uint16* puTarget, uint16 const* puSource, uint32 uCount) {
+            cBlend(puTarget, puSource, uCount, uAlpha);
+        });
+    } else {
+        auto cBlend = Kernels<uint32>::get().cBlend;
+        eachRow<uint32, uint32>(oArea, [=](uint32* puTarget, uint32 const* puSource, uint32 uCount) {
+            cBlend(puTarget, puSource, uCount, uAlpha);
+        });
+    }
+    return ABI::ERR_NONE;
+}
+
+/**
+ * Builds the host call table
+ */
+constexpr ABI::HostCallTable<CALL_MAX> makeHostCalls() {
+    ABI::HostCallTable<CALL_MAX> acHostCalls = {};
+
+    acHostCalls[INIT]            = ABI::call<nop>;
+    acHostCalls[DONE]            = ABI::call<nop>;
+    acHostCalls[DISPLAY_SURFACE] = ABI::call<displaySurface>;
+    acHostCalls[FILL]            = ABI::call<fill>;
+    acHostCalls[COPY]            = ABI::call<copy>;
+    acHostCalls[COPY_KEY]        = ABI::call<copyKey>;
+    acHostCalls[COPY_REMAP]      = ABI::call<copyRemap>;
+    acHostCalls[BLEND]           = ABI::call<blend>;
+
+    return acHostCalls;
+}
+
+ABI::HostCallTable<CALL_MAX> const acHostCalls = makeHostCalls();
+
+/**
+ * Blit::hostVector(uint8 uFunctionID)
+ */
+Interpreter::Status hostVector(uint8 uFunctionID) {
+    if (uFunctionID < CALL_MAX && acHostCalls[uFunctionID]) {
+        return acHostCalls[uFunctionID]();
+    }
+    std::fprintf(stderr, "Unknown Blit operation %d\n", (int)uFunctionID);
+    return Interpreter::UNKNOWN_HOST_CALL;
+}
+
+} // namespace
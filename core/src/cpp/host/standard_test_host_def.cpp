@@ -20,6 +20,11 @@
 #include <host/standard_test_host_vector_math.hpp>
 #include <host/standard_test_host_display.hpp>
 #include <host/standard_test_host_audio.hpp>
+#include <host/standard_test_host_batch.hpp>
+#include <host/standard_test_host_blit.hpp>
+#include <host/standard_test_host_raster.hpp>
+#include <host/standard_test_host_sort.hpp>
+#include <host/standard_test_host_unpack.hpp>
 #include <loader/symbol.hpp>
 #include <machine/register.hpp>
 
@@ -51,13 +56,18 @@ Host::Definition instance(
     sHostInfo,
     Version(1, 0, 0),
 
-    // Host ABI Vectors
+    // Host libraries, in ABI vector order. The names are the dependency names binaries use to declare them.
     {
-        IO::hostVector,
-        Mem::hostVector,
-        VectorMath::hostVector,
-        Display::hostVector,
-        Audio::hostVector
+        { "host/io",          IO::hostVector,         0,                0,                IO::acHostCalls.data(),         IO::CALL_MAX         },
+        { "host/mem",         Mem::hostVector,        Mem::initLibrary, Mem::doneLibrary, Mem::acHostCalls.data(),        Mem::CALL_MAX        },
+        { "host/vector_math", VectorMath::hostVector, 0,                0,                VectorMath::acHostCalls.data(), VectorMath::CALL_MAX },
+        { "host/display",     Display::hostVector,    0,                0,                Display::acHostCalls.data(),    Display::CALL_MAX    },
+        { "host/audio",       Audio::hostVector,      0,                0,                Audio::acHostCalls.data(),      Audio::CALL_MAX      },
+        { "host/batch",       Batch::hostVector,      0,                0,                Batch::acHostCalls.data(),      Batch::CALL_MAX      },
+        { "host/blit",        Blit::hostVector,       0,                0,                Blit::acHostCalls.data(),       Blit::CALL_MAX       },
+        { "host/raster",      Raster::hostVector,     0,                0,                Raster::acHostCalls.data(),     Raster::CALL_MAX     },
+        { "host/sort",        Sort::hostVector,       0,                0,                Sort::acHostCalls.data(),       Sort::CALL_MAX       },
+        { "host/unpack",      Unpack::hostVector,     0,                0,                Unpack::acHostCalls.data(),     Unpack::CALL_MAX     }
     },
 
     // Symbols this host exports to the virtual code.
@@ -140,29 +140,39 @@ void closeDisplay() {
     }
 }
 
+/**
+ * No operation
+ */
+void nop() {
+}
+
+/**
+ * Builds the host call table. BEGIN runs VM code from the event loop, so it returns its own status.
+ */
+constexpr ABI::HostCallTable<CALL_MAX> makeHostCalls() {
+    ABI::HostCallTable<CALL_MAX> acHostCalls = {};
+
+    acHostCalls[INIT]   = ABI::call<nop>;
+    acHostCalls[DONE]   = ABI::call<nop>;
+    acHostCalls[OPEN]   = ABI::call<openDisplay>;
+    acHostCalls[CLOSE]  = ABI::call<closeDisplay>;
+    acHostCalls[BEGIN]  = runEventLoop;
+    acHostCalls[UPDATE] = ABI::call<updateDisplay>;
+
+    return acHostCalls;
+}
+
+ABI::HostCallTable<CALL_MAX> const acHostCalls = makeHostCalls();
+
 /**
  * Display::hostVector(uint8 uFunctionID)
  */
 Interpreter::Status hostVector(uint8 uFunctionID) {
-    Call iOperation = (Call) uFunctionID;
-    switch (iOperation) {
-        case INIT:
-        case DONE:
-            break;
-        case OPEN:  openDisplay();  break;
-        case CLOSE: closeDisplay(); break;
-        case BEGIN:
-            return runEventLoop();
-            break;
-        case UPDATE: updateDisplay(); break;
-        default:
-            std::fprintf(stderr, "Unknown Display operation %d\n", iOperation);
-            return Interpreter::UNKNOWN_HOST_CALL;
-            break;
+    if (uFunctionID < CALL_MAX && acHostCalls[uFunctionID]) {
+        return acHostCalls[uFunctionID]();
     }
-
-    return Interpreter::RUNNING;
+    std::fprintf(stderr, "Unknown Display operation %d\n", (int)uFunctionID);
+    return Interpreter::UNKNOWN_HOST_CALL;
 }
 
 } // namespace
-
@@ -21,6 +21,7 @@
 #include <host/display/context.hpp>
 #include <machine/register.hpp>
 #include <machine/timing.hpp>
+#include <host/runtime.hpp>
 
 #include <host/display/x11/device.hpp>
 
@@ -181,6 +182,9 @@ void Device::runEventLoop() {
             break;
         }
 
+        // Frame boundary: If the binary was reloaded, the handlers are remapped to the new code here.
+        Host::Runtime::frameBoundary(oContext.apVMCall, CALL_MAX);
+
         // Check for changes to the handlers.
         long iNewXInputFlags = configureInputMask();
         if (iNewXInputFlags != iCurrentXInputFlags) {
@@ -14,6 +14,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <host/memory.hpp>
 #include <host/standard_test_host_mem.hpp>
 #include <host/standard_test_host_display.hpp>
 #include <host/display/context.hpp>
@@ -67,7 +68,7 @@ void Context::allocateBuffer() {
             uTotalAlloc = uNumBufferBytes + (uNumViewPixels + 256) * sizeof(Format::ARGB32::Pixel);
 
             oDisplayBuffer.puByte =
-            puData                = new uint8[uTotalAlloc];
+            puData                = (uint8*)Host::Memory::Arena::allocate(uTotalAlloc);
             oPaletteData.puLong   = (Format::ARGB32::Pixel*)(puData + uNumBufferBytes);
             puImageBuffer         = (Format::LUT8::Pixel*)(oPaletteData.puLong + 256);
             break;
@@ -81,7 +82,7 @@ void Context::allocateBuffer() {
             uTotalAlloc = uNumBufferBytes + (uNumViewPixels + 32) * sizeof(Format::RGB555::Pixel);
 
             oDisplayBuffer.puByte =
-            puData                = new uint8[uTotalAlloc];
+            puData                = (uint8*)Host::Memory::Arena::allocate(uTotalAlloc);
             oPaletteData.puWord   = (Format::RGB555::Pixel*)(puData + uNumBufferBytes);
             puImageBuffer         = (Format::LUT8::Pixel*)(oPaletteData.puWord + 32);
             break;
@@ -99,7 +100,7 @@ void Context::allocateBuffer() {
             uTotalAlloc = uNumBufferBytes + uNumViewPixels * uPixelSize;
 
             oPaletteData.puAny    = nullptr;
-            oDisplayBuffer.puByte = puData = new uint8[uTotalAlloc];
+            oDisplayBuffer.puByte = puData = (uint8*)Host::Memory::Arena::allocate(uTotalAlloc);
             puImageBuffer         = puData + uNumBufferBytes;
             break;
 		}
@@ -109,6 +110,9 @@ void Context::allocateBuffer() {
             break;
         }
     }
+    if (!puData) {
+        throw Error();
+    }
     std::fprintf(
         stderr,
         "X11Context RAII: Allocated Pixel Buffer %d x %d x %d at %p, total allocation is %u bytes\n",
@@ -199,7 +199,7 @@ void tellStream() {
     }
 }
 
-void print() {
+void printString() {
     if (char const* pText = Interpreter::gpr<ABI::PTR_REG_0>().sString) {
         Interpreter::gpr<ABI::INT_REG_0>().uQuad = getIOWriteResult(
             std::fputs(pText, stdout)
@@ -209,7 +209,7 @@ void print() {
     }
 }
 
-void filePrint() {
+void filePrintString() {
     std::FILE*  pStream = Interpreter::gpr<ABI::PTR_REG_0>().address<std::FILE>();
     char const* pText   = Interpreter::gpr<ABI::PTR_REG_1>().sString;
     if (pStream && pText) {
@@ -221,68 +221,112 @@ void filePrint() {
     }
 }
 
+/**
+ * Bind the sized operations to the active format for their size
+ */
+template<typename T, char const*& rsFormat>
+void printSized() {
+    print<T>(rsFormat);
+}
+
+template<typename T, char const*& rsFormat>
+void filePrintSized() {
+    filePrint<T>(rsFormat);
+}
+
+template<typename T, char const*& rsFormat>
+void fileParseSized() {
+    fileParse<T>(rsFormat);
+}
+
+template<typename T, char const*& rsFormat>
+void formatSized() {
+    format<T>(rsFormat);
+}
+
+template<typename T, char const*& rsFormat>
+void parseSized() {
+    parse<T>(rsFormat);
+}
+
+template<char const*& rsFormat, char const*& rsDefaultFormat>
+void setSizedFormat() {
+    setFormat(rsFormat, rsDefaultFormat);
+}
+
+/**
+ * No operation
+ */
+void nop() {
+}
+
+/**
+ * Builds the host call table
+ */
+constexpr ABI::HostCallTable<CALL_MAX> makeHostCalls() {
+    ABI::HostCallTable<CALL_MAX> acHostCalls = {};
+
+    acHostCalls[INIT]               = ABI::call<nop>;
+    acHostCalls[DONE]               = ABI::call<nop>;
+    acHostCalls[PRINT_STRING]       = ABI::call<printString>;
+    acHostCalls[PRINT_BYTE]         = ABI::call<printSized<int8, sByteFormat>>;
+    acHostCalls[PRINT_WORD]         = ABI::call<printSized<int16, sWordFormat>>;
+    acHostCalls[PRINT_LONG]         = ABI::call<printSized<int32, sLongFormat>>;
+    acHostCalls[PRINT_QUAD]         = ABI::call<printSized<int64, sQuadFormat>>;
+    acHostCalls[PRINT_SINGLE]       = ABI::call<printSized<float32, sSingleFormat>>;
+    acHostCalls[PRINT_DOUBLE]       = ABI::call<printSized<float64, sDoubleFormat>>;
+    acHostCalls[SET_FMT_BYTE]       = ABI::call<setSizedFormat<sByteFormat, sDefaultByteFormat>>;
+    acHostCalls[SET_FMT_WORD]       = ABI::call<setSizedFormat<sWordFormat, sDefaultWordFormat>>;
+    acHostCalls[SET_FMT_LONG]       = ABI::call<setSizedFormat<sLongFormat, sDefaultLongFormat>>;
+    acHostCalls[SET_FMT_QUAD]       = ABI::call<setSizedFormat<sQuadFormat, sDefaultQuadFormat>>;
+    acHostCalls[SET_FMT_SINGLE]     = ABI::call<setSizedFormat<sSingleFormat, sDefaultSingleFormat>>;
+    acHostCalls[SET_FMT_DOUBLE]     = ABI::call<setSizedFormat<sDoubleFormat, sDefaultDoubleFormat>>;
+    acHostCalls[FILE_OPEN]          = ABI::call<openStream>;
+    acHostCalls[FILE_SEEK]          = ABI::call<seekStream>;
+    acHostCalls[FILE_TELL]          = ABI::call<tellStream>;
+    acHostCalls[FILE_READ]          = ABI::call<readStream>;
+    acHostCalls[FILE_WRITE]         = ABI::call<writeStream>;
+    acHostCalls[FILE_CLOSE]         = ABI::call<closeStream>;
+    acHostCalls[FILE_PRINT_STRING]  = ABI::call<filePrintString>;
+    acHostCalls[FILE_PRINT_BYTE]    = ABI::call<filePrintSized<int8, sByteFormat>>;
+    acHostCalls[FILE_PRINT_WORD]    = ABI::call<filePrintSized<int16, sWordFormat>>;
+    acHostCalls[FILE_PRINT_LONG]    = ABI::call<filePrintSized<int32, sLongFormat>>;
+    acHostCalls[FILE_PRINT_QUAD]    = ABI::call<filePrintSized<int64, sQuadFormat>>;
+    acHostCalls[FILE_PRINT_SINGLE]  = ABI::call<filePrintSized<float32, sSingleFormat>>;
+    acHostCalls[FILE_PRINT_DOUBLE]  = ABI::call<filePrintSized<float64, sDoubleFormat>>;
+    acHostCalls[FILE_PARSE_BYTE]    = ABI::call<fileParseSized<int8, sByteFormat>>;
+    acHostCalls[FILE_PARSE_WORD]    = ABI::call<fileParseSized<int16, sWordFormat>>;
+    acHostCalls[FILE_PARSE_LONG]    = ABI::call<fileParseSized<int32, sLongFormat>>;
+    acHostCalls[FILE_PARSE_QUAD]    = ABI::call<fileParseSized<int64, sQuadFormat>>;
+    acHostCalls[FILE_PARSE_SINGLE]  = ABI::call<fileParseSized<float32, sSingleFormat>>;
+    acHostCalls[FILE_PARSE_DOUBLE]  = ABI::call<fileParseSized<float64, sDoubleFormat>>;
+    acHostCalls[CBUF_FORMAT_BYTE]   = ABI::call<formatSized<int8, sByteFormat>>;
+    acHostCalls[CBUF_FORMAT_WORD]   = ABI::call<formatSized<int16, sWordFormat>>;
+    acHostCalls[CBUF_FORMAT_LONG]   = ABI::call<formatSized<int32, sLongFormat>>;
+    acHostCalls[CBUF_FORMAT_QUAD]   = ABI::call<formatSized<int64, sQuadFormat>>;
+    acHostCalls[CBUF_FORMAT_SINGLE] = ABI::call<formatSized<float32, sSingleFormat>>;
+    acHostCalls[CBUF_FORMAT_DOUBLE] = ABI::call<formatSized<float64, sDoubleFormat>>;
+    acHostCalls[CBUF_PARSE_BYTE]    = ABI::call<parseSized<int8, sByteFormat>>;
+    acHostCalls[CBUF_PARSE_WORD]    = ABI::call<parseSized<int16, sWordFormat>>;
+    acHostCalls[CBUF_PARSE_LONG]    = ABI::call<parseSized<int32, sLongFormat>>;
+    acHostCalls[CBUF_PARSE_QUAD]    = ABI::call<parseSized<int64, sQuadFormat>>;
+    acHostCalls[CBUF_PARSE_SINGLE]  = ABI::call<parseSized<float32, sSingleFormat>>;
+    acHostCalls[CBUF_PARSE_DOUBLE]  = ABI::call<parseSized<float64, sDoubleFormat>>;
+
+    return acHostCalls;
+}
+
+ABI::HostCallTable<CALL_MAX> const acHostCalls = makeHostCalls();
+
 /**
  * IO::hostVector(uint8 uFunctionID)
  */
 Interpreter::Status hostVector(uint8 uFunctionID) {
-    Call iOperation = (Call) uFunctionID;
-    switch (iOperation) {
-        case INIT:
-        case DONE:
-            break;
-
-        case PRINT_STRING:       print();                                        break;
-        case PRINT_BYTE:         print<int8>(sByteFormat);                       break;
-        case PRINT_WORD:         print<int16>(sWordFormat);                      break;
-        case PRINT_LONG:         print<int32>(sLongFormat);                      break;
-        case PRINT_QUAD:         print<int64>(sQuadFormat);                      break;
-        case PRINT_SINGLE:       print<float32>(sSingleFormat);                  break;
-        case PRINT_DOUBLE:       print<float64>(sDoubleFormat);                  break;
-        case SET_FMT_BYTE:       setFormat(sByteFormat, sDefaultByteFormat);     break;
-        case SET_FMT_WORD:       setFormat(sWordFormat, sDefaultWordFormat);     break;
-        case SET_FMT_LONG:       setFormat(sLongFormat, sDefaultLongFormat);     break;
-        case SET_FMT_QUAD:       setFormat(sQuadFormat, sDefaultQuadFormat);     break;
-        case SET_FMT_SINGLE:     setFormat(sSingleFormat, sDefaultSingleFormat); break;
-        case SET_FMT_DOUBLE:     setFormat(sDoubleFormat, sDefaultDoubleFormat); break;
-        case FILE_OPEN:          openStream();                                   break;
-        case FILE_SEEK:          seekStream();                                   break;
-        case FILE_TELL:          tellStream();                                   break;
-        case FILE_READ:          readStream();                                   break;
-        case FILE_WRITE:         writeStream();                                  break;
-        case FILE_CLOSE:         closeStream();                                  break;
-        case FILE_PRINT_STRING:  filePrint();                                    break;
-        case FILE_PRINT_BYTE:    filePrint<int8>(sByteFormat);                   break;
-        case FILE_PRINT_WORD:    filePrint<int16>(sWordFormat);                  break;
-        case FILE_PRINT_LONG:    filePrint<int32>(sLongFormat);                  break;
-        case FILE_PRINT_QUAD:    filePrint<int64>(sQuadFormat);                  break;
-        case FILE_PRINT_SINGLE:  filePrint<float32>(sSingleFormat);              break;
-        case FILE_PRINT_DOUBLE:  filePrint<float64>(sDoubleFormat);              break;
-        case FILE_PARSE_BYTE:    fileParse<int8>(sByteFormat);                   break;
-        case FILE_PARSE_WORD:    fileParse<int16>(sWordFormat);                  break;
-        case FILE_PARSE_LONG:    fileParse<int32>(sLongFormat);                  break;
-        case FILE_PARSE_QUAD:    fileParse<int64>(sQuadFormat);                  break;
-        case FILE_PARSE_SINGLE:  fileParse<float32>(sSingleFormat);              break;
-        case FILE_PARSE_DOUBLE:  fileParse<float64>(sDoubleFormat);              break;
-        case CBUF_FORMAT_BYTE:   format<int8>(sByteFormat);                      break;
-        case CBUF_FORMAT_WORD:   format<int16>(sWordFormat);                     break;
-        case CBUF_FORMAT_LONG:   format<int32>(sLongFormat);                     break;
-        case CBUF_FORMAT_QUAD:   format<int64>(sQuadFormat);                     break;
-        case CBUF_FORMAT_SINGLE: format<float32>(sSingleFormat);                 break;
-        case CBUF_FORMAT_DOUBLE: format<float64>(sDoubleFormat);                 break;
-        case CBUF_PARSE_BYTE:    parse<int8>(sByteFormat);                       break;
-        case CBUF_PARSE_WORD:    parse<int16>(sWordFormat);                      break;
-        case CBUF_PARSE_LONG:    parse<int32>(sLongFormat);                      break;
-        case CBUF_PARSE_QUAD:    parse<int64>(sQuadFormat);                      break;
-        case CBUF_PARSE_SINGLE:  parse<float32>(sSingleFormat);                  break;
-        case CBUF_PARSE_DOUBLE:  parse<float64>(sDoubleFormat);                  break;
-
-        default:
-            std::fprintf(stderr, "Unknown IO operation %d\n", iOperation);
-            return Interpreter::UNKNOWN_HOST_CALL;
-            break;
+    if (uFunctionID < CALL_MAX && acHostCalls[uFunctionID]) {
+        return acHostCalls[uFunctionID]();
     }
-
-    return Interpreter::RUNNING;
+    std::fprintf(stderr, "Unknown IO operation %d\n", (int)uFunctionID);
+    return Interpreter::UNKNOWN_HOST_CALL;
 }
 
 } // namespace
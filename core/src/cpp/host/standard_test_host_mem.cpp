@@ -17,177 +17,331 @@
 #include <host/standard_test_host_mem.hpp>
 #include <machine/register.hpp>
 #include <host/mem/inline.hpp>
+#include <host/slab.hpp>
+#include <host/frame_arena.hpp>
 
 using MC64K::Machine::Interpreter;
 
 using MC64K::Host::Memory::ElementBuffer;
+using MC64K::Host::Memory::FrameArena;
 
 namespace MC64K::StandardTestHost::Mem {
 
 /**
- * Mem::hostVector(uint8 uFunctionID)
+ * Allocator for ALLOC/FREE, created when the runtime initialises the library
  */
-Interpreter::Status hostVector(uint8 uFunctionID) {
-    Call iOperation = (Call) uFunctionID;
-    switch (iOperation) {
-        case INIT:
-        case DONE:
-            break;
-
-        case ALLOC:
-            if (uint64 uSize  = Interpreter::gpr<ABI::INT_REG_0>().uQuad) {
-                void* pBuffer = std::malloc(uSize);
-                Interpreter::gpr<ABI::PTR_REG_0>().pAny  = pBuffer;
-                Interpreter::gpr<ABI::INT_REG_0>().uQuad = pBuffer ?
-                    (uint64)ABI::ERR_NONE :
-                    (uint64)ERR_NO_MEM;
-            } else {
-                Interpreter::gpr<ABI::PTR_REG_0>().pAny  = 0;
-                Interpreter::gpr<ABI::INT_REG_0>().uQuad = ERR_MEM;
-            }
-            break;
-
-        case FREE:
-            std::free(Interpreter::gpr<ABI::PTR_REG_0>().pAny);
-            Interpreter::gpr<ABI::PTR_REG_0>().pAny = 0;
-            break;
-
-        case ALLOC_BUFFER: {
-            uint32 uParams = Interpreter::gpr<ABI::INT_REG_0>().uLong;
-            ElementBuffer* pBuffer = ElementBuffer::allocateBuffer(
-                (uint16)(uParams >> 16),
-                (uint16)(uParams & 0xFFFF)
-            );
-            Interpreter::gpr<ABI::PTR_REG_0>().pAny  = pBuffer;
-            Interpreter::gpr<ABI::INT_REG_0>().uQuad = pBuffer ?
+Host::Memory::Slab* poHeap = nullptr;
+
+/**
+ * @inheritDoc
+ */
+void initLibrary() {
+    if (!poHeap) {
+        poHeap = new Host::Memory::Slab();
+    }
+}
+
+/**
+ * @inheritDoc
+ */
+void doneLibrary() {
+    if (poHeap) {
+        poHeap->report("Mem");
+        delete poHeap;
+        poHeap = nullptr;
+    }
+}
+
+/**
+ * No operation
+ */
+void nop() {
+}
+
+/**
+ * ALLOC
+ */
+void alloc() {
+    if (uint64 uSize  = Interpreter::gpr<ABI::INT_REG_0>().uQuad) {
+        void* pBuffer = poHeap->allocate(uSize);
+        Interpreter::gpr<ABI::PTR_REG_0>().pAny  = pBuffer;
+        Interpreter::gpr<ABI::INT_REG_0>().uQuad = pBuffer ?
+            (uint64)ABI::ERR_NONE :
+            (uint64)ERR_NO_MEM;
+    } else {
+        Interpreter::gpr<ABI::PTR_REG_0>().pAny  = 0;
+        Interpreter::gpr<ABI::INT_REG_0>().uQuad = ERR_MEM;
+    }
+}
+
+/**
+ * FREE
+ */
+void release() {
+    void* pBuffer = Interpreter::gpr<ABI::PTR_REG_0>().pAny;
+    Interpreter::gpr<ABI::PTR_REG_0>().pAny = 0;
+    if (poHeap->release(pBuffer)) {
+        Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_NONE;
+    } else {
+        std::fprintf(stderr, "Mem: Ignoring free of invalid block %p\n", pBuffer);
+        Interpreter::gpr<ABI::INT_REG_0>().uQuad = ERR_MEM_INVALID_BLOCK;
+    }
+}
+
+/**
+ * FREE_ALL
+ */
+uint64 releaseAll() {
+    poHeap->reset();
+    return ABI::ERR_NONE;
+}
+
+/**
+ * Map a FrameArena result to a Mem error
+ */
+uint64 arenaError(FrameArena::Result eResult) {
+    switch (eResult) {
+        case FrameArena::SUCCESS:       return ABI::ERR_NONE;
+        case FrameArena::INVALID_ARENA: return ERR_MEM_INVALID_ARENA;
+        default:                        return ERR_MEM_ARENA_CORRUPT;
+    }
+}
+
+/**
+ * ARENA_CREATE
+ */
+void arenaCreate() {
+    if (uint64 uCapacity = Interpreter::gpr<ABI::INT_REG_0>().uQuad) {
+        FrameArena* poArena = FrameArena::create(uCapacity, Interpreter::gpr<ABI::INT_REG_1>().uLong);
+        Interpreter::gpr<ABI::PTR_REG_0>().pAny  = poArena;
+        Interpreter::gpr<ABI::INT_REG_0>().uQuad = poArena ?
+            (uint64)ABI::ERR_NONE :
+            (uint64)ERR_NO_MEM;
+    } else {
+        Interpreter::gpr<ABI::PTR_REG_0>().pAny  = nullptr;
+        Interpreter::gpr<ABI::INT_REG_0>().uQuad = ERR_MEM;
+    }
+}
+
+/**
+ * ARENA_ALLOC
+ */
+void arenaAlloc() {
+    FrameArena* poArena = Interpreter::gpr<ABI::PTR_REG_0>().address<FrameArena>();
+    uint64      uSize   = Interpreter::gpr<ABI::INT_REG_0>().uQuad;
+    uint64      uAlign  = Interpreter::gpr<ABI::INT_REG_1>().uQuad;
+    if (!uAlign) {
+        uAlign = FrameArena::DEFAULT_ALIGN;
+    }
+    Interpreter::gpr<ABI::PTR_REG_0>().pAny = nullptr;
+    if (FrameArena::SUCCESS != FrameArena::validate(poArena)) {
+        Interpreter::gpr<ABI::INT_REG_0>().uQuad = ERR_MEM_INVALID_ARENA;
+    } else if (!uSize || (uAlign & (uAlign - 1)) || uAlign > FrameArena::MAX_ALIGN) {
+        Interpreter::gpr<ABI::INT_REG_0>().uQuad = ERR_MEM;
+    } else if (void* pBlock = poArena->allocate(uSize, uAlign)) {
+        Interpreter::gpr<ABI::PTR_REG_0>().pAny  = pBlock;
+        Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_NONE;
+    } else {
+        Interpreter::gpr<ABI::INT_REG_0>().uQuad = ERR_MEM_ARENA_FULL;
+    }
+}
+
+/**
+ * ARENA_RESET
+ */
+uint64 arenaReset(FrameArena* poArena) {
+    FrameArena::Result eResult = FrameArena::validate(poArena);
+    if (FrameArena::SUCCESS == eResult) {
+        eResult = poArena->reset();
+    }
+    return arenaError(eResult);
+}
+
+/**
+ * ARENA_DESTROY
+ */
+uint64 arenaDestroy(FrameArena* poArena) {
+    if (!poArena) {
+        return ABI::ERR_NULL_PTR;
+    }
+    return arenaError(FrameArena::destroy(poArena));
+}
+
+/**
+ * ALLOC_BUFFER
+ */
+void allocBuffer() {
+    uint32 uParams = Interpreter::gpr<ABI::INT_REG_0>().uLong;
+    ElementBuffer* pBuffer = ElementBuffer::allocateBuffer(
+        (uint16)(uParams >> 16),
+        (uint16)(uParams & 0xFFFF)
+    );
+    Interpreter::gpr<ABI::PTR_REG_0>().pAny  = pBuffer;
+    Interpreter::gpr<ABI::INT_REG_0>().uQuad = pBuffer ?
+        (uint64)ABI::ERR_NONE :
+        (uint64)ERR_NO_MEM;
+}
+
+/**
+ * FREE_BUFFER
+ */
+uint64 freeBuffer(ElementBuffer* pBuffer) {
+    if (!pBuffer) {
+        return ABI::ERR_NULL_PTR;
+    }
+    if (ElementBuffer::SUCCESS != ElementBuffer::validate(pBuffer)) {
+        return ERR_MEM_INVALID_BUFFER;
+    }
+    ElementBuffer::freeBuffer(pBuffer);
+    return ABI::ERR_NONE;
+}
+
+/**
+ * ALLOC_ELEMENT
+ */
+void allocElement() {
+    ElementBuffer* pBuffer = Interpreter::gpr<ABI::PTR_REG_0>().address<ElementBuffer>();
+    if (pBuffer) {
+        if ( (ElementBuffer::SUCCESS == ElementBuffer::validate(pBuffer)) ) {
+            void *pElement = pBuffer->alloc();
+            Interpreter::gpr<ABI::PTR_REG_0>().pAny  = pElement;
+            Interpreter::gpr<ABI::INT_REG_0>().uQuad = pElement ?
                 (uint64)ABI::ERR_NONE :
-                (uint64)ERR_NO_MEM;
-            break;
+                (uint64)ERR_MEM_BUFFER_FULL;
+        } else {
+            Interpreter::gpr<ABI::PTR_REG_0>().pAny  = nullptr;
+            Interpreter::gpr<ABI::INT_REG_0>().uQuad = ERR_MEM_INVALID_BUFFER;
         }
+    } else {
+        Interpreter::gpr<ABI::PTR_REG_0>().pAny  = nullptr;
+        Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_NULL_PTR;
+    }
+}
 
-        case FREE_BUFFER: {
-            ElementBuffer* pBuffer = Interpreter::gpr<ABI::PTR_REG_0>().address<ElementBuffer>();
-            if (pBuffer) {
-                if ( (ElementBuffer::SUCCESS == ElementBuffer::validate(pBuffer)) ) {
-                    ElementBuffer::freeBuffer(pBuffer);
-                    Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_NONE;
-                } else {
-                    Interpreter::gpr<ABI::INT_REG_0>().uQuad = ERR_MEM_INVALID_BUFFER;
-                }
-            } else {
-                Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_NULL_PTR;
-            }
-            break;
-        }
-        case ALLOC_ELEMENT: {
-            ElementBuffer* pBuffer = Interpreter::gpr<ABI::PTR_REG_0>().address<ElementBuffer>();
-            if (pBuffer) {
-                if ( (ElementBuffer::SUCCESS == ElementBuffer::validate(pBuffer)) ) {
-                    void *pElement = pBuffer->alloc();
-                    Interpreter::gpr<ABI::PTR_REG_0>().pAny  = pElement;
-                    Interpreter::gpr<ABI::INT_REG_0>().uQuad = pElement ?
-                        (uint64)ABI::ERR_NONE :
-                        (uint64)ERR_MEM_BUFFER_FULL;
-                } else {
-                    Interpreter::gpr<ABI::PTR_REG_0>().pAny  = nullptr;
-                    Interpreter::gpr<ABI::INT_REG_0>().uQuad = ERR_MEM_INVALID_BUFFER;
-                }
-            } else {
-                Interpreter::gpr<ABI::PTR_REG_0>().pAny  = nullptr;
-                Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_NULL_PTR;
-            }
-            break;
+/**
+ * FREE_ELEMENT
+ */
+void freeElement() {
+    ElementBuffer* pBuffer = Interpreter::gpr<ABI::PTR_REG_0>().address<ElementBuffer>();
+    void *pElement = Interpreter::gpr<ABI::PTR_REG_1>().pAny;
+    if (pBuffer && pElement) {
+        if ( (ElementBuffer::SUCCESS == ElementBuffer::validate(pBuffer)) ) {
+            Interpreter::gpr<ABI::INT_REG_0>().uQuad = (ElementBuffer::SUCCESS == pBuffer->free(pElement)) ?
+                (uint64)ABI::ERR_NONE :
+                (uint64)ERR_MEM_INVALID_ELEMENT;
+        } else {
+            Interpreter::gpr<ABI::PTR_REG_0>().pAny  = nullptr;
+            Interpreter::gpr<ABI::INT_REG_0>().uQuad = ERR_MEM_INVALID_BUFFER;
         }
+    } else {
+        Interpreter::gpr<ABI::PTR_REG_0>().pAny  = nullptr;
+        Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_NULL_PTR;
+    }
+}
 
-        case FREE_ELEMENT: {
-            ElementBuffer* pBuffer = Interpreter::gpr<ABI::PTR_REG_0>().address<ElementBuffer>();
-            void *pElement = Interpreter::gpr<ABI::PTR_REG_1>().pAny;
-            if (pBuffer && pElement) {
-                if ( (ElementBuffer::SUCCESS == ElementBuffer::validate(pBuffer)) ) {
-                    Interpreter::gpr<ABI::INT_REG_0>().uQuad = (ElementBuffer::SUCCESS == pBuffer->free(pElement)) ?
-                        (uint64)ABI::ERR_NONE :
-                        (uint64)ERR_MEM_INVALID_ELEMENT;
-                } else {
-                    Interpreter::gpr<ABI::PTR_REG_0>().pAny  = nullptr;
-                    Interpreter::gpr<ABI::INT_REG_0>().uQuad = ERR_MEM_INVALID_BUFFER;
-                }
-            } else {
-                Interpreter::gpr<ABI::PTR_REG_0>().pAny  = nullptr;
-                Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_NULL_PTR;
-            }
-            break;
-        }
+/**
+ * COPY
+ */
+uint64 copy(void const* pFrom, void* pTo, uint64 uSize) {
+    if (!uSize) {
+        return ABI::ERR_BAD_SIZE;
+    }
+    if (!pFrom || !pTo) {
+        return ABI::ERR_NULL_PTR;
+    }
+    Host::Memory::copy(pTo, pFrom, uSize);
+    return ABI::ERR_NONE;
+}
 
-        case COPY:
-            if (uint64 uSize = Interpreter::gpr<ABI::INT_REG_0>().uQuad) {
-                void* pFrom = Interpreter::gpr<ABI::PTR_REG_0>().pAny;
-                void* pTo   = Interpreter::gpr<ABI::PTR_REG_1>().pAny;
-                if (pFrom && pTo) {
-                    Host::Memory::copy(pTo, pFrom, uSize);
-                    Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_NONE;
-                } else {
-                    Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_NULL_PTR;
-                }
-            } else {
-                Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_BAD_SIZE;
-            }
-            break;
-
-        case BSWAP_WORD: swapBlock<uint16>(); break;
-        case BSWAP_LONG: swapBlock<uint32>(); break;
-        case BSWAP_QUAD: swapBlock<uint64>(); break;
-        case AND_BYTE:   andBlock<uint8>();  break;
-        case AND_WORD:   andBlock<uint16>(); break;
-        case AND_LONG:   andBlock<uint32>(); break;
-        case AND_QUAD:   andBlock<uint64>(); break;
-        case OR_BYTE:    orBlock<uint8>();   break;
-        case OR_WORD:    orBlock<uint16>();  break;
-        case OR_LONG:    orBlock<uint32>();  break;
-        case OR_QUAD:    orBlock<uint64>();  break;
-        case EOR_BYTE:   eorBlock<uint8>();  break;
-        case EOR_WORD:   eorBlock<uint16>(); break;
-        case EOR_LONG:   eorBlock<uint32>(); break;
-        case EOR_QUAD:   eorBlock<uint64>(); break;
-        case FILL_BYTE:  fillBlock<uint8>();  break;
-        case FILL_WORD:  fillBlock<uint16>(); break;
-        case FILL_LONG:  fillBlock<uint32>(); break;
-        case FILL_QUAD:  fillBlock<uint64>(); break;
-        case FIND_BYTE:  findBlock<uint8>();  break;
-        case FIND_WORD:  findBlock<uint16>(); break;
-        case FIND_LONG:  findBlock<uint32>(); break;
-        case FIND_QUAD:  findBlock<uint64>(); break;
-
-        case STR_LENGTH: {
-            char const* sString = Interpreter::gpr<ABI::PTR_REG_0>().sString;
-            if (sString) {
-                Interpreter::gpr<ABI::INT_REG_0>().uQuad = std::strlen(sString);
-                Interpreter::gpr<ABI::INT_REG_1>().uQuad = ABI::ERR_NONE;
-            } else {
-                Interpreter::gpr<ABI::INT_REG_0>().uQuad = 0;
-                Interpreter::gpr<ABI::INT_REG_1>().uQuad = ABI::ERR_NULL_PTR;
-            }
-            break;
-        }
-        case STR_COMPARE: {
-            char const* sString1 = Interpreter::gpr<ABI::PTR_REG_0>().sString;
-            char const* sString2 = Interpreter::gpr<ABI::PTR_REG_1>().sString;
-            if (sString1 && sString2) {
-                Interpreter::gpr<ABI::INT_REG_0>().iQuad = std::strcmp(sString1, sString2);
-                Interpreter::gpr<ABI::INT_REG_1>().uQuad = ABI::ERR_NONE;
-            } else {
-                Interpreter::gpr<ABI::INT_REG_0>().uQuad = 0;
-                Interpreter::gpr<ABI::INT_REG_1>().uQuad = ABI::ERR_NULL_PTR;
-            }
-            break;
-        }
+/**
+ * STR_LENGTH
+ */
+void strLength() {
+    char const* sString = Interpreter::gpr<ABI::PTR_REG_0>().sString;
+    if (sString) {
+        Interpreter::gpr<ABI::INT_REG_0>().uQuad = std::strlen(sString);
+        Interpreter::gpr<ABI::INT_REG_1>().uQuad = ABI::ERR_NONE;
+    } else {
+        Interpreter::gpr<ABI::INT_REG_0>().uQuad = 0;
+        Interpreter::gpr<ABI::INT_REG_1>().uQuad = ABI::ERR_NULL_PTR;
+    }
+}
 
-        default:
-            std::fprintf(stderr, "Unknown Mem operation %d\n", iOperation);
-            return Interpreter::UNKNOWN_HOST_CALL;
-            break;
+/**
+ * STR_COMPARE
+ */
+void strCompare() {
+    char const* sString1 = Interpreter::gpr<ABI::PTR_REG_0>().sString;
+    char const* sString2 = Interpreter::gpr<ABI::PTR_REG_1>().sString;
+    if (sString1 && sString2) {
+        Interpreter::gpr<ABI::INT_REG_0>().iQuad = std::strcmp(sString1, sString2);
+        Interpreter::gpr<ABI::INT_REG_1>().uQuad = ABI::ERR_NONE;
+    } else {
+        Interpreter::gpr<ABI::INT_REG_0>().uQuad = 0;
+        Interpreter::gpr<ABI::INT_REG_1>().uQuad = ABI::ERR_NULL_PTR;
     }
+}
+
+/**
+ * Builds the host call table
+ */
+constexpr ABI::HostCallTable<CALL_MAX> makeHostCalls() {
+    ABI::HostCallTable<CALL_MAX> acHostCalls = {};
+
+    acHostCalls[INIT]          = ABI::call<nop>;
+    acHostCalls[DONE]          = ABI::call<nop>;
+    acHostCalls[ALLOC]         = ABI::call<alloc>;
+    acHostCalls[FREE]          = ABI::call<release>;
+    acHostCalls[ALLOC_BUFFER]  = ABI::call<allocBuffer>;
+    acHostCalls[FREE_BUFFER]   = ABI::call<freeBuffer>;
+    acHostCalls[ALLOC_ELEMENT] = ABI::call<allocElement>;
+    acHostCalls[FREE_ELEMENT]  = ABI::call<freeElement>;
+    acHostCalls[COPY]          = ABI::call<copy>;
+    acHostCalls[BSWAP_WORD]    = ABI::call<swapBlock<uint16>>;
+    acHostCalls[BSWAP_LONG]    = ABI::call<swapBlock<uint32>>;
+    acHostCalls[BSWAP_QUAD]    = ABI::call<swapBlock<uint64>>;
+    acHostCalls[AND_BYTE]      = ABI::call<andBlock<uint8>>;
+    acHostCalls[AND_WORD]      = ABI::call<andBlock<uint16>>;
+    acHostCalls[AND_LONG]      = ABI::call<andBlock<uint32>>;
+    acHostCalls[AND_QUAD]      = ABI::call<andBlock<uint64>>;
+    acHostCalls[OR_BYTE]       = ABI::call<orBlock<uint8>>;
+    acHostCalls[OR_WORD]       = ABI::call<orBlock<uint16>>;
+    acHostCalls[OR_LONG]       = ABI::call<orBlock<uint32>>;
+    acHostCalls[OR_QUAD]       = ABI::call<orBlock<uint64>>;
+    acHostCalls[EOR_BYTE]      = ABI::call<eorBlock<uint8>>;
+    acHostCalls[EOR_WORD]      = ABI::call<eorBlock<uint16>>;
+    acHostCalls[EOR_LONG]      = ABI::call<eorBlock<uint32>>;
+    acHostCalls[EOR_QUAD]      = ABI::call<eorBlock<uint64>>;
+    acHostCalls[FILL_BYTE]     = ABI::call<fillBlock<uint8>>;
+    acHostCalls[FILL_WORD]     = ABI::call<fillBlock<uint16>>;
+    acHostCalls[FILL_LONG]     = ABI::call<fillBlock<uint32>>;
+    acHostCalls[FILL_QUAD]     = ABI::call<fillBlock<uint64>>;
+    acHostCalls[FIND_BYTE]     = ABI::call<findBlock<uint8>>;
+    acHostCalls[FIND_WORD]     = ABI::call<findBlock<uint16>>;
+    acHostCalls[FIND_LONG]     = ABI::call<findBlock<uint32>>;
+    acHostCalls[FIND_QUAD]     = ABI::call<findBlock<uint64>>;
+    acHostCalls[STR_LENGTH]    = ABI::call<strLength>;
+    acHostCalls[STR_COMPARE]   = ABI::call<strCompare>;
+    acHostCalls[FREE_ALL]      = ABI::call<releaseAll>;
+    acHostCalls[ARENA_CREATE]  = ABI::call<arenaCreate>;
+    acHostCalls[ARENA_ALLOC]   = ABI::call<arenaAlloc>;
+    acHostCalls[ARENA_RESET]   = ABI::call<arenaReset>;
+    acHostCalls[ARENA_DESTROY] = ABI::call<arenaDestroy>;
+
+    return acHostCalls;
+}
 
-    return Interpreter::RUNNING;
+ABI::HostCallTable<CALL_MAX> const acHostCalls = makeHostCalls();
+
+/**
+ * Mem::hostVector(uint8 uFunctionID)
+ */
+Interpreter::Status hostVector(uint8 uFunctionID) {
+    if (uFunctionID < CALL_MAX && acHostCalls[uFunctionID]) {
+        return acHostCalls[uFunctionID]();
+    }
+    std::fprintf(stderr, "Unknown Mem operation %d\n", (int)uFunctionID);
+    return Interpreter::UNKNOWN_HOST_CALL;
 }
 
 } // namespace
@@ -0,0 +1,796 @@
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+#include <cstdio>
+#include <cmath>
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include <host/standard_test_host_raster.hpp>
+#include <host/blit/kernels.hpp>
+#include <host/raster/texels.hpp>
+#include <host/raster/generic/affine.hpp>
+#include <host/raster/avx2/affine.hpp>
+
+using MC64K::Machine::Interpreter;
+
+namespace MC64K::StandardTestHost::Raster {
+
+using Blit::Surface;
+using Blit::View;
+using Host::Blit::Kernels;
+using Host::Raster::Texels;
+
+enum {
+    SUBPIXEL_BITS    = 4,
+    SUBPIXEL         = 1 << SUBPIXEL_BITS,
+    HALF_PIXEL       = SUBPIXEL / 2,
+
+    // Vertex positions beyond this many pixels from the origin are rejected, keeping the edge functions in range
+    MAX_COORDINATE   = 1 << 20,
+
+    // Largest texture dimension, so that texel coordinates fit 16.16 fixed point
+    MAX_TEXTURE_SIZE = 1 << 15,
+
+    MAX_PLANES       = 4,
+
+    // Pixels between the perspective divides. The texture coordinates are stepped linearly in between
+    PERSPECTIVE_STEP = 16,
+
+    // Rows per band for FLAG_PARALLEL. Bands are dealt out to the threads in turn
+    BAND_ROWS        = 32,
+    MAX_THREADS      = 16,
+
+    MODE_MASK        = 0xFF
+};
+
+/**
+ * Largest texel coordinate magnitude along a row for the signed fixed point kernels of WRAP_CLAMP and WRAP_NONE
+ */
+static constexpr float32 MAX_SIGNED_TEXEL = 32767.0f;
+
+/**
+ * An attribute that varies linearly over a triangle, as a function of the pixel position.
+ */
+struct Plane {
+    float32 fBase; // Value at the centre of pixel 0, 0
+    float32 fDx;
+    float32 fDy;
+
+    float32 at(int32 iX, int32 iY) const {
+        return fBase + fDx * (float32)iX + fDy * (float32)iY;
+    }
+};
+
+/**
+ * Edge function E(x, y) = A.x + B.y + C, in subpixel units and positive on the inside. A point exactly on the edge
+ * is inside when the edge is a top or left one, which is expressed as E >= iThreshold.
+ */
+struct Edge {
+    int64 iA;
+    int64 iB;
+    int64 iC;
+    int64 iThreshold;
+};
+
+inline int64 floorDiv(int64 iNumerator, int64 iDenominator) {
+    int64 iQuotient = iNumerator / iDenominator;
+    return (iNumerator % iDenominator && iNumerator < 0) ? iQuotient - 1 : iQuotient;
+}
+
+inline int64 ceilDiv(int64 iNumerator, int64 iDenominator) {
+    return -floorDiv(-iNumerator, iDenominator);
+}
+
+/**
+ * Convert to 16.16 fixed point, saturating
+ */
+inline uint32 toFixed(float32 fValue) {
+    return (uint32)(int32)std::fmax(std::fmin(fValue * 65536.0f, 2147483520.0f), -2147483648.0f);
+}
+
+/**
+ * Convert a texel coordinate to 16.16 fixed point, wrapped to the texture size first
+ */
+inline uint32 wrapFixed(float32 fValue, float32 fSize) {
+    fValue -= fSize * std::floor(fValue / fSize);
+    if (!(fValue >= 0.0f && fValue < fSize)) {
+        fValue = 0.0f;
+    }
+    return (uint32)(fValue * 65536.0f);
+}
+
+/**
+ * Convert a texel coordinate to signed 16.16 fixed point, for coordinates known to be in range
+ */
+inline uint32 signedFixed(float32 fValue) {
+    return (uint32)(int32)std::floor(fValue * 65536.0f);
+}
+
+/**
+ * Triangle, set up for drawing
+ */
+struct Triangle {
+    Edge  aoEdge[3];
+    int32 iMinY;
+    int32 iMaxY;
+    Plane aoPlane[MAX_PLANES];
+
+    bool setup(Vertex const* poVertex, float32 const (*aafAttribute)[MAX_PLANES], uint32 uPlanes, View const& oTarget);
+    bool span(int32 iY, int64 iWidth, int32& iX0, int32& iX1) const;
+};
+
+/**
+ * Snaps the vertices to the subpixel grid and sets up the edges and attribute planes. Returns false if there is
+ * nothing to draw.
+ */
+bool Triangle::setup(
+    Vertex const* poVertex,
+    float32 const (*aafAttribute)[MAX_PLANES],
+    uint32        uPlanes,
+    View const&   oTarget
+) {
+    int64 aiX[3], aiY[3];
+    for (unsigned u = 0; u < 3; ++u) {
+        // Also rejects NaN
+        if (!(std::fabs(poVertex[u].fX) < MAX_COORDINATE && std::fabs(poVertex[u].fY) < MAX_COORDINATE)) {
+            return false;
+        }
+        aiX[u] = (int64)std::lrint(poVertex[u].fX * SUBPIXEL);
+        aiY[u] = (int64)std::lrint(poVertex[u].fY * SUBPIXEL);
+    }
+    int64 iArea = (aiX[1] - aiX[0]) * (aiY[2] - aiY[0]) - (aiX[2] - aiX[0]) * (aiY[1] - aiY[0]);
+    if (!iArea) {
+        return false;
+    }
+
+    // Rows with a pixel centre in the vertical extent, clipped
+    int64 iMinY = ceilDiv(std::min({aiY[0], aiY[1], aiY[2]}) - HALF_PIXEL, SUBPIXEL);
+    int64 iMaxY = floorDiv(std::max({aiY[0], aiY[1], aiY[2]}) - HALF_PIXEL, SUBPIXEL);
+    int64 iMinX = ceilDiv(std::min({aiX[0], aiX[1], aiX[2]}) - HALF_PIXEL, SUBPIXEL);
+    int64 iMaxX = floorDiv(std::max({aiX[0], aiX[1], aiX[2]}) - HALF_PIXEL, SUBPIXEL);
+    iMinY = std::max(iMinY, (int64)0);
+    iMaxY = std::min(iMaxY, oTarget.iHeight - 1);
+    if (iMinY > iMaxY || iMaxX < 0 || iMinX >= oTarget.iWidth) {
+        return false;
+    }
+    this->iMinY = (int32)iMinY;
+    this->iMaxY = (int32)iMaxY;
+
+    // Edges in the order that makes the inside positive
+    static unsigned const auOrder[2][3] = { { 0, 1, 2 }, { 0, 2, 1 } };
+    unsigned const* puOrder = auOrder[iArea < 0];
+    for (unsigned u = 0; u < 3; ++u) {
+        unsigned uI = puOrder[u];
+        unsigned uJ = puOrder[(u + 1) % 3];
+        Edge& roEdge      = aoEdge[u];
+        roEdge.iA         = aiY[uI] - aiY[uJ];
+        roEdge.iB         = aiX[uJ] - aiX[uI];
+        roEdge.iC         = -(roEdge.iA * aiX[uI] + roEdge.iB * aiY[uI]);
+        roEdge.iThreshold = (roEdge.iA > 0 || (0 == roEdge.iA && roEdge.iB > 0)) ? 0 : 1;
+    }
+
+    // Attribute planes from the snapped positions, based at the centre of pixel 0, 0
+    float32 fX0  = (float32)aiX[0] * (1.0f / SUBPIXEL);
+    float32 fY0  = (float32)aiY[0] * (1.0f / SUBPIXEL);
+    float32 fDX1 = (float32)(aiX[1] - aiX[0]) * (1.0f / SUBPIXEL);
+    float32 fDY1 = (float32)(aiY[1] - aiY[0]) * (1.0f / SUBPIXEL);
+    float32 fDX2 = (float32)(aiX[2] - aiX[0]) * (1.0f / SUBPIXEL);
+    float32 fDY2 = (float32)(aiY[2] - aiY[0]) * (1.0f / SUBPIXEL);
+    float32 fInvArea = 1.0f / (fDX1 * fDY2 - fDX2 * fDY1);
+    for (unsigned u = 0; u < uPlanes; ++u) {
+        float32 fA0 = aafAttribute[0][u];
+        float32 fD1 = aafAttribute[1][u] - fA0;
+        float32 fD2 = aafAttribute[2][u] - fA0;
+        Plane& roPlane = aoPlane[u];
+        roPlane.fDx    = (fD1 * fDY2 - fD2 * fDY1) * fInvArea;
+        roPlane.fDy    = (fD2 * fDX1 - fD1 * fDX2) * fInvArea;
+        roPlane.fBase  = fA0 + roPlane.fDx * (0.5f - fX0) + roPlane.fDy * (0.5f - fY0);
+    }
+    return true;
+}
+
+/**
+ * Solves the edge functions for the pixels of a row that are inside, clipped to the width. Returns false if none
+ * are.
+ */
+bool Triangle::span(int32 iY, int64 iWidth, int32& iX0, int32& iX1) const {
+    int64 iStart = 0;
+    int64 iEnd   = iWidth;
+    int64 iRow   = (int64)iY * SUBPIXEL + HALF_PIXEL;
+    for (Edge const& roEdge : aoEdge) {
+        // E at the centre of pixel 0 of the row, then E(x) = K + A.SUBPIXEL.x >= threshold solved for x
+        int64 iK = roEdge.iA * HALF_PIXEL + roEdge.iB * iRow + roEdge.iC;
+        if (roEdge.iA > 0) {
+            iStart = std::max(iStart, ceilDiv(roEdge.iThreshold - iK, roEdge.iA * SUBPIXEL));
+        } else if (roEdge.iA < 0) {
+            iEnd = std::min(iEnd, floorDiv(iK - roEdge.iThreshold, -roEdge.iA * SUBPIXEL) + 1);
+        } else if (iK < roEdge.iThreshold) {
+            return false;
+        }
+    }
+    iX0 = (int32)iStart;
+    iX1 = (int32)iEnd;
+    return iStart < iEnd;
+}
+
+/**
+ * Pixel from 0-255 channel values
+ */
+template<typename T>
+inline T pack(uint32 uA, uint32 uR, uint32 uG, uint32 uB) {
+    if constexpr (4 == sizeof(T)) {
+        return uA << 24 | uR << 16 | uG << 8 | uB;
+    } else if constexpr (2 == sizeof(T)) {
+        return (T)((uR >> 3) << 10 | (uG >> 3) << 5 | uB >> 3);
+    } else {
+        (void)uA; (void)uR; (void)uG;
+        return (T)uB;
+    }
+}
+
+/**
+ * Shaders. Each gives the number of planes it needs, fills in the plane values for a vertex (returning false if the
+ * triangle cannot be drawn) and draws a span of a row.
+ */
+template<typename T>
+struct Flat {
+    static constexpr uint32 PLANES = 0;
+
+    typename Kernels<T>::Fill cFill;
+    T                         uPixel;
+
+    static bool attributes(Vertex const&, float32*) {
+        return true;
+    }
+
+    void operator()(T* pRow, int32 iX0, int32 iX1, int32, Plane const*) const {
+        cFill(pRow + iX0, uPixel, (uint32)(iX1 - iX0));
+    }
+};
+
+template<typename T>
+struct Gouraud {
+    static constexpr uint32 PLANES = 4;
+
+    static bool attributes(Vertex const& roVertex, float32* pfPlane) {
+        for (unsigned u = 0; u < 4; ++u) {
+            pfPlane[u] = (float32)((roVertex.uColour >> (24 - 8 * u)) & 0xFF);
+        }
+        return true;
+    }
+
+    void operator()(T* pRow, int32 iX0, int32 iX1, int32 iY, Plane const* poPlane) const {
+        uint32 auValue[4], auStep[4];
+        for (unsigned u = 0; u < 4; ++u) {
+            auValue[u] = toFixed(poPlane[u].at(iX0, iY));
+            auStep[u]  = toFixed(poPlane[u].fDx);
+        }
+        for (int32 iX = iX0; iX < iX1; ++iX) {
+            // Pixel centres just outside the vertices can extrapolate slightly beyond the range
+            uint32 auChannel[4];
+            for (unsigned u = 0; u < 4; ++u) {
+                auChannel[u] = (uint32)std::clamp((int32)auValue[u] >> 16, 0, 255);
+                auValue[u]  += auStep[u];
+            }
+            pRow[iX] = pack<T>(auChannel[0], auChannel[1], auChannel[2], auChannel[3]);
+        }
+    }
+};
+
+template<typename T, bool bKey>
+struct Affine {
+    static constexpr uint32 PLANES = 2;
+
+    Texels<T> oTexels;
+    T         uKey;
+
+    static bool attributes(Vertex const& roVertex, float32* pfPlane) {
+        pfPlane[0] = roVertex.fU;
+        pfPlane[1] = roVertex.fV;
+        return true;
+    }
+
+    void operator()(T* pRow, int32 iX0, int32 iX1, int32 iY, Plane const* poPlane) const {
+        uint32 uU  = wrapFixed(poPlane[0].at(iX0, iY), oTexels.fWidth);
+        uint32 uV  = wrapFixed(poPlane[1].at(iX0, iY), oTexels.fHeight);
+        uint32 uDU = toFixed(poPlane[0].fDx);
+        uint32 uDV = toFixed(poPlane[1].fDx);
+        for (int32 iX = iX0; iX < iX1; ++iX, uU += uDU, uV += uDV) {
+            T uTexel = oTexels.fetch(uU, uV);
+            if (!bKey || uTexel != uKey) {
+                pRow[iX] = uTexel;
+            }
+        }
+    }
+};
+
+template<typename T, bool bKey>
+struct Perspective {
+    static constexpr uint32 PLANES = 3;
+
+    Texels<T> oTexels;
+    T         uKey;
+
+    /**
+     * u/w, v/w and 1/w are linear in screen space
+     */
+    static bool attributes(Vertex const& roVertex, float32* pfPlane) {
+        if (!(roVertex.fW > 0.0f)) {
+            return false;
+        }
+        float32 fInvW = 1.0f / roVertex.fW;
+        pfPlane[0] = roVertex.fU * fInvW;
+        pfPlane[1] = roVertex.fV * fInvW;
+        pfPlane[2] = fInvW;
+        return true;
+    }
+
+    void operator()(T* pRow, int32 iX0, int32 iX1, int32 iY, Plane const* poPlane) const {
+        float32 fInvW = 1.0f / poPlane[2].at(iX0, iY);
+        float32 fU    = poPlane[0].at(iX0, iY) * fInvW;
+        float32 fV    = poPlane[1].at(iX0, iY) * fInvW;
+        for (int32 iX = iX0; iX < iX1; ) {
+            int32   iCount  = std::min((int32)PERSPECTIVE_STEP, iX1 - iX);
+            int32   iNext   = iX + iCount;
+            float32 fScale  = 1.0f / (float32)iCount;
+            fInvW           = 1.0f / poPlane[2].at(iNext, iY);
+            float32 fNextU  = poPlane[0].at(iNext, iY) * fInvW;
+            float32 fNextV  = poPlane[1].at(iNext, iY) * fInvW;
+            uint32  uU      = wrapFixed(fU, oTexels.fWidth);
+            uint32  uV      = wrapFixed(fV, oTexels.fHeight);
+            uint32  uDU     = toFixed((fNextU - fU) * fScale);
+            uint32  uDV     = toFixed((fNextV - fV) * fScale);
+            for (; iX < iNext; ++iX, uU += uDU, uV += uDV) {
+                T uTexel = oTexels.fetch(uU, uV);
+                if (!bKey || uTexel != uKey) {
+                    pRow[iX] = uTexel;
+                }
+            }
+            fU = fNextU;
+            fV = fNextV;
+        }
+    }
+};
+
+/**
+ * Draw the triangles, or for a band thread, just the rows of its bands
+ */
+template<typename T, typename S>
+void draw(View const& oTarget, Vertex const* poVertex, uint32 uCount, S const& oShader, int32 iBand, int32 iBands) {
+    float32 aafAttribute[3][MAX_PLANES];
+    for (uint32 u = 0; u < uCount; ++u, poVertex += 3) {
+        Triangle oTriangle;
+        if (
+            !S::attributes(poVertex[0], aafAttribute[0]) ||
+            !S::attributes(poVertex[1], aafAttribute[1]) ||
+            !S::attributes(poVertex[2], aafAttribute[2]) ||
+            !oTriangle.setup(poVertex, aafAttribute, S::PLANES, oTarget)
+        ) {
+            continue;
+        }
+        uint8* puRow = oTarget.puPixels + (uint64)oTriangle.iMinY * oTarget.uStride;
+        for (int32 iY = oTriangle.iMinY; iY <= oTriangle.iMaxY; ++iY, puRow += oTarget.uStride) {
+            int32 iX0, iX1;
+            if (
+                (iBands < 2 || (iY / BAND_ROWS) % iBands == iBand) &&
+                oTriangle.span(iY, oTarget.iWidth, iX0, iX1)
+            ) {
+                oShader((T*)puRow, iX0, iX1, iY, oTriangle.aoPlane);
+            }
+        }
+    }
+}
+
+/**
+ * Draw on the calling thread, or on one thread per band group for FLAG_PARALLEL. The bands are disjoint, so the
+ * result is the same either way.
+ */
+template<typename T, typename S>
+void run(View const& oTarget, Vertex const* poVertex, uint32 uCount, S const& oShader, bool bParallel) {
+    int32 iThreads = 1;
+    if (bParallel) {
+        iThreads = (int32)std::min({
+            std::max(std::thread::hardware_concurrency(), 1U),
+            (uint32)MAX_THREADS,
+            (uint32)((oTarget.iHeight + BAND_ROWS - 1) / BAND_ROWS)
+        });
+    }
+    if (iThreads < 2) {
+        draw<T>(oTarget, poVertex, uCount, oShader, 0, 1);
+        return;
+    }
+    std::vector<std::thread> aThreads;
+    for (int32 iThread = 1; iThread < iThreads; ++iThread) {
+        aThreads.emplace_back([&, iThread]() {
+            draw<T>(oTarget, poVertex, uCount, oShader, iThread, iThreads);
+        });
+    }
+    draw<T>(oTarget, poVertex, uCount, oShader, 0, iThreads);
+    for (auto& roThread : aThreads) {
+        roThread.join();
+    }
+}
+
+/**
+ * Check a texture. Power of two dimensions are required for wrapping.
+ */
+template<typename T>
+uint64 texture(Surface const* poTexture, View const& oTarget, Texels<T>& oTexels, bool bWrap) {
+    View   oTexture;
+    uint64 uResult = Blit::view(poTexture, oTexture);
+    if (ABI::ERR_NONE != uResult) {
+        return uResult;
+    }
+    if (oTexture.uFormat != oTarget.uFormat) {
+        return Blit::ERR_BAD_FORMAT;
+    }
+    if (
+        !oTexture.iWidth  || oTexture.iWidth  > MAX_TEXTURE_SIZE ||
+        !oTexture.iHeight || oTexture.iHeight > MAX_TEXTURE_SIZE ||
+        (bWrap && ((oTexture.iWidth & (oTexture.iWidth - 1)) || (oTexture.iHeight & (oTexture.iHeight - 1))))
+    ) {
+        return ERR_BAD_TEXTURE;
+    }
+    oTexels.puTexels = oTexture.puPixels;
+    oTexels.uStride  = oTexture.uStride;
+    oTexels.uMaskU   = (uint32)oTexture.iWidth  - 1;
+    oTexels.uMaskV   = (uint32)oTexture.iHeight - 1;
+    oTexels.iWidth   = (int32)oTexture.iWidth;
+    oTexels.iHeight  = (int32)oTexture.iHeight;
+    oTexels.fWidth   = (float32)oTexture.iWidth;
+    oTexels.fHeight  = (float32)oTexture.iHeight;
+    return ABI::ERR_NONE;
+}
+
+/**
+ * TRIANGLES, for a pixel type
+ */
+template<typename T>
+uint64 drawTriangles(
+    View const&    oTarget,
+    Vertex const*  poVertex,
+    Surface const* poTexture,
+    uint32         uCount,
+    uint32         uMode,
+    T              uPixel
+) {
+    bool bParallel = uMode & FLAG_PARALLEL;
+    bool bKey      = uMode & FLAG_KEY;
+    switch (uMode & MODE_MASK) {
+        case MODE_FLAT:
+            run<T>(oTarget, poVertex, uCount, Flat<T>{ Kernels<T>::get().cFill, uPixel }, bParallel);
+            break;
+
+        case MODE_GOURAUD:
+            run<T>(oTarget, poVertex, uCount, Gouraud<T>{}, bParallel);
+            break;
+
+        default: {
+            Texels<T> oTexels;
+            uint64    uResult = texture<T>(poTexture, oTarget, oTexels, true);
+            if (ABI::ERR_NONE != uResult) {
+                return uResult;
+            }
+            if (MODE_TEXTURE == (uMode & MODE_MASK)) {
+                if (bKey) {
+                    run<T>(oTarget, poVertex, uCount, Affine<T, true>{ oTexels, uPixel }, bParallel);
+                } else {
+                    run<T>(oTarget, poVertex, uCount, Affine<T, false>{ oTexels, uPixel }, bParallel);
+                }
+            } else if (bKey) {
+                run<T>(oTarget, poVertex, uCount, Perspective<T, true>{ oTexels, uPixel }, bParallel);
+            } else {
+                run<T>(oTarget, poVertex, uCount, Perspective<T, false>{ oTexels, uPixel }, bParallel);
+            }
+            break;
+        }
+    }
+    return ABI::ERR_NONE;
+}
+
+/**
+ * SPANS, for a pixel type
+ */
+template<typename T>
+void fillSpans(View const& oTarget, Span const* poSpan, uint32 uCount) {
+    auto cFill = Kernels<T>::get().cFill;
+    for (uint32 u = 0; u < uCount; ++u, ++poSpan) {
+        int64 iX0 = std::max((int64)poSpan->iX, (int64)0);
+        int64 iX1 = std::min((int64)poSpan->iX + poSpan->uLength, oTarget.iWidth);
+        if (poSpan->iY < 0 || poSpan->iY >= oTarget.iHeight || iX0 >= iX1) {
+            continue;
+        }
+        T* pRow = (T*)(oTarget.puPixels + (uint64)poSpan->iY * oTarget.uStride);
+        cFill(pRow + iX0, (T)poSpan->uPixel, (uint32)(iX1 - iX0));
+    }
+}
+
+/**
+ * The affine row kernels for a pixel type, by wrap mode and key. Only 32-bit pixels have AVX2 versions.
+ */
+template<typename T>
+struct AffineKernels {
+    typedef void (*Row)(
+        T*               pDestination,
+        uint32           uCount,
+        uint32           uU,
+        uint32           uV,
+        uint32           uDU,
+        uint32           uDV,
+        Texels<T> const& roTexels,
+        T                uKey
+    );
+
+    Row acRow[WRAP_MAX][2];
+
+    template<unsigned uWrap>
+    void select(bool bAVX2) {
+        acRow[uWrap][0] = Host::Raster::Generic::affine<T, uWrap, false>;
+        acRow[uWrap][1] = Host::Raster::Generic::affine<T, uWrap, true>;
+        if constexpr (4 == sizeof(T)) {
+            if (bAVX2) {
+                acRow[uWrap][0] = Host::Raster::AVX2::affine<uWrap, false>;
+                acRow[uWrap][1] = Host::Raster::AVX2::affine<uWrap, true>;
+            }
+        }
+    }
+
+    AffineKernels() {
+        bool bAVX2 = Host::CPU::getLevel() >= Host::CPU::AVX2;
+        select<WRAP_REPEAT>(bAVX2);
+        select<WRAP_CLAMP>(bAVX2);
+        select<WRAP_NONE>(bAVX2);
+    }
+
+    static AffineKernels const& get() {
+        static AffineKernels const oKernels;
+        return oKernels;
+    }
+};
+
+/**
+ * Row fallback for WRAP_CLAMP and WRAP_NONE when the coordinates go beyond the range of the fixed point kernels,
+ * e.g. far out past the horizon of a mode 7 plane.
+ */
+template<typename T>
+void affineRow(
+    T*               pDestination,
+    uint32           uCount,
+    float32          fU,
+    float32          fV,
+    float32          fDU,
+    float32          fDV,
+    Texels<T> const& roTexels,
+    unsigned         uWrap,
+    bool             bKey,
+    T                uKey
+) {
+    for (uint32 u = 0; u < uCount; ++u) {
+        float32 fX = std::floor(fU + fDU * (float32)u);
+        float32 fY = std::floor(fV + fDV * (float32)u);
+        if (WRAP_CLAMP == uWrap) {
+            fX = std::fmax(std::fmin(fX, roTexels.fWidth  - 1.0f), 0.0f);
+            fY = std::fmax(std::fmin(fY, roTexels.fHeight - 1.0f), 0.0f);
+        } else if (!(fX >= 0.0f && fX < roTexels.fWidth && fY >= 0.0f && fY < roTexels.fHeight)) {
+            continue;
+        }
+        T uTexel = roTexels.row((uint32)fY)[(uint32)fX];
+        if (!bKey || uTexel != uKey) {
+            pDestination[u] = uTexel;
+        }
+    }
+}
+
+/**
+ * AFFINE, for a pixel type
+ */
+template<typename T>
+void drawAffine(
+    View const&      oTarget,
+    Texels<T> const& oTexels,
+    Transform const& oTransform,
+    unsigned         uWrap,
+    bool             bKey,
+    T                uKey
+) {
+    Blit::Rect const& oRect = oTransform.oRect;
+    int64 iX0 = std::max((int64)oRect.iX, (int64)0);
+    int64 iY0 = std::max((int64)oRect.iY, (int64)0);
+    int64 iX1 = std::min((int64)oRect.iX + oRect.uWidth,  oTarget.iWidth);
+    int64 iY1 = std::min((int64)oRect.iY + oRect.uHeight, oTarget.iHeight);
+    if (iX0 >= iX1 || iY0 >= iY1) {
+        return;
+    }
+    auto    cRow    = AffineKernels<T>::get().acRow[uWrap][bKey];
+    uint32  uCount  = (uint32)(iX1 - iX0);
+    float32 fColumn = (float32)(iX0 - oRect.iX);
+    float32 fLast   = (float32)(uCount - 1);
+    uint8*  puRow   = oTarget.puPixels + (uint64)iY0 * oTarget.uStride + (uint64)iX0 * sizeof(T);
+    for (int64 iY = iY0; iY < iY1; ++iY, puRow += oTarget.uStride) {
+        int64   iRow = iY - oRect.iY;
+        float32 fU, fV, fDU, fDV;
+        if (oTransform.poLines) {
+            TransformLine const& roLine = oTransform.poLines[iRow];
+            fU  = roLine.fU;
+            fV  = roLine.fV;
+            fDU = roLine.fDUDX;
+            fDV = roLine.fDVDX;
+        } else {
+            fU  = oTransform.fU + oTransform.fDUDY * (float32)iRow;
+            fV  = oTransform.fV + oTransform.fDVDY * (float32)iRow;
+            fDU = oTransform.fDUDX;
+            fDV = oTransform.fDVDX;
+        }
+        fU += fDU * fColumn;
+        fV += fDV * fColumn;
+
+        T* pRow = (T*)puRow;
+        if (WRAP_REPEAT == uWrap) {
+            cRow(
+                pRow, uCount,
+                wrapFixed(fU, oTexels.fWidth), wrapFixed(fV, oTexels.fHeight), toFixed(fDU), toFixed(fDV),
+                oTexels, uKey
+            );
+        } else if (
+            std::fmax(std::fabs(fU), std::fabs(fU + fDU * fLast)) < MAX_SIGNED_TEXEL &&
+            std::fmax(std::fabs(fV), std::fabs(fV + fDV * fLast)) < MAX_SIGNED_TEXEL
+        ) {
+            cRow(pRow, uCount, signedFixed(fU), signedFixed(fV), toFixed(fDU), toFixed(fDV), oTexels, uKey);
+        } else {
+            affineRow<T>(pRow, uCount, fU, fV, fDU, fDV, oTexels, uWrap, bKey, uKey);
+        }
+    }
+}
+
+/**
+ * No operation
+ */
+void nop() {
+}
+
+/**
+ * TRIANGLES
+ */
+uint64 triangles(
+    Surface const* poTarget,
+    Vertex const*  poVertex,
+    Surface const* poTexture,
+    uint32         uCount,
+    uint32         uMode,
+    uint32         uPixel
+) {
+    View   oTarget;
+    uint64 uResult = Blit::view(poTarget, oTarget);
+    if (ABI::ERR_NONE != uResult) {
+        return uResult;
+    }
+    if ((uMode & MODE_MASK) >= MODE_MAX || (uMode & ~(MODE_MASK | FLAG_ALL))) {
+        return ERR_BAD_MODE;
+    }
+    if (!poVertex) {
+        return uCount ? ABI::ERR_NULL_PTR : ABI::ERR_NONE;
+    }
+    switch (oTarget.uPixelSize) {
+        case sizeof(uint8):
+            return drawTriangles<uint8>(oTarget, poVertex, poTexture, uCount, uMode, (uint8)uPixel);
+        case sizeof(uint16):
+            return drawTriangles<uint16>(oTarget, poVertex, poTexture, uCount, uMode, (uint16)uPixel);
+        default:
+            return drawTriangles<uint32>(oTarget, poVertex, poTexture, uCount, uMode, uPixel);
+    }
+}
+
+/**
+ * SPANS
+ */
+uint64 spans(Surface const* poTarget, Span const* poSpan, uint32 uCount) {
+    View   oTarget;
+    uint64 uResult = Blit::view(poTarget, oTarget);
+    if (ABI::ERR_NONE != uResult) {
+        return uResult;
+    }
+    if (!poSpan) {
+        return uCount ? ABI::ERR_NULL_PTR : ABI::ERR_NONE;
+    }
+    switch (oTarget.uPixelSize) {
+        case sizeof(uint8):
+            fillSpans<uint8>(oTarget, poSpan, uCount);
+            break;
+        case sizeof(uint16):
+            fillSpans<uint16>(oTarget, poSpan, uCount);
+            break;
+        default:
+            fillSpans<uint32>(oTarget, poSpan, uCount);
+            break;
+    }
+    return ABI::ERR_NONE;
+}
+
+/**
+ * AFFINE
+ */
+uint64 affine(
+    Surface const*   poTarget,
+    Surface const*   poTexture,
+    Transform const* poTransform,
+    uint32           uMode,
+    uint32           uKey
+) {
+    View   oTarget;
+    uint64 uResult = Blit::view(poTarget, oTarget);
+    if (ABI::ERR_NONE != uResult) {
+        return uResult;
+    }
+    unsigned uWrap = uMode & MODE_MASK;
+    if (uWrap >= WRAP_MAX || (uMode & ~(MODE_MASK | FLAG_KEY))) {
+        return ERR_BAD_MODE;
+    }
+    if (!poTransform) {
+        return ABI::ERR_NULL_PTR;
+    }
+    bool bKey = uMode & FLAG_KEY;
+    switch (oTarget.uPixelSize) {
+        case sizeof(uint8): {
+            Texels<uint8> oTexels;
+            if (ABI::ERR_NONE == (uResult = texture<uint8>(poTexture, oTarget, oTexels, WRAP_REPEAT == uWrap))) {
+                drawAffine<uint8>(oTarget, oTexels, *poTransform, uWrap, bKey, (uint8)uKey);
+            }
+            break;
+        }
+        case sizeof(uint16): {
+            Texels<uint16> oTexels;
+            if (ABI::ERR_NONE == (uResult = texture<uint16>(poTexture, oTarget, oTexels, WRAP_REPEAT == uWrap))) {
+                drawAffine<uint16>(oTarget, oTexels, *poTransform, uWrap, bKey, (uint16)uKey);
+            }
+            break;
+        }
+        default: {
+            Texels<uint32> oTexels;
+            if (ABI::ERR_NONE == (uResult = texture<uint32>(poTexture, oTarget, oTexels, WRAP_REPEAT == uWrap))) {
+                drawAffine<uint32>(oTarget, oTexels, *poTransform, uWrap, bKey, uKey);
+            }
+            break;
+        }
+    }
+    return uResult;
+}
+
+/**
+ * Builds the host call table
+ */
+constexpr ABI::HostCallTable<CALL_MAX> makeHostCalls() {
+    ABI::HostCallTable<CALL_MAX> acHostCalls = {};
+
+    acHostCalls[INIT]      = ABI::call<nop>;
+    acHostCalls[DONE]      = ABI::call<nop>;
+    acHostCalls[TRIANGLES] = ABI::call<triangles>;
+    acHostCalls[SPANS]     = ABI::call<spans>;
+    acHostCalls[AFFINE]    = ABI::call<affine>;
+
+    return acHostCalls;
+}
+
+ABI::HostCallTable<CALL_MAX> const acHostCalls = makeHostCalls();
+
+/**
+ * Raster::hostVector(uint8 uFunctionID)
+ */
+Interpreter::Status hostVector(uint8 uFunctionID) {
+    if (uFunctionID < CALL_MAX && acHostCalls[uFunctionID]) {
+        return acHostCalls[uFunctionID]();
+    }
+    std::fprintf(stderr, "Unknown Raster operation %d\n", (int)uFunctionID);
+    return Interpreter::UNKNOWN_HOST_CALL;
+}
+
+} // namespace
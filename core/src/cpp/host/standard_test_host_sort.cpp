@@ -0,0 +1,325 @@
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <host/standard_test_host_sort.hpp>
+
+using MC64K::Machine::Interpreter;
+
+namespace MC64K::StandardTestHost::Sort {
+
+enum {
+    RADIX_BITS  = 8,
+    RADIX       = 1 << RADIX_BITS,
+    RADIX_MASK  = RADIX - 1,
+
+    // Fewest keys per thread for FLAG_PARALLEL, below which the thread start up costs more than it saves
+    MIN_CHUNK   = 1 << 16,
+    MAX_THREADS = 16,
+
+    MODE_MASK   = 0xFF
+};
+
+/**
+ * Stand in payload type for keys sorted on their own
+ */
+struct NoPayload {};
+
+/**
+ * Radix sort of keys of unsigned type K with payloads of type P. Signed, floating point and descending keys are
+ * handled by mapping each key to an unsigned key with the wanted order when its digits are taken, so the keys
+ * themselves are only ever moved.
+ */
+template<typename K, typename P>
+struct Sorter {
+    static constexpr unsigned DIGITS   = sizeof(K);
+    static constexpr K        SIGN_BIT = (K)((K)1 << (sizeof(K) * 8 - 1));
+
+    struct Histogram {
+        uint64 aauCounts[DIGITS][RADIX];
+    };
+
+    K*     apKeys[2];
+    P*     apPayloads[2];
+    uint64 uCount;
+
+    // Ordering map: key ^ uFlip, with uNegativeFlip also applied to keys that have the sign bit set
+    K      uFlip;
+    K      uNegativeFlip;
+
+    int32  iThreads;
+
+    // Per thread digit counts of their chunk
+    std::vector<Histogram> aHistograms;
+
+    inline K ordered(K uKey) const {
+        K uNegative = (K)(0 - (K)(uKey >> (sizeof(K) * 8 - 1)));
+        return (K)(uKey ^ uFlip ^ (uNegative & uNegativeFlip));
+    }
+
+    inline unsigned digit(K uKey, unsigned uDigit) const {
+        return (unsigned)(ordered(uKey) >> (uDigit * RADIX_BITS)) & RADIX_MASK;
+    }
+
+    uint64 chunkBegin(int32 iThread) const {
+        return uCount * (uint64)iThread / (uint64)iThreads;
+    }
+
+    /**
+     * Run a function for each thread index, on the calling thread as index 0 and on new threads for the rest
+     */
+    template<typename F>
+    void each(F const& cFunction) {
+        if (iThreads < 2) {
+            cFunction(0);
+            return;
+        }
+        std::vector<std::thread> aThreads;
+        for (int32 iThread = 1; iThread < iThreads; ++iThread) {
+            aThreads.emplace_back(cFunction, iThread);
+        }
+        cFunction(0);
+        for (auto& roThread : aThreads) {
+            roThread.join();
+        }
+    }
+
+    /**
+     * Count every digit of the keys in the chunk of one thread
+     */
+    void countAll(int32 iThread) {
+        auto&    raauCounts = aHistograms[(size_t)iThread].aauCounts;
+        K const* pKeys      = apKeys[0];
+        uint64   uEnd       = chunkBegin(iThread + 1);
+        std::memset(raauCounts, 0, sizeof(raauCounts));
+        for (uint64 u = chunkBegin(iThread); u < uEnd; ++u) {
+            K uKey = ordered(pKeys[u]);
+            for (unsigned uDigit = 0; uDigit < DIGITS; ++uDigit) {
+                ++raauCounts[uDigit][(uKey >> (uDigit * RADIX_BITS)) & RADIX_MASK];
+            }
+        }
+    }
+
+    /**
+     * Count one digit of the keys in the chunk of one thread, in buffer uBuffer
+     */
+    void count(int32 iThread, unsigned uBuffer, unsigned uDigit) {
+        uint64*  puCounts = aHistograms[(size_t)iThread].aauCounts[uDigit];
+        K const* pKeys    = apKeys[uBuffer];
+        uint64   uEnd     = chunkBegin(iThread + 1);
+        std::fill(puCounts, puCounts + RADIX, 0);
+        for (uint64 u = chunkBegin(iThread); u < uEnd; ++u) {
+            ++puCounts[digit(pKeys[u], uDigit)];
+        }
+    }
+
+    /**
+     * Move the keys in the chunk of one thread from buffer uBuffer to the other, by one digit, starting from the
+     * thread's offsets for each digit value
+     */
+    void scatter(int32 iThread, unsigned uBuffer, unsigned uDigit, uint64 const* puOffsets) {
+        K const* pFromKeys     = apKeys[uBuffer];
+        K*       pToKeys       = apKeys[uBuffer ^ 1];
+        P const* pFromPayloads = apPayloads[uBuffer];
+        P*       pToPayloads   = apPayloads[uBuffer ^ 1];
+        uint64   uEnd          = chunkBegin(iThread + 1);
+
+        // Local copy, as the stores below could otherwise alias the offsets
+        uint64 auNext[RADIX];
+        std::memcpy(auNext, puOffsets, sizeof(auNext));
+        for (uint64 u = chunkBegin(iThread); u < uEnd; ++u) {
+            K      uKey  = pFromKeys[u];
+            uint64 uSlot = auNext[digit(uKey, uDigit)]++;
+            pToKeys[uSlot] = uKey;
+            if constexpr (!std::is_same<P, NoPayload>::value) {
+                pToPayloads[uSlot] = pFromPayloads[u];
+            }
+        }
+    }
+
+    void sort() {
+        aHistograms.resize((size_t)iThreads);
+
+        // Count every digit at once. Reordering does not change the totals, so these decide which passes are needed
+        each([this](int32 iThread) {
+            countAll(iThread);
+        });
+        uint64 aauTotals[DIGITS][RADIX] = {};
+        for (auto const& roHistogram : aHistograms) {
+            for (unsigned uDigit = 0; uDigit < DIGITS; ++uDigit) {
+                for (unsigned uValue = 0; uValue < RADIX; ++uValue) {
+                    aauTotals[uDigit][uValue] += roHistogram.aauCounts[uDigit][uValue];
+                }
+            }
+        }
+
+        std::vector<uint64> auOffsets((size_t)iThreads * RADIX);
+        unsigned uBuffer = 0;
+        bool     bMoved  = false;
+        for (unsigned uDigit = 0; uDigit < DIGITS; ++uDigit) {
+            if (std::find(aauTotals[uDigit], aauTotals[uDigit] + RADIX, uCount) != aauTotals[uDigit] + RADIX) {
+                continue;
+            }
+
+            // Once the keys have moved, the chunks need counting again, unless a single chunk is the whole array
+            if (iThreads > 1 && bMoved) {
+                each([this, uBuffer, uDigit](int32 iThread) {
+                    count(iThread, uBuffer, uDigit);
+                });
+            }
+
+            // Each thread writes its keys of each digit value after those of the earlier threads, keeping it stable
+            uint64 uOffset = 0;
+            for (unsigned uValue = 0; uValue < RADIX; ++uValue) {
+                for (int32 iThread = 0; iThread < iThreads; ++iThread) {
+                    auOffsets[(size_t)iThread * RADIX + uValue] = uOffset;
+                    uOffset += aHistograms[(size_t)iThread].aauCounts[uDigit][uValue];
+                }
+            }
+            each([this, uBuffer, uDigit, &auOffsets](int32 iThread) {
+                scatter(iThread, uBuffer, uDigit, &auOffsets[(size_t)iThread * RADIX]);
+            });
+            uBuffer ^= 1;
+            bMoved   = true;
+        }
+
+        // An odd number of passes leaves the result in the scratch buffer
+        if (uBuffer) {
+            std::memcpy(apKeys[0], apKeys[1], uCount * sizeof(K));
+            if constexpr (!std::is_same<P, NoPayload>::value) {
+                std::memcpy(apPayloads[0], apPayloads[1], uCount * sizeof(P));
+            }
+        }
+    }
+};
+
+/**
+ * Sort keys of type K, as a Type with the given properties
+ */
+template<typename K, bool bSigned, bool bFloat>
+void sortKeys(void* pKeys, void* pPayloads, void* pScratch, uint64 uCount, uint32 uMode) {
+    constexpr K SIGN_BIT = Sorter<K, NoPayload>::SIGN_BIT;
+    K     uFlip         = (K)((bSigned ? SIGN_BIT : 0) ^ ((uMode & FLAG_DESCENDING) ? (K)~(K)0 : 0));
+    K     uNegativeFlip = bFloat ? (K)~SIGN_BIT : (K)0;
+    int32 iThreads      = 1;
+    if (uMode & FLAG_PARALLEL) {
+        iThreads = (int32)std::min<uint64>({
+            std::max(std::thread::hardware_concurrency(), 1U),
+            (uint64)MAX_THREADS,
+            uCount / MIN_CHUNK
+        });
+        iThreads = std::max(iThreads, 1);
+    }
+
+    // The payload part of the scratch buffer is 8 byte aligned, relative to the start of the buffer
+    uint8* puScratch        = (uint8*)pScratch;
+    void*  pScratchPayloads = puScratch + ((uCount * sizeof(K) + 7) & ~(uint64)7);
+
+    auto cRun = [&](auto* pPayload, auto* pScratchPayload) {
+        typedef typename std::remove_pointer<decltype(pPayload)>::type P;
+        Sorter<K, P> oSorter;
+        oSorter.apKeys[0]     = (K*)pKeys;
+        oSorter.apKeys[1]     = (K*)pScratch;
+        oSorter.apPayloads[0] = pPayload;
+        oSorter.apPayloads[1] = pScratchPayload;
+        oSorter.uCount        = uCount;
+        oSorter.uFlip         = uFlip;
+        oSorter.uNegativeFlip = uNegativeFlip;
+        oSorter.iThreads      = iThreads;
+        if constexpr (!std::is_same<P, NoPayload>::value) {
+            if (uMode & FLAG_INDEX) {
+                for (uint64 u = 0; u < uCount; ++u) {
+                    pPayload[u] = (P)u;
+                }
+            }
+        }
+        oSorter.sort();
+    };
+
+    if (!pPayloads) {
+        cRun((NoPayload*)nullptr, (NoPayload*)nullptr);
+    } else if (uMode & FLAG_PAYLOAD_64) {
+        cRun((uint64*)pPayloads, (uint64*)pScratchPayloads);
+    } else {
+        cRun((uint32*)pPayloads, (uint32*)pScratchPayloads);
+    }
+}
+
+/**
+ * No operation
+ */
+uint64 nop() {
+    return ABI::ERR_NONE;
+}
+
+/**
+ * KEYS
+ */
+uint64 keys(void* pKeys, void* pPayloads, void* pScratch, uint64 uCount, uint32 uMode) {
+    if (
+        (uMode & MODE_MASK) >= TYPE_MAX ||
+        (uMode & ~(MODE_MASK | FLAG_ALL)) ||
+        ((uMode & FLAG_INDEX) && !(uMode & FLAG_PAYLOAD_64) && uCount > 0xFFFFFFFFULL)
+    ) {
+        return ERR_BAD_MODE;
+    }
+    if (!uCount) {
+        return ABI::ERR_NONE;
+    }
+    if (!pKeys || !pScratch || ((uMode & FLAG_INDEX) && !pPayloads)) {
+        return ABI::ERR_NULL_PTR;
+    }
+    switch (uMode & MODE_MASK) {
+        case TYPE_UINT16:  sortKeys<uint16, false, false>(pKeys, pPayloads, pScratch, uCount, uMode); break;
+        case TYPE_INT16:   sortKeys<uint16, true,  false>(pKeys, pPayloads, pScratch, uCount, uMode); break;
+        case TYPE_UINT32:  sortKeys<uint32, false, false>(pKeys, pPayloads, pScratch, uCount, uMode); break;
+        case TYPE_INT32:   sortKeys<uint32, true,  false>(pKeys, pPayloads, pScratch, uCount, uMode); break;
+        case TYPE_FLOAT32: sortKeys<uint32, true,  true>(pKeys, pPayloads, pScratch, uCount, uMode);  break;
+        case TYPE_UINT64:  sortKeys<uint64, false, false>(pKeys, pPayloads, pScratch, uCount, uMode); break;
+        case TYPE_INT64:   sortKeys<uint64, true,  false>(pKeys, pPayloads, pScratch, uCount, uMode); break;
+        default:           sortKeys<uint64, true,  true>(pKeys, pPayloads, pScratch, uCount, uMode);  break;
+    }
+    return ABI::ERR_NONE;
+}
+
+/**
+ * Builds the host call table
+ */
+constexpr ABI::HostCallTable<CALL_MAX> makeHostCalls() {
+    ABI::HostCallTable<CALL_MAX> acHostCalls = {};
+
+    acHostCalls[INIT] = ABI::call<nop>;
+    acHostCalls[DONE] = ABI::call<nop>;
+    acHostCalls[KEYS] = ABI::call<keys>;
+
+    return acHostCalls;
+}
+
+ABI::HostCallTable<CALL_MAX> const acHostCalls = makeHostCalls();
+
+/**
+ * Sort::hostVector(uint8 uFunctionID)
+ */
+Interpreter::Status hostVector(uint8 uFunctionID) {
+    if (uFunctionID < CALL_MAX && acHostCalls[uFunctionID]) {
+        return acHostCalls[uFunctionID]();
+    }
+    std::fprintf(stderr, "Unknown Sort operation %d\n", (int)uFunctionID);
+    return Interpreter::UNKNOWN_HOST_CALL;
+}
+
+} // namespace
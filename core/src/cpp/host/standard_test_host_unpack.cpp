@@ -0,0 +1,668 @@
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <new>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include <host/standard_test_host_unpack.hpp>
+#include <host/standard_test_host_io.hpp>
+#include <host/standard_test_host_mem.hpp>
+
+using MC64K::Machine::Interpreter;
+
+namespace MC64K::StandardTestHost::Unpack {
+
+enum {
+    MODE_MASK         = 0xFF,
+
+    // LZ4 frame format
+    FRAME_MAGIC       = 0x184D2204,
+    SKIPPABLE_MAGIC   = 0x184D2A50,
+    SKIPPABLE_MASK    = 0xFFFFFFF0,
+    FLG_VERSION       = 0x40,
+    FLG_VERSION_MASK  = 0xC0,
+    FLG_INDEPENDENT   = 0x20,
+    FLG_BLOCK_SUM     = 0x10,
+    FLG_CONTENT_SIZE  = 0x08,
+    FLG_CONTENT_SUM   = 0x04,
+    FLG_RESERVED      = 0x02,
+    FLG_DICTIONARY    = 0x01,
+    BD_RESERVED       = 0x8F,
+    BLOCK_STORED      = 0x80000000,
+
+    // LZ4 block format
+    MIN_MATCH         = 4,
+    RUN_MASK          = 15,
+
+    // Largest read when skipping data in a file
+    SKIP_CHUNK        = 1 << 16
+};
+
+/**
+ * Little endian reads of unaligned data
+ */
+inline uint32 readLE16(uint8 const* puData) {
+    return (uint32)puData[0] | (uint32)puData[1] << 8;
+}
+
+inline uint32 readLE32(uint8 const* puData) {
+    return readLE16(puData) | readLE16(puData + 2) << 16;
+}
+
+inline uint64 readLE64(uint8 const* puData) {
+    return (uint64)readLE32(puData) | (uint64)readLE32(puData + 4) << 32;
+}
+
+/**
+ * xxHash32, used for the LZ4 frame checksums
+ */
+uint32 xxh32(uint8 const* puData, uint64 uSize, uint32 uSeed) {
+    constexpr uint32 PRIME_1 = 0x9E3779B1U;
+    constexpr uint32 PRIME_2 = 0x85EBCA77U;
+    constexpr uint32 PRIME_3 = 0xC2B2AE3DU;
+    constexpr uint32 PRIME_4 = 0x27D4EB2FU;
+    constexpr uint32 PRIME_5 = 0x165667B1U;
+
+    auto rotate = [](uint32 uValue, unsigned uBits) {
+        return (uValue << uBits) | (uValue >> (32 - uBits));
+    };
+    auto mix = [&](uint32 uAccumulator, uint32 uInput) {
+        return rotate(uAccumulator + uInput * PRIME_2, 13) * PRIME_1;
+    };
+
+    uint8 const* puEnd = puData + uSize;
+    uint32 uHash;
+    if (uSize >= 16) {
+        uint32 auLane[4] = { uSeed + PRIME_1 + PRIME_2, uSeed + PRIME_2, uSeed, uSeed - PRIME_1 };
+        for (; puEnd - puData >= 16; puData += 16) {
+            for (unsigned u = 0; u < 4; ++u) {
+                auLane[u] = mix(auLane[u], readLE32(puData + u * 4));
+            }
+        }
+        uHash = rotate(auLane[0], 1) + rotate(auLane[1], 7) + rotate(auLane[2], 12) + rotate(auLane[3], 18);
+    } else {
+        uHash = uSeed + PRIME_5;
+    }
+    uHash += (uint32)uSize;
+    for (; puEnd - puData >= 4; puData += 4) {
+        uHash = rotate(uHash + readLE32(puData) * PRIME_3, 17) * PRIME_4;
+    }
+    for (; puData < puEnd; ++puData) {
+        uHash = rotate(uHash + *puData * PRIME_5, 11) * PRIME_1;
+    }
+    uHash ^= uHash >> 15;
+    uHash *= PRIME_2;
+    uHash ^= uHash >> 13;
+    uHash *= PRIME_3;
+    uHash ^= uHash >> 16;
+    return uHash;
+}
+
+/**
+ * Bytes left in a file from its current position, or the largest value when that cannot be told, e.g. for a pipe
+ */
+uint64 fileRemaining(std::FILE* pStream) {
+    long iPosition = std::ftell(pStream);
+    if (iPosition < 0 || std::fseek(pStream, 0, SEEK_END)) {
+        return ~0ULL;
+    }
+    long iEnd = std::ftell(pStream);
+    std::fseek(pStream, iPosition, SEEK_SET);
+    return iEnd > iPosition ? (uint64)(iEnd - iPosition) : 0;
+}
+
+/**
+ * Packed data, either a buffer in VM memory or a file. File data is read into a buffer as it is taken.
+ */
+class Source {
+    private:
+        uint8 const*       puData;
+        std::FILE*         pStream;
+        uint64             uRemaining;
+        uint64             uFileRemaining;
+        uint64             uError;
+        std::vector<uint8> auBuffer;
+
+    public:
+        Source(void const* pSource, uint64 uSize, bool bFile) :
+            puData(bFile ? nullptr : (uint8 const*)pSource),
+            pStream(bFile ? (std::FILE*)pSource : nullptr),
+            uRemaining(uSize),
+            uFileRemaining(bFile ? fileRemaining((std::FILE*)pSource) : 0),
+            uError(ABI::ERR_NONE)
+        {}
+
+        uint64 remaining() const {
+            return uRemaining;
+        }
+
+        uint64 error() const {
+            return uError;
+        }
+
+        /**
+         * Returns the next uSize bytes, or null with the error set when the source does not have them. The bytes
+         * are valid until the next call.
+         *
+         * The source size comes from the guest, so a file read is checked against what the file really holds
+         * before any buffer is sized for it.
+         */
+        uint8 const* take(uint64 uSize) {
+            if (uSize > uRemaining) {
+                uError = ERR_BAD_DATA;
+                return nullptr;
+            }
+            uRemaining -= uSize;
+            if (!pStream) {
+                uint8 const* puTaken = puData;
+                puData += uSize;
+                return puTaken;
+            }
+            if (uSize > uFileRemaining) {
+                uError = IO::ERR_READ;
+                return nullptr;
+            }
+            uFileRemaining -= uSize;
+            if (auBuffer.size() < uSize) {
+                try {
+                    auBuffer.resize(uSize);
+                } catch (std::bad_alloc const&) {
+                    uError = Mem::ERR_NO_MEM;
+                    return nullptr;
+                } catch (std::length_error const&) {
+                    uError = Mem::ERR_NO_MEM;
+                    return nullptr;
+                }
+            }
+            if (std::fread(auBuffer.data(), 1, uSize, pStream) != uSize) {
+                uError = IO::ERR_READ;
+                return nullptr;
+            }
+            return auBuffer.data();
+        }
+
+        /**
+         * Skips over the next uSize bytes
+         */
+        bool skip(uint64 uSize) {
+            if (!pStream) {
+                return take(uSize);
+            }
+            while (uSize) {
+                uint64 uChunk = std::min(uSize, (uint64)SKIP_CHUNK);
+                if (!take(uChunk)) {
+                    return false;
+                }
+                uSize -= uChunk;
+            }
+            return true;
+        }
+};
+
+/**
+ * Unpacked data. Bytes from uPosition to uCapacity are free.
+ */
+struct Target {
+    uint8* puBase;
+    uint64 uPosition;
+    uint64 uCapacity;
+
+    uint64 free() const {
+        return uCapacity - uPosition;
+    }
+};
+
+/**
+ * Reads an LZ4 length extension: bytes are added to the length for as long as they are 255
+ */
+inline bool readLength(uint8 const*& puIn, uint8 const* puInEnd, uint64& uLength) {
+    uint32 uByte;
+    do {
+        if (puIn == puInEnd) {
+            return false;
+        }
+        uByte    = *puIn++;
+        uLength += uByte;
+    } while (uByte == 255);
+    return true;
+}
+
+/**
+ * Decodes one LZ4 block onto the end of the target. Matches may refer back as far as uWindow, the position where
+ * the unpacked data the block may depend on starts.
+ *
+ * Short literal runs and matches at least 8 bytes back are copied 8 or 16 bytes at a time, which may write past
+ * the end of the copy while there is room in the target, and is later overwritten.
+ */
+uint64 decodeBlock(uint8 const* puIn, uint64 uSize, Target& oTarget, uint64 uWindow) {
+    uint8 const* puInEnd = puIn + uSize;
+    uint8*       puOut   = oTarget.puBase + oTarget.uPosition;
+    uint8*       puLimit = oTarget.puBase + oTarget.uCapacity;
+    uint8 const* puFirst = oTarget.puBase + uWindow;
+    uint64       uResult = ABI::ERR_NONE;
+
+    while (puIn < puInEnd) {
+        uint32 uToken = *puIn++;
+
+        // Literals
+        uint64 uLength = uToken >> 4;
+        if (uLength == RUN_MASK && !readLength(puIn, puInEnd, uLength)) {
+            uResult = ERR_BAD_DATA;
+            break;
+        }
+        if (uLength > (uint64)(puInEnd - puIn)) {
+            uResult = ERR_BAD_DATA;
+            break;
+        }
+        if (uLength > (uint64)(puLimit - puOut)) {
+            uResult = ERR_TARGET_FULL;
+            break;
+        }
+        if (uLength <= 16 && puInEnd - puIn >= 16 && puLimit - puOut >= 16) {
+            std::memcpy(puOut, puIn, 16);
+        } else {
+            std::memcpy(puOut, puIn, uLength);
+        }
+        puIn  += uLength;
+        puOut += uLength;
+
+        // The last sequence has no match
+        if (puIn == puInEnd) {
+            break;
+        }
+
+        // Match
+        if (puInEnd - puIn < 2) {
+            uResult = ERR_BAD_DATA;
+            break;
+        }
+        uint64 uOffset = readLE16(puIn);
+        puIn += 2;
+        uLength = uToken & RUN_MASK;
+        if (uLength == RUN_MASK && !readLength(puIn, puInEnd, uLength)) {
+            uResult = ERR_BAD_DATA;
+            break;
+        }
+        uLength += MIN_MATCH;
+        if (!uOffset || uOffset > (uint64)(puOut - puFirst)) {
+            uResult = ERR_BAD_DATA;
+            break;
+        }
+        if (uLength > (uint64)(puLimit - puOut)) {
+            uResult = ERR_TARGET_FULL;
+            break;
+        }
+        uint8 const* puMatch = puOut - uOffset;
+        if (uOffset >= 8 && (uint64)(puLimit - puOut) >= uLength + 8) {
+            // Each 8 byte chunk only reads bytes that have already been written
+            for (uint64 u = 0; u < uLength; u += 8) {
+                std::memcpy(puOut + u, puMatch + u, 8);
+            }
+        } else if (uOffset == 1) {
+            std::memset(puOut, *puMatch, uLength);
+        } else if (uOffset >= uLength) {
+            std::memcpy(puOut, puMatch, uLength);
+        } else {
+            for (uint64 u = 0; u < uLength; ++u) {
+                puOut[u] = puMatch[u];
+            }
+        }
+        puOut += uLength;
+    }
+    oTarget.uPosition = (uint64)(puOut - oTarget.puBase);
+    return uResult;
+}
+
+/**
+ * Decodes a raw LZ4 block
+ */
+uint64 decodeLZ4Block(Source& oSource, Target& oTarget) {
+    uint64 uSize = oSource.remaining();
+    uint8 const* puIn = oSource.take(uSize);
+    return puIn ? decodeBlock(puIn, uSize, oTarget, oTarget.uPosition) : oSource.error();
+}
+
+/**
+ * Decodes one LZ4 frame, after its magic number
+ */
+uint64 decodeLZ4Frame(Source& oSource, Target& oTarget) {
+    // Frame descriptor: FLG, BD, optional content size and dictionary ID, header checksum
+    uint8 auDescriptor[15];
+    uint8 const* puIn = oSource.take(2);
+    if (!puIn) {
+        return oSource.error();
+    }
+    auDescriptor[0] = puIn[0];
+    auDescriptor[1] = puIn[1];
+    uint32 uFlags = auDescriptor[0];
+    uint32 uBD    = auDescriptor[1];
+    uint32 uSizeIndex = (uBD >> 4) & 7;
+    if (
+        (uFlags & FLG_VERSION_MASK) != FLG_VERSION ||
+        (uFlags & (FLG_RESERVED | FLG_DICTIONARY)) ||
+        (uBD & BD_RESERVED) ||
+        uSizeIndex < 4
+    ) {
+        return ERR_BAD_DATA;
+    }
+    uint64 uDescriptorSize = 2 + ((uFlags & FLG_CONTENT_SIZE) ? 8 : 0);
+    if (!(puIn = oSource.take(uDescriptorSize - 2 + 1))) {
+        return oSource.error();
+    }
+    std::memcpy(auDescriptor + 2, puIn, uDescriptorSize - 2);
+    if (((xxh32(auDescriptor, uDescriptorSize, 0) >> 8) & 0xFF) != puIn[uDescriptorSize - 2]) {
+        return ERR_CHECKSUM;
+    }
+
+    // 64K, 256K, 1M or 4M
+    uint64 uBlockMax    = (uint64)1 << (8 + 2 * uSizeIndex);
+    uint64 uFrameStart  = oTarget.uPosition;
+    uint64 uContentSize = 0;
+    if (uFlags & FLG_CONTENT_SIZE) {
+        uContentSize = readLE64(auDescriptor + 2);
+        if (uContentSize > oTarget.free()) {
+            return ERR_TARGET_FULL;
+        }
+    }
+
+    // Blocks, up to the end mark
+    while (true) {
+        if (!(puIn = oSource.take(4))) {
+            return oSource.error();
+        }
+        uint32 uBlockSize = readLE32(puIn);
+        if (!uBlockSize) {
+            break;
+        }
+        bool bStored = uBlockSize & BLOCK_STORED;
+        uBlockSize &= ~(uint32)BLOCK_STORED;
+        if (uBlockSize > uBlockMax) {
+            return ERR_BAD_DATA;
+        }
+        uint64 uTaken = uBlockSize + ((uFlags & FLG_BLOCK_SUM) ? 4 : 0);
+        if (!(puIn = oSource.take(uTaken))) {
+            return oSource.error();
+        }
+        if ((uFlags & FLG_BLOCK_SUM) && xxh32(puIn, uBlockSize, 0) != readLE32(puIn + uBlockSize)) {
+            return ERR_CHECKSUM;
+        }
+        uint64 uBlockStart = oTarget.uPosition;
+        if (bStored) {
+            if (uBlockSize > oTarget.free()) {
+                return ERR_TARGET_FULL;
+            }
+            std::memcpy(oTarget.puBase + oTarget.uPosition, puIn, uBlockSize);
+            oTarget.uPosition += uBlockSize;
+        } else {
+            // Linked blocks may refer back into the earlier blocks of the frame
+            uint64 uResult = decodeBlock(
+                puIn,
+                uBlockSize,
+                oTarget,
+                (uFlags & FLG_INDEPENDENT) ? uBlockStart : uFrameStart
+            );
+            if (uResult != ABI::ERR_NONE) {
+                return uResult;
+            }
+        }
+        if (oTarget.uPosition - uBlockStart > uBlockMax) {
+            return ERR_BAD_DATA;
+        }
+    }
+
+    if ((uFlags & FLG_CONTENT_SIZE) && oTarget.uPosition - uFrameStart != uContentSize) {
+        return ERR_BAD_DATA;
+    }
+    if (uFlags & FLG_CONTENT_SUM) {
+        if (!(puIn = oSource.take(4))) {
+            return oSource.error();
+        }
+        if (xxh32(oTarget.puBase + uFrameStart, oTarget.uPosition - uFrameStart, 0) != readLE32(puIn)) {
+            return ERR_CHECKSUM;
+        }
+    }
+    return ABI::ERR_NONE;
+}
+
+/**
+ * Decodes a sequence of LZ4 frames, skipping any skippable frames between them
+ */
+uint64 decodeLZ4Frames(Source& oSource, Target& oTarget) {
+    while (oSource.remaining()) {
+        uint8 const* puIn = oSource.take(4);
+        if (!puIn) {
+            return oSource.error();
+        }
+        uint32 uMagic = readLE32(puIn);
+        if ((uMagic & SKIPPABLE_MASK) == SKIPPABLE_MAGIC) {
+            if (!(puIn = oSource.take(4)) || !oSource.skip(readLE32(puIn))) {
+                return oSource.error();
+            }
+            continue;
+        }
+        if (uMagic != FRAME_MAGIC) {
+            return ERR_BAD_DATA;
+        }
+        uint64 uResult = decodeLZ4Frame(oSource, oTarget);
+        if (uResult != ABI::ERR_NONE) {
+            return uResult;
+        }
+    }
+    return ABI::ERR_NONE;
+}
+
+/**
+ * Decodes PackBits data
+ */
+uint64 decodeRLE(Source& oSource, Target& oTarget) {
+    uint64 uSize = oSource.remaining();
+    uint8 const* puIn = oSource.take(uSize);
+    if (!puIn) {
+        return oSource.error();
+    }
+    uint8 const* puInEnd = puIn + uSize;
+    uint8*       puOut   = oTarget.puBase + oTarget.uPosition;
+    uint8*       puLimit = oTarget.puBase + oTarget.uCapacity;
+    uint64       uResult = ABI::ERR_NONE;
+    while (puIn < puInEnd) {
+        int32 iControl = (int8)*puIn++;
+        if (iControl == -128) {
+            continue;
+        }
+        uint64 uLength = (uint64)(iControl >= 0 ? iControl + 1 : 1 - iControl);
+        uint64 uTaken  = iControl >= 0 ? uLength : 1;
+        if (uTaken > (uint64)(puInEnd - puIn)) {
+            uResult = ERR_BAD_DATA;
+            break;
+        }
+        if (uLength > (uint64)(puLimit - puOut)) {
+            uResult = ERR_TARGET_FULL;
+            break;
+        }
+        if (iControl >= 0) {
+            std::memcpy(puOut, puIn, uLength);
+        } else {
+            std::memset(puOut, *puIn, uLength);
+        }
+        puIn  += uTaken;
+        puOut += uLength;
+    }
+    oTarget.uPosition = (uint64)(puOut - oTarget.puBase);
+    return uResult;
+}
+
+/**
+ * Unpacks a source into a target, returning the error and setting the unpacked size
+ */
+uint64 decode(
+    void const* pSource,
+    void*       pTarget,
+    uint64      uSourceSize,
+    uint64      uTargetCapacity,
+    uint32      uMode,
+    uint64&     uSize
+) {
+    uSize = 0;
+    if ((uMode & MODE_MASK) >= FORMAT_MAX || (uMode & ~(uint32)(MODE_MASK | FLAG_ALL))) {
+        return ERR_BAD_MODE;
+    }
+    if (!pSource || (!pTarget && uTargetCapacity)) {
+        return ABI::ERR_NULL_PTR;
+    }
+    Source oSource(pSource, uSourceSize, uMode & FLAG_FILE);
+    Target oTarget = { (uint8*)pTarget, 0, uTargetCapacity };
+    uint64 uResult;
+    switch (uMode & MODE_MASK) {
+        case FORMAT_LZ4_FRAME: uResult = decodeLZ4Frames(oSource, oTarget); break;
+        case FORMAT_LZ4_BLOCK: uResult = decodeLZ4Block(oSource, oTarget);  break;
+        default:               uResult = decodeRLE(oSource, oTarget);       break;
+    }
+    uSize = oTarget.uPosition;
+    return uResult;
+}
+
+/**
+ * A background unpack. The guest holds the address as its handle, so it carries a magic word that is checked
+ * before every use and cleared when the job is released.
+ */
+struct Job {
+    uint64            uMagic;
+    std::thread       oThread;
+    std::atomic<bool> bFinished;
+    uint64            uResult;
+    uint64            uSize;
+
+    /**
+     * Magic value for a job at a given address
+     */
+    static uint64 getMagic(Job const* pJob) {
+        return 0x554E5041434B4A42ULL ^ (uint64)pJob;
+    }
+
+    /**
+     * Check that a raw address from the VM really references a live job
+     */
+    static bool validate(void const* pRawJob) {
+        return
+            pRawJob &&
+            !(((uint64)pRawJob) & (alignof(Job) - 1)) &&
+            getMagic((Job const*)pRawJob) == ((Job const*)pRawJob)->uMagic;
+    }
+};
+
+uint64 nop() {
+    return ABI::ERR_NONE;
+}
+
+/**
+ * unpack_decode(a0 source, a1 target, d0 source_size, d1 target_capacity, d2 mode) => d0 error, d1 size
+ */
+uint64 decodeNow(void const* pSource, void* pTarget, uint64 uSourceSize, uint64 uTargetCapacity, uint32 uMode) {
+    uint64 uSize;
+    uint64 uResult = decode(pSource, pTarget, uSourceSize, uTargetCapacity, uMode, uSize);
+    Interpreter::gpr<ABI::INT_REG_1>().uQuad = uSize;
+    return uResult;
+}
+
+/**
+ * unpack_start(a0 source, a1 target, d0 source_size, d1 target_capacity, d2 mode) => a0 job, d0 error
+ */
+Job* start(void const* pSource, void* pTarget, uint64 uSourceSize, uint64 uTargetCapacity, uint32 uMode) {
+    Job* pJob = new (std::nothrow) Job;
+    if (!pJob) {
+        Interpreter::gpr<ABI::INT_REG_0>().uQuad = Mem::ERR_NO_MEM;
+        return nullptr;
+    }
+    pJob->uMagic = Job::getMagic(pJob);
+    pJob->bFinished.store(false);
+    pJob->uResult = ABI::ERR_NONE;
+    pJob->uSize   = 0;
+    try {
+        pJob->oThread = std::thread([=]() {
+            pJob->uResult = decode(pSource, pTarget, uSourceSize, uTargetCapacity, uMode, pJob->uSize);
+            pJob->bFinished.store(true, std::memory_order_release);
+        });
+    } catch (std::system_error const&) {
+        pJob->uMagic = 0;
+        delete pJob;
+        Interpreter::gpr<ABI::INT_REG_0>().uQuad = Mem::ERR_NO_MEM;
+        return nullptr;
+    }
+    Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_NONE;
+    return pJob;
+}
+
+/**
+ * unpack_poll(a0 job) => d0 finished
+ */
+uint64 poll(Job const* pJob) {
+    if (!Job::validate(pJob)) {
+        return ERR_BAD_JOB;
+    }
+    return pJob->bFinished.load(std::memory_order_acquire) ? 1 : 0;
+}
+
+/**
+ * unpack_wait(a0 job) => d0 error, d1 size
+ */
+uint64 wait(Job* pJob) {
+    Interpreter::gpr<ABI::INT_REG_1>().uQuad = 0;
+    if (!pJob) {
+        return ABI::ERR_NULL_PTR;
+    }
+    if (!Job::validate(pJob)) {
+        return ERR_BAD_JOB;
+    }
+    pJob->oThread.join();
+    uint64 uResult = pJob->uResult;
+    Interpreter::gpr<ABI::INT_REG_1>().uQuad = pJob->uSize;
+    pJob->uMagic = 0; // should help protect against double-wait
+    delete pJob;
+    return uResult;
+}
+
+/**
+ * Builds the host call table
+ */
+constexpr ABI::HostCallTable<CALL_MAX> makeHostCalls() {
+    ABI::HostCallTable<CALL_MAX> acHostCalls = {};
+
+    acHostCalls[INIT]   = ABI::call<nop>;
+    acHostCalls[DONE]   = ABI::call<nop>;
+    acHostCalls[DECODE] = ABI::call<decodeNow>;
+    acHostCalls[START]  = ABI::call<start>;
+    acHostCalls[POLL]   = ABI::call<poll>;
+    acHostCalls[WAIT]   = ABI::call<wait>;
+
+    return acHostCalls;
+}
+
+ABI::HostCallTable<CALL_MAX> const acHostCalls = makeHostCalls();
+
+/**
+ * Unpack::hostVector(uint8 uFunctionID)
+ */
+Interpreter::Status hostVector(uint8 uFunctionID) {
+    if (uFunctionID < CALL_MAX && acHostCalls[uFunctionID]) {
+        return acHostCalls[uFunctionID]();
+    }
+    std::fprintf(stderr, "Unknown Unpack operation %d\n", (int)uFunctionID);
+    return Interpreter::UNKNOWN_HOST_CALL;
+}
+
+} // namespace
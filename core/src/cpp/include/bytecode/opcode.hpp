@@ -463,5 +463,231 @@ enum Arithmetic {
     FTWOTOX_D   = OFS_ARITHMETIC + 114
 };
 
+/**
+ * Other
+ *
+ * Enumerates the extension opcodes. These are followed by a sub-opcode byte that selects the operation.
+ */
+enum Other {
+    VEC        = OFS_OTHER + 0,
+    BIT        = OFS_OTHER + 1,
+    CSEL       = OFS_OTHER + 2, // conditional select (dyadic compare), sub-opcode is the Condition
+    MINMAX     = OFS_OTHER + 3,
+    BLK        = OFS_OTHER + 4
+};
+
+/**
+ * Vector
+ *
+ * Enumerates the packed vector sub-opcodes, following the VEC opcode. Vector registers are 256 bits wide.
+ *
+ * Register operations are followed by a packed register pair byte, destination in the lower nybble and source in
+ * the upper, as per the fast path encoding. Some operations take an additional byte:
+ *
+ *     VFMA_S / VFMA_D  second source register
+ *     shifts           shift count
+ *     VSHUF_L          selector
+ *
+ * Memory operations are followed by a register byte (lower nybble) and then an effective address.
+ */
+enum Vector {
+    // Data movement
+    VLOAD      =  0, // <ea> -> vd, 32 bytes, unaligned
+    VSTORE     =  1, // vs -> <ea>, 32 bytes, unaligned
+    VMOVE      =  2, // vs -> vd
+    VCLR       =  3, // 0 -> vd
+    VSPLAT_B   =  4, // <ea> -> all lanes of vd
+    VSPLAT_W   =  5,
+    VSPLAT_L   =  6,
+    VSPLAT_Q   =  7,
+
+    // Bitwise
+    VAND       =  8,
+    VOR        =  9,
+    VEOR       = 10,
+    VANDN      = 11, // ~vd & vs -> vd
+
+    // Integer, modulo
+    VADD_B     = 12,
+    VADD_W     = 13,
+    VADD_L     = 14,
+    VADD_Q     = 15,
+    VSUB_B     = 16,
+    VSUB_W     = 17,
+    VSUB_L     = 18,
+    VSUB_Q     = 19,
+
+    // Integer, saturating
+    VADDS_B    = 20,
+    VADDS_W    = 21,
+    VADDUS_B   = 22,
+    VADDUS_W   = 23,
+    VSUBS_B    = 24,
+    VSUBS_W    = 25,
+    VSUBUS_B   = 26,
+    VSUBUS_W   = 27,
+
+    // Integer multiply, low half of product
+    VMUL_W     = 28,
+    VMUL_L     = 29,
+
+    // Shift by immediate count, masked to lane width
+    VLSL_W     = 30,
+    VLSL_L     = 31,
+    VLSL_Q     = 32,
+    VLSR_W     = 33,
+    VLSR_L     = 34,
+    VLSR_Q     = 35,
+    VASR_W     = 36,
+    VASR_L     = 37,
+
+    // Floating point
+    VFADD_S    = 38,
+    VFADD_D    = 39,
+    VFSUB_S    = 40,
+    VFSUB_D    = 41,
+    VFMUL_S    = 42,
+    VFMUL_D    = 43,
+    VFDIV_S    = 44,
+    VFDIV_D    = 45,
+    VFMA_S     = 46, // vd + vs * vs2 -> vd
+    VFMA_D     = 47,
+    VFMIN_S    = 48,
+    VFMIN_D    = 49,
+    VFMAX_S    = 50,
+    VFMAX_D    = 51,
+
+    // Conversion
+    VCVTL_S    = 52, // int32 lanes -> float32 lanes
+    VCVTS_L    = 53, // float32 lanes -> int32 lanes, truncating
+
+    // Shuffle and pack
+    VSHUF_L    = 54, // Select long lanes within each 128-bit half, 2 selector bits per lane
+    VPACKUS_W  = 55, // 16 signed words of vs -> 16 unsigned saturated bytes in the lower half of vd, upper half 0
+    VEXTU_B    = 56, // Lower 16 bytes of vs -> 16 zero extended words in vd
+
+    VMAX_OPERATION
+};
+
+/**
+ * Bit
+ *
+ * Enumerates the bit manipulation sub-opcodes, following the BIT opcode.
+ *
+ * Bit count operations are followed by the destination and source effective addresses, as per the dyadic
+ * encoding. The count is written at the operation size. Counting leading or trailing zeros of zero gives the
+ * operation size in bits.
+ *
+ * Bit field operations are followed by the field offset and width bytes and then the destination and source
+ * effective addresses. The operands are always quads. The offset is counted from the least significant bit, the
+ * width must be 1-64 and the field must lie within the operand.
+ *
+ * As on the 68020, either field byte may instead name a GPR, as BF_REGISTER plus the register number. The offset
+ * is then the register modulo 64 and the width the register modulo 64, with 0 meaning 64. When either comes from a
+ * register, a field that would extend past bit 63 is cut short there.
+ */
+enum Bit {
+    // Count leading zeros
+    CLZ_B      =  0, // <ea:s> -> <ea:d>
+    CLZ_W      =  1,
+    CLZ_L      =  2,
+    CLZ_Q      =  3,
+
+    // Count trailing zeros
+    CTZ_B      =  4,
+    CTZ_W      =  5,
+    CTZ_L      =  6,
+    CTZ_Q      =  7,
+
+    // Count set bits
+    POPCNT_B   =  8,
+    POPCNT_W   =  9,
+    POPCNT_L   = 10,
+    POPCNT_Q   = 11,
+
+    // Bit fields
+    BFEXTU     = 12, // Field of <ea:s>, zero extended -> <ea:d>
+    BFEXTS     = 13, // Field of <ea:s>, sign extended -> <ea:d>
+    BFINS      = 14, // Lower bits of <ea:s> -> field of <ea:d>
+
+    BMAX_OPERATION,
+
+    // Field byte flag for a register offset or width, the register number is in the low nybble
+    BF_REGISTER      = 0x80,
+    BF_REGISTER_MASK = 0x0F
+};
+
+/**
+ * MinMax
+ *
+ * Enumerates the minimum, maximum and clamp sub-opcodes, following the MINMAX opcode.
+ *
+ * Minimum and maximum are followed by the destination and source effective addresses, as per the dyadic encoding.
+ * Clamp is followed by the destination, lower bound and upper bound effective addresses. When a floating point
+ * operand is NaN the result is the source operand (or bound), as per the host minimum and maximum instructions.
+ */
+enum MinMax {
+    // Signed
+    MIN_B      =  0, // min(<ea:d>, <ea:s>) -> <ea:d>
+    MIN_W      =  1,
+    MIN_L      =  2,
+    MIN_Q      =  3,
+    MAX_B      =  4, // max(<ea:d>, <ea:s>) -> <ea:d>
+    MAX_W      =  5,
+    MAX_L      =  6,
+    MAX_Q      =  7,
+
+    // Unsigned
+    MINU_B     =  8,
+    MINU_W     =  9,
+    MINU_L     = 10,
+    MINU_Q     = 11,
+    MAXU_B     = 12,
+    MAXU_W     = 13,
+    MAXU_L     = 14,
+    MAXU_Q     = 15,
+
+    // Floating point
+    FMIN_S     = 16,
+    FMIN_D     = 17,
+    FMAX_S     = 18,
+    FMAX_D     = 19,
+
+    // Clamp, min(max(<ea:d>, <ea:lo>), <ea:hi>) -> <ea:d>
+    CLAMP_B    = 20,
+    CLAMP_W    = 21,
+    CLAMP_L    = 22,
+    CLAMP_Q    = 23,
+    CLAMPU_B   = 24,
+    CLAMPU_W   = 25,
+    CLAMPU_L   = 26,
+    CLAMPU_Q   = 27,
+    FCLAMP_S   = 28,
+    FCLAMP_D   = 29,
+
+    MMAX_OPERATION
+};
+
+/**
+ * Block
+ *
+ * Enumerates the block memory sub-opcodes, following the BLK opcode.
+ *
+ * The sub-opcode is followed by a byte naming the general purpose register that holds the length, then the
+ * destination and source effective addresses. For the move and compare operations, both effective addresses are
+ * the start addresses of the blocks and the length is in bytes. For fill, the source is the value and the length
+ * is in elements. A length of zero does nothing.
+ */
+enum Block {
+    BMOVE      = 0, // Move r<N> bytes from <ea:s> to <ea:d>. The blocks may overlap.
+    BFILL_B    = 1, // Fill r<N> elements at <ea:d> with <ea:s>
+    BFILL_W    = 2,
+    BFILL_L    = 3,
+    BFILL_Q    = 4,
+    BCMP       = 5, // Compare r<N> bytes at <ea:s> with <ea:d>, -1, 0 or 1 -> r<N>
+
+    BLKMAX_OPERATION
+};
+
 } // namespace
 #endif
@@ -0,0 +1,201 @@
+#ifndef MC64K_STANDARD_TEST_HOST_BLIT_AVX2_FUNCTIONS_HPP
+    #define MC64K_STANDARD_TEST_HOST_BLIT_AVX2_FUNCTIONS_HPP
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+#include <immintrin.h>
+#include <type_traits>
+#include <misc/scalar.hpp>
+#include <host/blit/generic/functions.hpp>
+
+/**
+ * AVX2 row kernels for the Blit library, with the same results as the generic ones. Rows are rarely aligned, so
+ * unaligned loads and stores are used throughout and the remainder of each row goes to the generic kernel. As with
+ * the Mem kernels, these are compiled for AVX2 regardless of the build target and must only be called when the host
+ * CPU supports it, see Host::CPU.
+ */
+#pragma GCC push_options
+#pragma GCC target("avx2")
+
+namespace MC64K::Host::Blit::AVX2 {
+
+/**
+ * Fills an AVX register with a pixel value, based on the pixel size
+ */
+template<typename T>
+inline __m256i splatPixel(T uValue) {
+    if constexpr(2 == sizeof(T)) {
+        return _mm256_set1_epi16((int16)uValue);
+    } else if constexpr(4 == sizeof(T)) {
+        return _mm256_set1_epi32((int32)uValue);
+    }
+    return _mm256_set1_epi8((int8)uValue);
+}
+
+/**
+ * Per pixel equality mask, based on the pixel size
+ */
+template<typename T>
+inline __m256i matchPixel(__m256i vPixels, __m256i vValue) {
+    if constexpr(2 == sizeof(T)) {
+        return _mm256_cmpeq_epi16(vPixels, vValue);
+    } else if constexpr(4 == sizeof(T)) {
+        return _mm256_cmpeq_epi32(vPixels, vValue);
+    }
+    return _mm256_cmpeq_epi8(vPixels, vValue);
+}
+
+/**
+ * Row fill
+ */
+template<typename T>
+void fill(T* pDestination, T uValue, uint32 uCount) {
+    static_assert(std::is_integral<T>::value, "Invalid type for fill<T>()");
+    constexpr uint32 PER_VECTOR = sizeof(__m256i) / sizeof(T);
+    __m256i vValue = splatPixel<T>(uValue);
+    for (; uCount >= PER_VECTOR; uCount -= PER_VECTOR, pDestination += PER_VECTOR) {
+        _mm256_storeu_si256((__m256i*)pDestination, vValue);
+    }
+    Generic::fill<T>(pDestination, uValue, uCount);
+}
+
+/**
+ * Row copy, skipping source pixels that match the key. The destination is read and written back in full, with the
+ * keyed pixels blended back in from it.
+ */
+template<typename T>
+void copyKey(T* pDestination, T const* pSource, uint32 uCount, T uKey) {
+    static_assert(std::is_integral<T>::value, "Invalid type for copyKey<T>()");
+    constexpr uint32 PER_VECTOR = sizeof(__m256i) / sizeof(T);
+    __m256i vKey = splatPixel<T>(uKey);
+    for (; uCount >= PER_VECTOR; uCount -= PER_VECTOR, pDestination += PER_VECTOR, pSource += PER_VECTOR) {
+        __m256i vSource      = _mm256_loadu_si256((__m256i const*)pSource);
+        __m256i vDestination = _mm256_loadu_si256((__m256i const*)pDestination);
+        __m256i vKeyed       = matchPixel<T>(vSource, vKey);
+        _mm256_storeu_si256((__m256i*)pDestination, _mm256_blendv_epi8(vSource, vDestination, vKeyed));
+    }
+    Generic::copyKey<T>(pDestination, pSource, uCount, uKey);
+}
+
+/**
+ * Row copy of 8-bit source pixels through a 256 entry table of destination pixels. The 32-bit table is gathered,
+ * the narrower ones would need a gather that reads beyond the end of the table and stay generic.
+ */
+template<typename T>
+void remap(T* pDestination, uint8 const* pSource, uint32 uCount, T const* pTable) {
+    static_assert(std::is_integral<T>::value, "Invalid type for remap<T>()");
+    if constexpr(4 == sizeof(T)) {
+        for (; uCount >= 8; uCount -= 8, pDestination += 8, pSource += 8) {
+            __m256i vIndex = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i const*)pSource));
+            _mm256_storeu_si256((__m256i*)pDestination, _mm256_i32gather_epi32((int const*)pTable, vIndex, 4));
+        }
+    }
+    Generic::remap<T>(pDestination, pSource, uCount, pTable);
+}
+
+/**
+ * Mix of 16-bit channel values, as Generic::mix()
+ */
+inline __m256i mix(__m256i vSource, __m256i vDestination, __m256i vAlpha, __m256i v255) {
+    __m256i vSum = _mm256_add_epi16(
+        _mm256_mullo_epi16(vSource, vAlpha),
+        _mm256_mullo_epi16(vDestination, _mm256_sub_epi16(v255, vAlpha))
+    );
+    return _mm256_srli_epi16(_mm256_add_epi16(vSum, v255), 8);
+}
+
+/**
+ * Row blend of ARGB pixels, 8 at a time. Each pixel is widened to four 16-bit channels with its alpha repeated
+ * alongside.
+ */
+inline void blendARGB32(uint32* pDestination, uint32 const* pSource, uint32 uCount, uint32 uAlpha) {
+    __m256i const vZero      = _mm256_setzero_si256();
+    __m256i const v255       = _mm256_set1_epi16(255);
+    __m256i const vRound     = _mm256_set1_epi32(255);
+    __m256i const vAlpha     = _mm256_set1_epi32((int32)uAlpha);
+    __m256i const vBroadcast = _mm256_setr_epi8(
+        0, 0, 0, 0, 4, 4, 4, 4, 8, 8, 8, 8, 12, 12, 12, 12,
+        0, 0, 0, 0, 4, 4, 4, 4, 8, 8, 8, 8, 12, 12, 12, 12
+    );
+    for (; uCount >= 8; uCount -= 8, pDestination += 8, pSource += 8) {
+        __m256i vSource      = _mm256_loadu_si256((__m256i const*)pSource);
+        __m256i vDestination = _mm256_loadu_si256((__m256i const*)pDestination);
+
+        // Per pixel alpha, scaled and copied to every byte of the pixel
+        __m256i vMix = _mm256_srli_epi32(
+            _mm256_add_epi32(_mm256_mullo_epi32(_mm256_srli_epi32(vSource, 24), vAlpha), vRound),
+            8
+        );
+        vMix = _mm256_shuffle_epi8(vMix, vBroadcast);
+
+        __m256i vLow = mix(
+            _mm256_unpacklo_epi8(vSource, vZero),
+            _mm256_unpacklo_epi8(vDestination, vZero),
+            _mm256_unpacklo_epi8(vMix, vZero),
+            v255
+        );
+        __m256i vHigh = mix(
+            _mm256_unpackhi_epi8(vSource, vZero),
+            _mm256_unpackhi_epi8(vDestination, vZero),
+            _mm256_unpackhi_epi8(vMix, vZero),
+            v255
+        );
+        _mm256_storeu_si256((__m256i*)pDestination, _mm256_packus_epi16(vLow, vHigh));
+    }
+    Generic::blendARGB32(pDestination, pSource, uCount, uAlpha);
+}
+
+/**
+ * Mix of one RGB 555 channel, in place in the 16-bit pixel
+ */
+template<int iShift>
+inline __m256i mixRGB555(__m256i vSource, __m256i vDestination, __m256i vAlpha, __m256i v255) {
+    __m256i const vMask = _mm256_set1_epi16(0x1F);
+    return _mm256_slli_epi16(
+        mix(
+            _mm256_and_si256(_mm256_srli_epi16(vSource, iShift), vMask),
+            _mm256_and_si256(_mm256_srli_epi16(vDestination, iShift), vMask),
+            vAlpha,
+            v255
+        ),
+        iShift
+    );
+}
+
+/**
+ * Row blend of RGB 555 pixels with a constant alpha, 16 at a time
+ */
+inline void blendRGB555(uint16* pDestination, uint16 const* pSource, uint32 uCount, uint32 uAlpha) {
+    __m256i const v255   = _mm256_set1_epi16(255);
+    __m256i const vAlpha = _mm256_set1_epi16((int16)uAlpha);
+    for (; uCount >= 16; uCount -= 16, pDestination += 16, pSource += 16) {
+        __m256i vSource      = _mm256_loadu_si256((__m256i const*)pSource);
+        __m256i vDestination = _mm256_loadu_si256((__m256i const*)pDestination);
+        __m256i vResult      = _mm256_or_si256(
+            _mm256_or_si256(
+                mixRGB555<0>(vSource, vDestination, vAlpha, v255),
+                mixRGB555<5>(vSource, vDestination, vAlpha, v255)
+            ),
+            mixRGB555<10>(vSource, vDestination, vAlpha, v255)
+        );
+        _mm256_storeu_si256((__m256i*)pDestination, vResult);
+    }
+    Generic::blendRGB555(pDestination, pSource, uCount, uAlpha);
+}
+
+} // namespace
+
+#pragma GCC pop_options
+
+#endif
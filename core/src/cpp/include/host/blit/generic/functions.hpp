@@ -0,0 +1,104 @@
+#ifndef MC64K_STANDARD_TEST_HOST_BLIT_GENERIC_FUNCTIONS_HPP
+    #define MC64K_STANDARD_TEST_HOST_BLIT_GENERIC_FUNCTIONS_HPP
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+#include <type_traits>
+#include <misc/scalar.hpp>
+
+/**
+ * Generic row kernels for the Blit library. Each processes a single row of uCount pixels, the caller handles the
+ * clipping and the stride. Source and destination rows must not overlap.
+ */
+namespace MC64K::Host::Blit::Generic {
+
+/**
+ * Weighted mix of two channel values by an alpha of 0-255. Exact at both ends of the alpha range and identical to
+ * the AVX2 version.
+ */
+inline uint32 mix(uint32 uSource, uint32 uDestination, uint32 uAlpha) {
+    return (uSource * uAlpha + uDestination * (255 - uAlpha) + 255) >> 8;
+}
+
+/**
+ * Row fill
+ */
+template<typename T>
+void fill(T* pDestination, T uValue, uint32 uCount) {
+    static_assert(std::is_integral<T>::value, "Invalid type for fill<T>()");
+    while (uCount--) {
+        *pDestination++ = uValue;
+    }
+}
+
+/**
+ * Row copy, skipping source pixels that match the key
+ */
+template<typename T>
+void copyKey(T* pDestination, T const* pSource, uint32 uCount, T uKey) {
+    static_assert(std::is_integral<T>::value, "Invalid type for copyKey<T>()");
+    while (uCount--) {
+        T uPixel = *pSource++;
+        if (uPixel != uKey) {
+            *pDestination = uPixel;
+        }
+        ++pDestination;
+    }
+}
+
+/**
+ * Row copy of 8-bit source pixels through a 256 entry table of destination pixels
+ */
+template<typename T>
+void remap(T* pDestination, uint8 const* pSource, uint32 uCount, T const* pTable) {
+    static_assert(std::is_integral<T>::value, "Invalid type for remap<T>()");
+    while (uCount--) {
+        *pDestination++ = pTable[*pSource++];
+    }
+}
+
+/**
+ * Row blend of ARGB pixels. The source alpha of each pixel is scaled by uAlpha, then all four channels are mixed.
+ */
+inline void blendARGB32(uint32* pDestination, uint32 const* pSource, uint32 uCount, uint32 uAlpha) {
+    while (uCount--) {
+        uint32 uSource      = *pSource++;
+        uint32 uDestination = *pDestination;
+        uint32 uMix         = ((uSource >> 24) * uAlpha + 255) >> 8;
+        uint32 uResult      = 0;
+        for (uint32 uShift = 0; uShift < 32; uShift += 8) {
+            uResult |= mix((uSource >> uShift) & 0xFF, (uDestination >> uShift) & 0xFF, uMix) << uShift;
+        }
+        *pDestination++ = uResult;
+    }
+}
+
+/**
+ * Row blend of RGB 555 pixels with a constant alpha. The unused top bit is cleared.
+ */
+inline void blendRGB555(uint16* pDestination, uint16 const* pSource, uint32 uCount, uint32 uAlpha) {
+    while (uCount--) {
+        uint32 uSource      = *pSource++;
+        uint32 uDestination = *pDestination;
+        uint32 uResult      = 0;
+        for (uint32 uShift = 0; uShift < 15; uShift += 5) {
+            uResult |= mix((uSource >> uShift) & 0x1F, (uDestination >> uShift) & 0x1F, uAlpha) << uShift;
+        }
+        *pDestination++ = (uint16)uResult;
+    }
+}
+
+} // namespace
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef MC64K_STANDARD_TEST_HOST_BLIT_KERNELS_HPP
+    #define MC64K_STANDARD_TEST_HOST_BLIT_KERNELS_HPP
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+#include <host/cpu.hpp>
+#include <host/blit/generic/functions.hpp>
+#include <host/blit/avx2/functions.hpp>
+
+namespace MC64K::Host::Blit {
+
+/**
+ * The row kernels for a given pixel size, selected the first time the pixel size is used. There is no blend for
+ * 8-bit pixels.
+ */
+template<typename T>
+struct Kernels {
+    typedef void (*Fill)(T* pDestination, T uValue, uint32 uCount);
+    typedef void (*CopyKey)(T* pDestination, T const* pSource, uint32 uCount, T uKey);
+    typedef void (*Remap)(T* pDestination, uint8 const* pSource, uint32 uCount, T const* pTable);
+    typedef void (*Blend)(T* pDestination, T const* pSource, uint32 uCount, uint32 uAlpha);
+
+    Fill    cFill;
+    CopyKey cCopyKey;
+    Remap   cRemap;
+    Blend   cBlend;
+
+    Kernels() : cBlend(nullptr) {
+        if (CPU::getLevel() >= CPU::AVX2) {
+            cFill    = AVX2::fill<T>;
+            cCopyKey = AVX2::copyKey<T>;
+            cRemap   = AVX2::remap<T>;
+            if constexpr (2 == sizeof(T)) {
+                cBlend = AVX2::blendRGB555;
+            } else if constexpr (4 == sizeof(T)) {
+                cBlend = AVX2::blendARGB32;
+            }
+        } else {
+            cFill    = Generic::fill<T>;
+            cCopyKey = Generic::copyKey<T>;
+            cRemap   = Generic::remap<T>;
+            if constexpr (2 == sizeof(T)) {
+                cBlend = Generic::blendRGB555;
+            } else if constexpr (4 == sizeof(T)) {
+                cBlend = Generic::blendARGB32;
+            }
+        }
+    }
+
+    static Kernels const& get() {
+        static Kernels const oKernels;
+        return oKernels;
+    }
+};
+
+} // namespace
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef MC64K_HOST_CPU_HPP
+    #define MC64K_HOST_CPU_HPP
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+/**
+ * Host CPU feature level, for selecting between the ISA specific variants of the SIMD sensitive kernels. The
+ * level is detected once, on first use, and can be lowered (but not raised) by setting MC64K_CPU_LEVEL in the
+ * environment to one of the level names. The override applies to the kernels dispatched on getLevel(), loops marked
+ * CPU_MULTIVERSION are always resolved for the detected level.
+ */
+namespace MC64K::Host::CPU {
+
+enum Level {
+    BASELINE = 0,
+    SSE4,
+    AVX2,
+    LEVEL_MAX
+};
+
+/**
+ * Returns the level the kernels are dispatched for
+ */
+Level getLevel();
+
+/**
+ * Returns the level the host CPU actually supports
+ */
+Level getDetectedLevel();
+
+/**
+ * Returns the name of a level
+ */
+char const* getLevelName(Level eLevel);
+
+} // namespace
+
+/**
+ * Marks a hot loop for compilation in one variant per level, with the variant chosen by the loader on the first
+ * call. Only needed when the build itself targets less than the highest level, otherwise it would just duplicate
+ * the same code.
+ */
+#if defined(__GNUC__) && defined(__x86_64__) && !defined(__AVX2__)
+    #define CPU_MULTIVERSION __attribute__((target_clones("avx2", "sse4.2", "default")))
+#else
+    #define CPU_MULTIVERSION
+#endif
+
+#endif
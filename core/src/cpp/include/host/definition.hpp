@@ -29,9 +29,35 @@ namespace MC64K::Host {
  */
 class Definition {
 
+    public:
+        /**
+         * Library
+         *
+         * A named host library. Each library occupies one HCF vector slot, in declaration order. The name is the
+         * dependency name a binary uses in its target information to declare that it requires the library. The
+         * optional native hooks are called by the runtime at startup, for libraries the binary can use, and on
+         * shutdown.
+         *
+         * A library may also provide a table of host calls indexed by function ID. Calls found there are made
+         * directly by the interpreter, skipping the HCF vector. Anything else still goes through the vector. The number
+         * of host calls is the count of function IDs the library implements, given with or without a table.
+         */
+        struct Library {
+            typedef void (*Hook)();
+
+            char const*                           sName;
+            Machine::Interpreter::HCFVector       cHCFVector;
+            Hook                                  cInit;
+            Hook                                  cDone;
+            Machine::Interpreter::HostCall const* pcHostCalls;
+            uint32                                uNumHostCalls;
+        };
+
     private:
         char const*                      sHostName;
         Machine::Interpreter::HCFVector* pcHCFVectors;
+        Machine::Interpreter::HostCall*  pcHostCalls;
+        Library*                         poLibraries;
         Loader::InitialisedSymbolSet     oExportSet;
         Loader::InitialisedSymbolSet     oImportSet;
         Misc::Version                    oVersion;
@@ -39,22 +65,22 @@ class Definition {
 
     public:
         /**
-         * Constructor. Uses a set of initializer_list for the vectors, export symbols and import symbols.
+         * Constructor. Uses a set of initializer_list for the libraries, export symbols and import symbols.
          * The data in these are copied to the instance internally and are not modified.
          *
          * Note that the free-form list initialisers may be subject to length limits. For example, if more than
-         * 256 HCFVectors are defined, the code will fail an assertion check.
+         * 256 libraries are defined, the code will fail an assertion check.
          *
          * @param char const* sName
          * @param Misc::Version const oVersion
-         * @param std::initializer_list<Machine::Interpreter::HCFVector> const& roHCFVectors,
+         * @param std::initializer_list<Library> const& roLibraries,
          * @param std::initializer_list<Loader::Symbol> const& roExportedSymbols,
          * @param std::initializer_list<Loader::Symbol> const& roImportedSymbols
          */
         Definition(
             char const* sName,
             Misc::Version const oVersion,
-            std::initializer_list<Machine::Interpreter::HCFVector> const& roHCFVectors,
+            std::initializer_list<Library> const& roLibraries,
             std::initializer_list<Loader::Symbol> const& roExportedSymbols,
             std::initializer_list<Loader::Symbol> const& roImportedSymbols
         );
@@ -107,12 +133,39 @@ class Definition {
             return pcHCFVectors;
         }
 
+        /**
+         * Get the flat host call table. There are Machine::Limits::HOST_CALLS_PER_VECTOR entries per HCF vector,
+         * with null entries for any function not in the library's host call table.
+         *
+         * @return Machine::Interpreter::HostCall const*
+         */
+        Machine::Interpreter::HostCall const* getHostCalls() const {
+            return pcHostCalls;
+        }
+
         /**
          * @return uint32
          */
         uint32 getNumHCFVectors() const {
             return uNumHCFVectors;
         }
+
+        /**
+         * Get the library table. There is one entry per HCF vector, in the same order.
+         *
+         * @return Library const*
+         */
+        Library const* getLibraries() const {
+            return poLibraries;
+        }
+
+        /**
+         * Find the HCF vector slot of a library by dependency name.
+         *
+         * @param  char const* sName
+         * @return int32 - slot number, or -1 if the name is not known
+         */
+        int32 findLibrary(char const* sName) const;
 };
 
 } // namespace
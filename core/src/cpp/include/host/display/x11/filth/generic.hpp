@@ -16,6 +16,7 @@
 
 #include <host/standard_test_host_display.hpp>
 #include <host/display/x11/raii.hpp>
+#include <host/cpu.hpp>
 
 #include "conversion.hpp"
 
@@ -40,7 +41,7 @@ namespace MC64K::StandardTestHost::Display::x11 {
  * C is expected to be one of the conversion classes
  */
 template<class Conversion>
-void* updatePalettedViewModified(Context& roContext) {
+CPU_MULTIVERSION void* updatePalettedViewModified(Context& roContext) {
 
 
     if (typename Conversion::Pixel const* puPalette = roContext.oPaletteData.as<typename Conversion::Pixel const>()) {
@@ -127,7 +128,7 @@ void* updatePalettedViewModified(Context& roContext) {
  * Format is expected to be an integer type
  */
 template<typename Format>
-void* updateRGBViewModified(Context& roContext) {
+CPU_MULTIVERSION void* updateRGBViewModified(Context& roContext) {
 
     typename Format::Pixel* pDst = (typename Format::Pixel*)roContext.puImageBuffer;
     typename Format::Pixel const* pBaseSrc = roContext.oDisplayBuffer.as<typename Format::Pixel const>();
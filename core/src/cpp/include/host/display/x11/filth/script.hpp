@@ -16,6 +16,7 @@
 
 #include <host/standard_test_host_display.hpp>
 #include <host/display/x11/raii.hpp>
+#include <host/cpu.hpp>
 
 #include "conversion.hpp"
 
@@ -78,7 +79,7 @@ inline size_t subFromImmediate(uint8 const* puCode, uint8* puBase) {
  * offsets, etc. according to the beam location.
  */
 template<typename Conversion>
-void* updatePalettedScripted(Context& roContext) {
+CPU_MULTIVERSION void* updatePalettedScripted(Context& roContext) {
 
     if (typename Conversion::Pixel* puPalette = roContext.oPaletteData.as<typename Conversion::Pixel>()) {
         typename Conversion::Pixel* pDst      = (typename Conversion::Pixel*)roContext.puImageBuffer;
@@ -148,7 +149,7 @@ void* updatePalettedScripted(Context& roContext) {
  * offsets, etc. according to the beam location.
  */
 template<typename Format>
-void* updateRGBScripted(Context& roContext) {
+CPU_MULTIVERSION void* updateRGBScripted(Context& roContext) {
     typename Format::Pixel*       pDst = (typename Format::Pixel*)roContext.puImageBuffer;
     typename Format::Pixel const* pSrc = roContext.oDisplayBuffer.as<typename Format::Pixel const>();
     uint8* puCode       = roContext.puFilthScript;
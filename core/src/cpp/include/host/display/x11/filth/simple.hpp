@@ -16,6 +16,7 @@
 
 #include <host/standard_test_host_display.hpp>
 #include <host/display/x11/raii.hpp>
+#include <host/cpu.hpp>
 
 #include "conversion.hpp"
 
@@ -46,7 +47,7 @@ namespace MC64K::StandardTestHost::Display::x11 {
  * Conversion is a valid 8-bit to RGB Conversion template, e.g. PaletteTo32Bit<Format::ARGB32> etc
  */
 template<typename Conversion>
-void* updatePaletted(Context& roContext) {
+CPU_MULTIVERSION void* updatePaletted(Context& roContext) {
 
     // Just expand out the palette to the target
     if (typename Conversion::Pixel const* puPalette = roContext.oPaletteData.as<typename Conversion::Pixel const>()) {
@@ -19,6 +19,7 @@
 #include <cstring>
 #include <ctime>
 #include <new>
+#include <host/memory.hpp>
 #include <host/standard_test_host_mem.hpp>
 #include <host/standard_test_host_display.hpp>
 #include <host/display/context.hpp>
@@ -149,7 +150,7 @@ Context::Context(): Display::Context(), puData(nullptr), puImageBuffer(nullptr)
 
 Context::~Context() {
     if (puData) {
-        delete[] puData;
+        Host::Memory::Arena::release(puData);
         std::fprintf(stderr, "X11Context RAII: Freed Buffers\n");
     }
 }
@@ -0,0 +1,112 @@
+#ifndef MC64K_HOST_FRAME_ARENA_HPP
+    #define MC64K_HOST_FRAME_ARENA_HPP
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+#include <misc/scalar.hpp>
+
+namespace MC64K::Host::Memory {
+
+/**
+ * FrameArena
+ *
+ * Fixed capacity bump allocator for data that is discarded all at once, typically at the end of a frame. The arena
+ * is a single block from the Arena with this header at the start. Allocation moves a pointer and reset moves it
+ * back, individual allocations are never freed.
+ *
+ * Optional checks, chosen when the arena is created:
+ *
+ *     GUARD   Each allocation is followed by a guard pattern. The guards are checked on reset and destroy and any
+ *             overrun is reported.
+ *     POISON  New allocations are filled with ALLOC_POISON and released ones with FREE_POISON, so that reads of
+ *             uninitialised or stale data stand out.
+ *
+ * Once a guard has been found overwritten the records after it cannot be trusted, so the arena is marked corrupt and
+ * every later reset or destroy reports CORRUPT without walking it again.
+ *
+ * Either takes allocation off the fast path and makes reset proportional to what was allocated, so they are meant
+ * for debugging.
+ */
+class FrameArena {
+    public:
+        enum Flag {
+            GUARD     = 1,
+            POISON    = 2,
+            FLAGS_ALL = GUARD | POISON,
+
+            // Internal, set when check() finds an overrun
+            CORRUPTED = 0x80000000
+        };
+
+        enum Result {
+            SUCCESS = 0,
+            INVALID_ARENA,
+            CORRUPT
+        };
+
+        enum {
+            ALLOC_POISON  = 0xCD,
+            FREE_POISON   = 0xDD,
+            GUARD_BYTE    = 0xFD,
+            GUARD_SIZE    = 16,
+            DEFAULT_ALIGN = 16,
+            MAX_ALIGN     = 4096
+        };
+
+    private:
+        uint64 uMagic;
+        uint8* puBase;
+        uint8* puNext;
+        uint8* puTop;
+        uint32 uFlags;
+
+        static uint64 getMagic(FrameArena const* poArena);
+
+        void*  allocateChecked(uint64 uSize, uint64 uAlign);
+        Result check();
+        Result corrupted(char const* sWhat, uint8 const* puBlock);
+
+    public:
+        /** Create an arena of at least the requested capacity. Null on failure */
+        static FrameArena* create(uint64 uCapacity, uint32 uFlags);
+
+        /** Destroy an arena. Reports any corruption first */
+        static Result destroy(FrameArena* poArena);
+
+        /** Check that a raw address from the VM really references a live arena */
+        static Result validate(void const* pRawArena);
+
+        /**
+         * Allocate a block. The alignment must be a power of two no larger than MAX_ALIGN. Null when the arena is
+         * full.
+         */
+        void* allocate(uint64 uSize, uint64 uAlign) {
+            if (uFlags) {
+                return allocateChecked(uSize, uAlign);
+            }
+            uint8* puBlock = (uint8*)(((uint64)puNext + uAlign - 1) & ~(uAlign - 1));
+            if (puBlock > puTop || uSize > (uint64)(puTop - puBlock)) {
+                return nullptr;
+            }
+            puNext = puBlock + uSize;
+            return puBlock;
+        }
+
+        /** Release every allocation */
+        Result reset();
+};
+
+} // namespace
+
+#endif
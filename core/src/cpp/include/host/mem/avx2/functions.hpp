@@ -14,16 +14,20 @@
  *    - 64-bit 680x0-inspired Virtual Machine and assembler -
  */
 
-#ifndef __AVX2__
-    #error "This header can only be used in builds supporting AVX2"
-#endif
-
+#include <cstring>
 #include <immintrin.h>
 #include <type_traits>
 #include <misc/scalar.hpp>
 #include <host/memory.hpp>
 
-namespace MC64K::Host::Memory {
+/**
+ * AVX2 versions. These are compiled for AVX2 regardless of the build target so that a baseline build still carries
+ * them. Nothing here may be called unless the host CPU supports AVX2, see Host::CPU.
+ */
+#pragma GCC push_options
+#pragma GCC target("avx2")
+
+namespace MC64K::Host::Memory::AVX2 {
 
 enum {
     // Tuning factor that controls how many vectors worth of data there is before
@@ -236,5 +240,140 @@ void bitwiseXor(void* pBuffer, T uValue, uint64 uSize) {
     }
 }
 
+
+/**
+ * Helper function. Returns the byte shuffle that reverses each word of a given integer size within an AVX register.
+ */
+template<typename T>
+inline __m256i swapMask() {
+    static_assert(std::is_integral<T>::value, "Invalid type for swapMask<T>()");
+    if constexpr(2 == sizeof(T)) {
+        return _mm256_setr_epi8(
+            1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+            1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14
+        );
+    } else if constexpr(4 == sizeof(T)) {
+        return _mm256_setr_epi8(
+            3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+            3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12
+        );
+    }
+    return _mm256_setr_epi8(
+        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8
+    );
+}
+
+/**
+ * Helper function. Compares each word of an AVX register with a splatted value, returning the byte mask of matches.
+ */
+template<typename T>
+inline uint32 matchMask(__m256i vData, __m256i vValue) {
+    if constexpr(2 == sizeof(T)) {
+        return (uint32)_mm256_movemask_epi8(_mm256_cmpeq_epi16(vData, vValue));
+    } else if constexpr(4 == sizeof(T)) {
+        return (uint32)_mm256_movemask_epi8(_mm256_cmpeq_epi32(vData, vValue));
+    }
+    return (uint32)_mm256_movemask_epi8(_mm256_cmpeq_epi64(vData, vValue));
+}
+
+/**
+ * Block byteswap. Source and destination need not have the same alignment, so unaligned access is used.
+ * Addresses will be aligned and the count reduced by one or two if necessary.
+ * Caller bears responsibility for ensuring a non-zero size.
+ */
+template<typename T>
+void byteswap(void* pDestination, void const* pSource, uint64 uCount) {
+    static_assert(std::is_integral<T>::value, "Invalid type for byteswap<T>()");
+    T* pDstWord = (T*)__builtin_assume_aligned(
+        alignBlockOf<T>(pDestination, uCount),
+        sizeof(T)
+    );
+    if (!uCount) {
+        return;
+    }
+    T const* pSrcWord = (T const*)__builtin_assume_aligned(
+        alignBlockOf<T>(pSource, uCount),
+        sizeof(T)
+    );
+
+    uint64 const uPerVector = sizeof(__m256i) / sizeof(T);
+    if (sizeof(T) > 1 && uCount > MIN_VECTOR_SIZE_FACTOR * uPerVector) {
+        __m256i vMask = swapMask<T>();
+        for (; uCount >= uPerVector; uCount -= uPerVector) {
+            __m256i vData = _mm256_loadu_si256((__m256i const*)pSrcWord);
+            _mm256_storeu_si256((__m256i*)pDstWord, _mm256_shuffle_epi8(vData, vMask));
+            pSrcWord += uPerVector;
+            pDstWord += uPerVector;
+        }
+    }
+    while (uCount--) {
+        T uWord = *pSrcWord++;
+        if constexpr(2 == sizeof(T)) {
+            *pDstWord++ = __builtin_bswap16(uWord);
+        } else if constexpr(4 == sizeof(T)) {
+            *pDstWord++ = __builtin_bswap32(uWord);
+        } else if constexpr(8 == sizeof(T)) {
+            *pDstWord++ = __builtin_bswap64(uWord);
+        } else {
+            *pDstWord++ = uWord;
+        }
+    }
+}
+
+/**
+ * Block search. Returns the address of the first matching word, or null.
+ */
+template<typename T>
+T const* find(void const* pBuffer, T uValue, uint64 uSize) {
+    static_assert(std::is_integral<T>::value, "Invalid type for find<T>()");
+    if constexpr(1 == sizeof(T)) {
+        return (T const*)std::memchr(pBuffer, (int)uValue, uSize);
+    } else {
+        T const* p = (T const*)__builtin_assume_aligned(alignBlockOf<T>(pBuffer, uSize), sizeof(T));
+        T const* pFinal = p + uSize;
+
+        if (uSize > (MIN_VECTOR_SIZE_FACTOR * sizeof(__m256i)/sizeof(T)) ) {
+            T const* pAlignedBot = (T const*)(
+                (((uint64)p) + sizeof(__m256i) - 1) &
+                ~(sizeof(__m256i) - 1)
+            );
+
+            // do the misaligned lead in
+            while (p < pAlignedBot) {
+                if (uValue == *p) {
+                    return p;
+                }
+                ++p;
+            }
+
+            __m256i const* pAlignedTop = (__m256i const*)(
+                (((uint64)pFinal)) &
+                ~(sizeof(__m256i) - 1)
+            );
+            __m256i vValue = splatInt<T>(uValue);
+            __m256i const* pviData = (__m256i const*)p;
+            for (; pviData < pAlignedTop; pviData++) {
+                if (uint32 uMatch = matchMask<T>(_mm256_load_si256(pviData), vValue)) {
+                    return (T const*)pviData + (__builtin_ctz(uMatch) / sizeof(T));
+                }
+            }
+
+            // do the misaligned tail
+            p = (T const*)pAlignedTop;
+        }
+        while (p < pFinal) {
+            if (uValue == *p) {
+                return p;
+            }
+            ++p;
+        }
+        return 0;
+    }
+}
+
 } // namespace
+
+#pragma GCC pop_options
+
 #endif
@@ -18,7 +18,7 @@
 #include <misc/scalar.hpp>
 #include <host/memory.hpp>
 
-namespace MC64K::Host::Memory {
+namespace MC64K::Host::Memory::Generic {
 
 template<typename T>
 T const* find(void const* pBuffer, T uValue, uint64 uSize) {
@@ -20,7 +20,7 @@
 /**
  * Naive generic versions
  */
-namespace MC64K::Host::Memory {
+namespace MC64K::Host::Memory::Generic {
 
 /**
  * Block memory fill generic (naive)
@@ -17,7 +17,7 @@
 #include <misc/scalar.hpp>
 #include <host/memory.hpp>
 
-namespace MC64K::Host::Memory {
+namespace MC64K::Host::Memory::Generic {
 
 template<typename T>
 inline T swapWord(T iValue) {
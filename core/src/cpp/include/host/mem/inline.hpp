@@ -26,66 +26,59 @@
 namespace MC64K::StandardTestHost::Mem {
 
 /**
- * Provides a simple compile time checked template for the memory fill group.
+ * Provides a simple compile time checked template for the memory fill group. These and the byteswap group are
+ * native signatures, bound to the ABI registers by ABI::call<>.
  */
 template<typename T>
-inline void fillBlock() {
+inline uint64 fillBlock(void* pBuffer, T uValue, uint64 uSize) {
     static_assert(std::is_integral<T>::value, "Invalid type for fillBlock<T>()");
-    if (uint64 uSize = Interpreter::gpr<ABI::INT_REG_1>().uQuad) {
-        if (void* pBuffer = Interpreter::gpr<ABI::PTR_REG_0>().pAny) {
-            Host::Memory::fill<T>(pBuffer, Interpreter::gpr<ABI::INT_REG_0>().value<T>(), uSize);
-            Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_NONE;
-        } else {
-            Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_NULL_PTR;
-        }
-    } else {
-        Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_BAD_SIZE;
+    if (!uSize) {
+        return ABI::ERR_BAD_SIZE;
+    }
+    if (!pBuffer) {
+        return ABI::ERR_NULL_PTR;
     }
+    Host::Memory::fill<T>(pBuffer, uValue, uSize);
+    return ABI::ERR_NONE;
 }
 
 template<typename T>
-inline void andBlock() {
+inline uint64 andBlock(void* pBuffer, T uValue, uint64 uSize) {
     static_assert(std::is_integral<T>::value, "Invalid type for andBlock<T>()");
-    if (uint64 uSize = Interpreter::gpr<ABI::INT_REG_1>().uQuad) {
-        if (void* pBuffer = Interpreter::gpr<ABI::PTR_REG_0>().pAny) {
-            Host::Memory::bitwiseAnd<T>(pBuffer, Interpreter::gpr<ABI::INT_REG_0>().value<T>(), uSize);
-            Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_NONE;
-        } else {
-            Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_NULL_PTR;
-        }
-    } else {
-        Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_BAD_SIZE;
+    if (!uSize) {
+        return ABI::ERR_BAD_SIZE;
     }
+    if (!pBuffer) {
+        return ABI::ERR_NULL_PTR;
+    }
+    Host::Memory::bitwiseAnd<T>(pBuffer, uValue, uSize);
+    return ABI::ERR_NONE;
 }
 
 template<typename T>
-inline void orBlock() {
+inline uint64 orBlock(void* pBuffer, T uValue, uint64 uSize) {
     static_assert(std::is_integral<T>::value, "Invalid type for orBlock<T>()");
-    if (uint64 uSize = Interpreter::gpr<ABI::INT_REG_1>().uQuad) {
-        if (void* pBuffer = Interpreter::gpr<ABI::PTR_REG_0>().pAny) {
-            Host::Memory::bitwiseOr<T>(pBuffer, Interpreter::gpr<ABI::INT_REG_0>().value<T>(), uSize);
-            Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_NONE;
-        } else {
-            Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_NULL_PTR;
-        }
-    } else {
-        Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_BAD_SIZE;
+    if (!uSize) {
+        return ABI::ERR_BAD_SIZE;
+    }
+    if (!pBuffer) {
+        return ABI::ERR_NULL_PTR;
     }
+    Host::Memory::bitwiseOr<T>(pBuffer, uValue, uSize);
+    return ABI::ERR_NONE;
 }
 
 template<typename T>
-inline void eorBlock() {
+inline uint64 eorBlock(void* pBuffer, T uValue, uint64 uSize) {
     static_assert(std::is_integral<T>::value, "Invalid type for eorBlock<T>()");
-    if (uint64 uSize = Interpreter::gpr<ABI::INT_REG_1>().uQuad) {
-        if (void* pBuffer = Interpreter::gpr<ABI::PTR_REG_0>().pAny) {
-            Host::Memory::bitwiseXor<T>(pBuffer, Interpreter::gpr<ABI::INT_REG_0>().value<T>(), uSize);
-            Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_NONE;
-        } else {
-            Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_NULL_PTR;
-        }
-    } else {
-        Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_BAD_SIZE;
+    if (!uSize) {
+        return ABI::ERR_BAD_SIZE;
+    }
+    if (!pBuffer) {
+        return ABI::ERR_NULL_PTR;
     }
+    Host::Memory::bitwiseXor<T>(pBuffer, uValue, uSize);
+    return ABI::ERR_NONE;
 }
 
 
@@ -93,22 +86,17 @@ inline void eorBlock() {
  * Provides a simple compile time checked template for the memory byteswap group.
  */
 template<typename T>
-inline void swapBlock() {
+inline uint64 swapBlock(void const* pFrom, void* pTo, uint64 uSize) {
     static_assert(std::is_integral<T>::value, "Invalid type for swapBlock<T>()");
     static_assert(1 < sizeof(T), "Invalid size for byteswap<T>()");
-
-    if (uint64 uSize = Interpreter::gpr<ABI::INT_REG_0>().uQuad) {
-        void* pFrom  = Interpreter::gpr<ABI::PTR_REG_0>().pAny;
-        void* pTo    = Interpreter::gpr<ABI::PTR_REG_1>().pAny;
-        if (pFrom && pTo) {
-            Host::Memory::byteswap<T>(pTo, pFrom, uSize);
-            Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_NONE;
-        } else {
-            Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_NULL_PTR;
-        }
-    } else {
-        Interpreter::gpr<ABI::INT_REG_0>().uQuad = ABI::ERR_BAD_SIZE;
+    if (!uSize) {
+        return ABI::ERR_BAD_SIZE;
+    }
+    if (!pFrom || !pTo) {
+        return ABI::ERR_NULL_PTR;
     }
+    Host::Memory::byteswap<T>(pTo, pFrom, uSize);
+    return ABI::ERR_NONE;
 }
 
 /**
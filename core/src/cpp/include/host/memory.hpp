@@ -74,6 +74,37 @@ class ElementBuffer {
         Result free(void* pElement);
 };
 
+/**
+ * Guest memory arena. Backing store for the large guest working sets (stack, Mem allocations, element buffers and
+ * framebuffers). Opt in by setting MC64K_HUGE_PAGES in the environment, otherwise everything comes from the usual
+ * heap as before.
+ *
+ * When enabled, blocks of at least BLOCK_THRESHOLD bytes are mapped directly, rounded and aligned to the huge page
+ * size. Explicit huge pages (MAP_HUGETLB) are tried first and transparent huge pages are requested when none are
+ * reserved. The stack is mapped with an inaccessible guard page at each end so that an overflow faults instead of
+ * corrupting the heap.
+ */
+class Arena {
+    public:
+        enum {
+            HUGE_PAGE_SIZE  = 2 << 20,
+            HUGE_PAGE_MASK  = HUGE_PAGE_SIZE - 1,
+            BLOCK_THRESHOLD = HUGE_PAGE_SIZE / 2
+        };
+
+        /** Returns true when the arena has been opted in to */
+        static bool isEnabled();
+
+        /** Allocate a block. Optionally cleared, mapped blocks always are. Null on failure */
+        static void* allocate(uint64 uSize, bool bClear = false);
+
+        /** Allocate a cleared stack, guarded when enabled. Null on failure */
+        static void* allocateStack(uint64 uSize);
+
+        /** Release a block from allocate() or allocateStack(). Null is ignored */
+        static void release(void* pBlock);
+};
+
 
 inline void copy(void* pDestination, void const* pSource, uint64 uSize) {
     std::memcpy(pDestination, pSource, uSize);
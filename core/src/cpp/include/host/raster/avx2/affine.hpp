@@ -0,0 +1,116 @@
+#ifndef MC64K_STANDARD_TEST_HOST_RASTER_AVX2_AFFINE_HPP
+    #define MC64K_STANDARD_TEST_HOST_RASTER_AVX2_AFFINE_HPP
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+#include <immintrin.h>
+#include <misc/scalar.hpp>
+#include <host/raster/texels.hpp>
+#include <host/raster/generic/affine.hpp>
+
+/**
+ * AVX2 affine texture mapping row kernel, with the same results as the generic one. Only 32-bit texels are gathered,
+ * a gather of narrower texels would read beyond the end of the texture. Compiled for AVX2 regardless of the build
+ * target and only to be called when the host CPU supports it, see Host::CPU.
+ */
+#pragma GCC push_options
+#pragma GCC target("avx2")
+
+namespace MC64K::Host::Raster::AVX2 {
+
+/**
+ * As Generic::affine(), 8 pixels at a time
+ */
+template<unsigned uWrap, bool bKey>
+void affine(
+    uint32*               pDestination,
+    uint32                uCount,
+    uint32                uU,
+    uint32                uV,
+    uint32                uDU,
+    uint32                uDV,
+    Texels<uint32> const& roTexels,
+    uint32                uKey
+) {
+    __m256i const vLane   = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i const vStride = _mm256_set1_epi32((int32)(roTexels.uStride / sizeof(uint32)));
+    __m256i const vMaskU  = _mm256_set1_epi32((int32)roTexels.uMaskU);
+    __m256i const vMaskV  = _mm256_set1_epi32((int32)roTexels.uMaskV);
+    __m256i const vWidth  = _mm256_set1_epi32(roTexels.iWidth);
+    __m256i const vHeight = _mm256_set1_epi32(roTexels.iHeight);
+    __m256i const vLastU  = _mm256_set1_epi32(roTexels.iWidth - 1);
+    __m256i const vLastV  = _mm256_set1_epi32(roTexels.iHeight - 1);
+    __m256i const vZero   = _mm256_setzero_si256();
+    __m256i const vNone   = _mm256_set1_epi32(-1);
+    __m256i const vKey    = _mm256_set1_epi32((int32)uKey);
+    __m256i const vStepU  = _mm256_set1_epi32((int32)(uDU * 8));
+    __m256i const vStepV  = _mm256_set1_epi32((int32)(uDV * 8));
+    __m256i vU = _mm256_add_epi32(_mm256_set1_epi32((int32)uU), _mm256_mullo_epi32(vLane, _mm256_set1_epi32((int32)uDU)));
+    __m256i vV = _mm256_add_epi32(_mm256_set1_epi32((int32)uV), _mm256_mullo_epi32(vLane, _mm256_set1_epi32((int32)uDV)));
+    int const* piTexels = (int const*)roTexels.puTexels;
+
+    uint32 uVectors = uCount >> 3;
+    for (uint32 u = 0; u < uVectors; ++u, pDestination += 8) {
+        __m256i vX, vY;
+        __m256i vDraw = vNone;
+        if constexpr (WRAP_REPEAT == uWrap) {
+            vX = _mm256_and_si256(_mm256_srli_epi32(vU, 16), vMaskU);
+            vY = _mm256_and_si256(_mm256_srli_epi32(vV, 16), vMaskV);
+        } else {
+            vX = _mm256_srai_epi32(vU, 16);
+            vY = _mm256_srai_epi32(vV, 16);
+            if constexpr (WRAP_CLAMP == uWrap) {
+                vX = _mm256_min_epi32(_mm256_max_epi32(vX, vZero), vLastU);
+                vY = _mm256_min_epi32(_mm256_max_epi32(vY, vZero), vLastV);
+            } else {
+                // Inside when 0 <= x < width and 0 <= y < height
+                vDraw = _mm256_and_si256(
+                    _mm256_and_si256(_mm256_cmpgt_epi32(vX, vNone), _mm256_cmpgt_epi32(vY, vNone)),
+                    _mm256_and_si256(_mm256_cmpgt_epi32(vWidth, vX), _mm256_cmpgt_epi32(vHeight, vY))
+                );
+            }
+        }
+        __m256i vIndex = _mm256_add_epi32(_mm256_mullo_epi32(vY, vStride), vX);
+        if constexpr (bKey || WRAP_NONE == uWrap) {
+            // Only the texels to be drawn are gathered, the rest keep the destination
+            __m256i vDestination = _mm256_loadu_si256((__m256i const*)pDestination);
+            __m256i vTexel       = _mm256_mask_i32gather_epi32(vDestination, piTexels, vIndex, vDraw, 4);
+            if constexpr (bKey) {
+                vTexel = _mm256_blendv_epi8(vTexel, vDestination, _mm256_cmpeq_epi32(vTexel, vKey));
+            }
+            _mm256_storeu_si256((__m256i*)pDestination, vTexel);
+        } else {
+            _mm256_storeu_si256((__m256i*)pDestination, _mm256_i32gather_epi32(piTexels, vIndex, 4));
+        }
+        vU = _mm256_add_epi32(vU, vStepU);
+        vV = _mm256_add_epi32(vV, vStepV);
+    }
+    uVectors <<= 3;
+    Generic::affine<uint32, uWrap, bKey>(
+        pDestination,
+        uCount - uVectors,
+        uU + uVectors * uDU,
+        uV + uVectors * uDV,
+        uDU,
+        uDV,
+        roTexels,
+        uKey
+    );
+}
+
+} // namespace
+
+#pragma GCC pop_options
+
+#endif
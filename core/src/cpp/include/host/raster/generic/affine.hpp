@@ -0,0 +1,65 @@
+#ifndef MC64K_STANDARD_TEST_HOST_RASTER_GENERIC_AFFINE_HPP
+    #define MC64K_STANDARD_TEST_HOST_RASTER_GENERIC_AFFINE_HPP
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+#include <algorithm>
+#include <misc/scalar.hpp>
+#include <host/raster/texels.hpp>
+
+/**
+ * Generic affine texture mapping row kernel
+ */
+namespace MC64K::Host::Raster::Generic {
+
+/**
+ * Draws a row of uCount pixels, starting at texel coordinate uU, uV and stepping by uDU, uDV per pixel, all in 16.16
+ * fixed point. For WRAP_CLAMP and WRAP_NONE the coordinates are signed and the caller ensures that they do not
+ * overflow along the row. With bKey, texels equal to uKey are not drawn.
+ */
+template<typename T, unsigned uWrap, bool bKey>
+void affine(
+    T*               pDestination,
+    uint32           uCount,
+    uint32           uU,
+    uint32           uV,
+    uint32           uDU,
+    uint32           uDV,
+    Texels<T> const& roTexels,
+    T                uKey
+) {
+    for (; uCount--; ++pDestination, uU += uDU, uV += uDV) {
+        T uTexel;
+        if constexpr (WRAP_REPEAT == uWrap) {
+            uTexel = roTexels.fetch(uU, uV);
+        } else {
+            int32 iU = (int32)uU >> 16;
+            int32 iV = (int32)uV >> 16;
+            if constexpr (WRAP_CLAMP == uWrap) {
+                iU = std::clamp(iU, 0, roTexels.iWidth  - 1);
+                iV = std::clamp(iV, 0, roTexels.iHeight - 1);
+            } else if (iU < 0 || iU >= roTexels.iWidth || iV < 0 || iV >= roTexels.iHeight) {
+                continue;
+            }
+            uTexel = roTexels.row((uint32)iV)[iU];
+        }
+        if (!bKey || uTexel != uKey) {
+            *pDestination = uTexel;
+        }
+    }
+}
+
+} // namespace
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef MC64K_STANDARD_TEST_HOST_RASTER_TEXELS_HPP
+    #define MC64K_STANDARD_TEST_HOST_RASTER_TEXELS_HPP
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+#include <misc/scalar.hpp>
+
+namespace MC64K::Host::Raster {
+
+/**
+ * How texel coordinates outside the texture are treated
+ */
+enum Wrap {
+    WRAP_REPEAT = 0, // Coordinates wrap, power of two textures only
+    WRAP_CLAMP,      // Coordinates are clamped to the edge texels
+    WRAP_NONE,       // Pixels outside the texture are not drawn
+    WRAP_MAX
+};
+
+/**
+ * Validated texture. Texel coordinates are 16.16 fixed point.
+ */
+template<typename T>
+struct Texels {
+    uint8 const* puTexels;
+    uint64       uStride;
+    uint32       uMaskU;
+    uint32       uMaskV;
+    int32        iWidth;
+    int32        iHeight;
+    float32      fWidth;
+    float32      fHeight;
+
+    T const* row(uint32 uV) const {
+        return (T const*)(puTexels + uV * uStride);
+    }
+
+    /**
+     * Wrapped fetch, for power of two textures
+     */
+    T fetch(uint32 uU, uint32 uV) const {
+        return row((uV >> 16) & uMaskV)[(uU >> 16) & uMaskU];
+    }
+};
+
+} // namespace
+
+#endif
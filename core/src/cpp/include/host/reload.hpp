@@ -0,0 +1,91 @@
+#ifndef MC64K_HOST_RELOAD_HPP
+    #define MC64K_HOST_RELOAD_HPP
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+#include <atomic>
+#include <thread>
+#include <loader/executable.hpp>
+#include "definition.hpp"
+
+namespace MC64K::Host {
+
+/**
+ * BinaryWatcher
+ *
+ * Watches a binary on disk and, whenever it is rewritten, loads a fresh Executable for it on a background thread.
+ * The most recently loaded Executable is held until the owner takes it. Loading only reads the binary and checks
+ * its imports, nothing shared with the interpreter is touched; linking the host imports against the new exports is
+ * left to the owner, on its own thread, if it adopts the new Executable.
+ */
+class BinaryWatcher {
+    private:
+        Definition const&                        roDefinition;
+        char const*                              sBinaryPath;
+        char const*                              sBinaryName;
+        std::atomic<Loader::Executable*>         poPending;
+        std::atomic<bool>                        bStop;
+        std::thread                              oThread;
+        int                                      iNotifyFD;
+
+        /**
+         * Watcher thread body.
+         */
+        void watch();
+
+        /**
+         * Load the binary and publish it as pending, replacing any pending one not yet taken.
+         */
+        void reload();
+
+    public:
+        /**
+         * Constructor. Starts watching immediately.
+         *
+         * @param  Definition const& roDefinition
+         * @param  char const*       sBinaryPath
+         * @throws MC64K::Exception
+         */
+        BinaryWatcher(Definition const& roDefinition, char const* sBinaryPath);
+
+        /**
+         * Destructor. Stops the watcher thread and discards any pending Executable.
+         */
+        ~BinaryWatcher();
+
+        BinaryWatcher(BinaryWatcher const&) = delete;
+        BinaryWatcher& operator=(BinaryWatcher const&) = delete;
+
+        /**
+         * Cheap check for a newly loaded Executable.
+         *
+         * @return bool
+         */
+        bool hasPending() const {
+            return poPending.load(std::memory_order_relaxed) != 0;
+        }
+
+        /**
+         * Take ownership of the newly loaded Executable, if any.
+         *
+         * @return Loader::Executable*
+         */
+        Loader::Executable* takePending() {
+            return poPending.exchange(0, std::memory_order_acquire);
+        }
+};
+
+} // namespace
+
+#endif
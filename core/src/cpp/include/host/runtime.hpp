@@ -13,23 +13,113 @@
  *
  *    - 64-bit 680x0-inspired Virtual Machine and assembler -
  */
+#include <vector>
+#include <machine/limits.hpp>
+#include <machine/timing.hpp>
+#include <machine/verifier.hpp>
 #include "definition.hpp"
+#include "reload.hpp"
 
 namespace MC64K::Host {
 
 /**
  * Runtime
+ *
+ * Only the host libraries a binary declares in its dependency table are initialised and made available to it.
+ * Binaries that declare no libraries at all get every library, as before. Undeclared libraries are never
+ * initialised and calls to them fail with UNKNOWN_HOST_CALL.
+ *
+ * The bytecode is verified before it is run, see Machine::Verifier. A binary that fails verification is not
+ * loaded and a reload that fails it is not swapped in.
+ *
+ * Optionally, the binary can be watched and hot-reloaded. A reloaded executable is swapped in at the next frame
+ * boundary reported by the host, without touching host side state such as open display or audio contexts. Code
+ * from the previous executable may still be on the stack at that point, so it is retired rather than freed. At
+ * each later frame boundary, retired executables that neither the machine state nor the host entry points refer
+ * to any more are freed. Entry points held by the host are remapped by exported symbol name.
  */
 class Runtime {
     private:
+        enum LibraryState {
+            LIB_UNAVAILABLE = 0,
+            LIB_DECLARED,
+            LIB_BOUND
+        };
+
+        static Runtime* poActive;
+
         Definition& roDefinition;
         Loader::Executable const* poExecutable;
+        Machine::Verifier*        poVerifier;
+        char const*               sBinaryPath;
+        BinaryWatcher*            poWatcher;
+        std::vector<Loader::Executable const*> aRetired;
+
+        Machine::Interpreter::HCFVector aHCFVectors[Machine::Limits::MAX_HCF_VECTORS];
+        uint8                           auLibraryState[Machine::Limits::MAX_HCF_VECTORS];
+
+        // Live flat host call table. Rows are copied from the definition for each library that is bound, so the
+        // null entries of the others route calls through the unavailable vector.
+        std::vector<Machine::Interpreter::HostCall> acHostCalls;
+
+        /**
+         * Decide which host libraries are available to the executable, initialise them and populate the live vector
+         * table.
+         *
+         * @param  char const* sBinaryPath
+         * @return uint32 - number of libraries made available
+         * @throws Loader::Error
+         */
+        uint32 initLibraries(char const* sBinaryPath);
+
+        /**
+         * Copy the host calls of a library into the live flat table.
+         *
+         * @param uint32 const uSlot
+         */
+        void bindHostCalls(uint32 const uSlot);
+
+        /**
+         * Check a reloaded executable can replace the current one while code from the current one may still be
+         * running. The stack must fit and the existing import table must be preserved as a prefix so that the
+         * import indexes used by the current code remain valid.
+         *
+         * @param  Loader::Executable const* poReplacement
+         * @return bool
+         */
+        bool canReplaceWith(Loader::Executable const* poReplacement) const;
+
+        /**
+         * Swap in a pending reloaded executable, remapping the supplied entry points.
+         *
+         * @param  Machine::Interpreter::VMCodeEntryPoint* apEntryPoints
+         * @param  uint32 const uCount
+         * @return bool
+         */
+        bool adoptPending(Machine::Interpreter::VMCodeEntryPoint* apEntryPoints, uint32 const uCount);
+
+        /**
+         * Free the retired executables that nothing can return to or load from any more, see
+         * Machine::Interpreter::isReferenced(). The supplied entry points count as references.
+         *
+         * @param  Machine::Interpreter::VMCodeEntryPoint const* apEntryPoints
+         * @param  uint32 const uCount
+         */
+        void releaseRetired(Machine::Interpreter::VMCodeEntryPoint const* apEntryPoints, uint32 const uCount);
+
+        /**
+         * Stub for libraries the executable did not declare
+         */
+        static Machine::Interpreter::Status unavailableVector(uint8 uFunctionID);
+
+        static Machine::Interpreter::MemoryHooks const oMemoryHooks;
 
     public:
         /**
          * Constructor
          *
-         * Requires the host definition and the name of a binary executable to load.
+         * Requires the host definition and the name of a binary executable to load. Only one Runtime may be
+         * active at a time since the interpreter is static.
          */
         Runtime(Definition& roDefinition, char const* sBinaryPath);
         ~Runtime();
@@ -43,6 +133,32 @@ class Runtime {
          * @return Machine::Interpreter::Status
          */
         Machine::Interpreter::Status invoke(size_t const uFunctionID);
+
+        /**
+         * Start watching the binary for changes.
+         *
+         * @throws MC64K::Exception
+         */
+        void enableHotReload();
+
+        /**
+         * Called by the host at points where it is safe to replace the executable, e.g. between display frames,
+         * passing any VM entry points it holds so that they can be remapped. Retired executables that are no longer
+         * referenced are freed here too. Cheap when nothing is pending or retired.
+         *
+         * @param  Machine::Interpreter::VMCodeEntryPoint* apEntryPoints
+         * @param  uint32 const uCount
+         * @return bool - true if the executable was replaced
+         */
+        static bool frameBoundary(Machine::Interpreter::VMCodeEntryPoint* apEntryPoints, uint32 const uCount) {
+            if (!poActive || !poActive->poWatcher) {
+                return false;
+            }
+            if (!poActive->aRetired.empty()) {
+                poActive->releaseRetired(apEntryPoints, uCount);
+            }
+            return poActive->poWatcher->hasPending() && poActive->adoptPending(apEntryPoints, uCount);
+        }
 };
 
 } // namespace
@@ -0,0 +1,107 @@
+#ifndef MC64K_HOST_SLAB_HPP
+    #define MC64K_HOST_SLAB_HPP
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+#include <cstddef>
+#include <vector>
+#include <unordered_set>
+#include <misc/scalar.hpp>
+
+namespace MC64K::Host::Memory {
+
+/**
+ * Slab
+ *
+ * Single threaded allocator for guest memory. Blocks are rounded, including a 16 byte header, up to a power of two
+ * size class and carved from large slabs taken from the Arena. Released blocks go on a free list per class and are
+ * reused before any more of the slab is carved. Blocks beyond the largest class come from the Arena directly.
+ *
+ * A reset releases every block at once: the free lists are emptied and carving restarts at the first slab, keeping
+ * the slabs for reuse, so a frame scoped allocator settles with no further calls to the system allocator.
+ *
+ * Every block has the same 16 byte alignment as malloc().
+ */
+class Slab {
+    public:
+        enum {
+            MIN_CLASS_EXP = 5,
+            MAX_CLASS_EXP = 16,
+            NUM_CLASSES   = MAX_CLASS_EXP - MIN_CLASS_EXP + 1,
+            LARGE_CLASS   = NUM_CLASSES,
+            SLAB_SIZE     = 1 << 21 // One huge page, see Arena
+        };
+
+        /**
+         * Allocation statistics. The per class arrays have an extra entry for the large blocks.
+         */
+        struct Statistics {
+            uint64 uLiveBytes;
+            uint64 uPeakBytes;
+            uint64 uLiveBlocks;
+            uint64 uSlabBytes;
+            uint64 uResets;
+            uint64 auAllocations[NUM_CLASSES + 1];
+            uint64 auLive[NUM_CLASSES + 1];
+        };
+
+    private:
+        struct Header;
+
+        /** Per class free lists */
+        Header*  apFree[NUM_CLASSES];
+
+        /** All slabs, in carving order and in address order */
+        std::vector<uint8*> vSlabs;
+        std::vector<uint8*> vSorted;
+
+        /** Blocks allocated beyond the largest class */
+        std::unordered_set<Header*> oLarge;
+
+        /** Carving position */
+        uint8*   puNext;
+        uint8*   puEnd;
+        size_t   uSlab;
+
+        Statistics oStatistics;
+
+        uint32   uMagic;
+
+        uint8* carve(uint64 uBlockSize);
+        bool   isSlabAddress(void const* pAddress) const;
+
+    public:
+        Slab();
+        ~Slab();
+
+        /** Allocate a block of at least the given size. Null on failure */
+        void* allocate(uint64 uSize);
+
+        /** Release a block. Returns false if it is not a live block from this allocator. Null is ignored */
+        bool release(void* pBlock);
+
+        /** Release every block */
+        void reset();
+
+        Statistics const& getStatistics() const {
+            return oStatistics;
+        }
+
+        /** Print the statistics to stderr */
+        void report(char const* sName) const;
+};
+
+} // namespace
+
+#endif
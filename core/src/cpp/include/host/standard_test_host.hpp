@@ -29,7 +29,12 @@ enum Vector {
     ID_MEM     = 1,
     ID_VMATH   = 2,
     ID_DISPLAY = 3,
-    ID_AUDIO   = 4
+    ID_AUDIO   = 4,
+    ID_BATCH   = 5,
+    ID_BLIT    = 6,
+    ID_RASTER  = 7,
+    ID_SORT    = 8,
+    ID_UNPACK  = 9
 };
 
 /**
@@ -15,6 +15,7 @@
  */
 
 #include "standard_test_host.hpp"
+#include "standard_test_host_call.hpp"
 
 namespace MC64K::StandardTestHost::Audio {
 
@@ -28,7 +29,9 @@ enum Call {
     DONE,
     OPEN,
     CLOSE,
-    WRITE
+    WRITE,
+
+    CALL_MAX
 };
 
 /**
@@ -71,6 +74,11 @@ namespace Output {
         MAX_MS = 5000
     };
 };
+/**
+ * Host calls, indexed by Call
+ */
+extern ABI::HostCallTable<CALL_MAX> const acHostCalls;
+
 Interpreter::Status hostVector(uint8 uFunctionID);
 
 } // namespace
@@ -0,0 +1,129 @@
+#ifndef MC64K_STANDARD_TEST_HOST_BATCH_HPP
+    #define MC64K_STANDARD_TEST_HOST_BATCH_HPP
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+#include "standard_test_host.hpp"
+#include "standard_test_host_call.hpp"
+
+namespace MC64K::StandardTestHost::Batch {
+
+/**
+ * Batch Namespace, for submitting many host calls in a single hcf.
+ *
+ * A command buffer is a packed sequence of variable length records, each of which is one host call:
+ *
+ *     uint8  vector      HCF vector of the call
+ *     uint8  function    Function ID of the call
+ *     uint16 load        Mask of the ABI registers to load before the call (see Load)
+ *     uint16 flags       See Flag
+ *     uint16 reserved    Must be zero
+ *     uint64 value[]     One value per bit set in load, in bit order
+ *
+ * Every record is a multiple of 8 bytes long and records follow each other without padding. Register values are
+ * the raw 64-bit register contents. Registers that are not loaded keep whatever the previous call left in them,
+ * which allows a call to consume the results of the one before it.
+ */
+enum Call {
+    INIT = 0,
+    DONE,
+
+    /**
+     * func batch_exec(r8/a0 Command const* commands, r0/d0 uint32 count) => r0/d0 uint64 error, r1/d1 uint32 count
+     *
+     * Executes the commands in order. Returns ERR_NONE and the number of commands executed. When a command with
+     * STOP_ON_ERROR set leaves a non zero value in r0/d0, execution stops there and that value is returned along
+     * with the index of the command. If a command stops the machine (e.g. an unknown host call), so does the batch.
+     * Commands are not validated beyond the vector number, see batch_validate.
+     */
+    EXEC,
+
+    /**
+     * func batch_validate(r8/a0 Command const* commands, r0/d0 uint32 count) => r0/d0 uint64 error, r1/d1 uint32 index
+     *
+     * Checks every command without executing anything. Returns ERR_NONE and the number of commands, or an error
+     * and the index of the first invalid command. A buffer that validates once can be submitted any number of
+     * times, as long as it is not modified.
+     */
+    VALIDATE,
+
+    CALL_MAX
+};
+
+/**
+ * Register load mask bits
+ */
+enum Load {
+    LOAD_D0  = 1 << 0,
+    LOAD_D1  = 1 << 1,
+    LOAD_D2  = 1 << 2,
+    LOAD_A0  = 1 << 3,
+    LOAD_A1  = 1 << 4,
+    LOAD_A2  = 1 << 5,
+    LOAD_FP0 = 1 << 6,
+    LOAD_FP1 = 1 << 7,
+    LOAD_FP2 = 1 << 8,
+    LOAD_ALL = (1 << 9) - 1
+};
+
+/**
+ * Command flags
+ */
+enum Flag {
+    STOP_ON_ERROR = 1,
+    FLAG_ALL      = 1
+};
+
+/**
+ * Error return values
+ */
+enum Result {
+    ERR_BAD_VECTOR = 1100,
+    ERR_BAD_COMMAND,
+
+    /** The function ID is not one the vector's library implements */
+    ERR_BAD_FUNCTION,
+
+    /** Batches nested more than MAX_DEPTH deep, e.g. a batch that submits itself */
+    ERR_TOO_DEEP
+};
+
+/**
+ * Limits
+ */
+enum {
+    MAX_DEPTH = 8
+};
+
+/**
+ * Command record header. The register values follow immediately.
+ */
+struct Command {
+    uint8  uVector;
+    uint8  uFunction;
+    uint16 uLoad;
+    uint16 uFlags;
+    uint16 uReserved;
+};
+
+/**
+ * Host calls, indexed by Call
+ */
+extern ABI::HostCallTable<CALL_MAX> const acHostCalls;
+
+Interpreter::Status hostVector(uint8 uFunctionID);
+
+} // namespace
+
+#endif
@@ -0,0 +1,177 @@
+#ifndef MC64K_STANDARD_TEST_HOST_BLIT_HPP
+    #define MC64K_STANDARD_TEST_HOST_BLIT_HPP
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+
+#include "standard_test_host.hpp"
+#include "standard_test_host_call.hpp"
+
+namespace MC64K::StandardTestHost::Blit {
+
+/**
+ * Blit Namespace, for rectangle operations on pixel buffers.
+ *
+ * Every operation works on Surfaces, which describe a pixel buffer in one of the Display pixel formats PXL_LUT_8,
+ * PXL_RGB_555 or PXL_ARGB_32. Any buffer can be a Surface, including the display buffer (see blit_display_surface).
+ *
+ * Rectangles are clipped against both the source and the destination surface, so sprites can be drawn partly or
+ * entirely off the edge of the destination. An operation that is clipped away completely is not an error. Unless
+ * stated, the source and destination areas must not overlap.
+ */
+enum Call {
+    INIT = 0,
+    DONE,
+
+    /**
+     * func blit_display_surface(r8/a0 Display::Context const* context, r9/a1 Surface* surface) => r0/d0 uint64 error
+     *
+     * Fills in a Surface for the display buffer of an open display.
+     */
+    DISPLAY_SURFACE,
+
+    /**
+     * func blit_fill(r8/a0 Surface const* target, r9/a1 Rect const* rect, r0/d0 uint32 pixel) => r0/d0 uint64 error
+     *
+     * Fills a rectangle of the target with a pixel value. A null rect fills the whole surface.
+     */
+    FILL,
+
+    /**
+     * func blit_copy(
+     *     r8/a0 Surface const* source,
+     *     r9/a1 Surface const* target,
+     *     r10/a2 Rect const* rect,
+     *     r0/d0 int32 x,
+     *     r1/d1 int32 y
+     * ) => r0/d0 uint64 error
+     *
+     * Copies a rectangle of the source to x, y in the target. A null rect copies the whole source. The formats must
+     * match. The source and target may be the same buffer and the areas may overlap, e.g. for scrolling.
+     */
+    COPY,
+
+    /**
+     * func blit_copy_key(
+     *     r8/a0 Surface const* source,
+     *     r9/a1 Surface const* target,
+     *     r10/a2 Rect const* rect,
+     *     r0/d0 int32 x,
+     *     r1/d1 int32 y,
+     *     r2/d2 uint32 key
+     * ) => r0/d0 uint64 error
+     *
+     * As blit_copy, but source pixels equal to the key are transparent and leave the target unchanged.
+     */
+    COPY_KEY,
+
+    /**
+     * func blit_copy_remap(
+     *     r8/a0 Surface const* source,
+     *     r9/a1 Surface const* target,
+     *     r10/a2 Rect const* rect,
+     *     r0/d0 int32 x,
+     *     r1/d1 int32 y
+     * ) => r0/d0 uint64 error
+     *
+     * As blit_copy, but each pixel of a PXL_LUT_8 source is looked up in the remap table of the source, which has
+     * 256 entries in the format of the target. This converts to a different palette or expands to a true colour
+     * target in one pass.
+     */
+    COPY_REMAP,
+
+    /**
+     * func blit_blend(
+     *     r8/a0 Surface const* source,
+     *     r9/a1 Surface const* target,
+     *     r10/a2 Rect const* rect,
+     *     r0/d0 int32 x,
+     *     r1/d1 int32 y,
+     *     r2/d2 uint32 alpha
+     * ) => r0/d0 uint64 error
+     *
+     * As blit_copy, but mixes the source into the target with an alpha of 0 (target unchanged) to 255 (source). For
+     * PXL_ARGB_32 the alpha of each source pixel is scaled by the given alpha. PXL_LUT_8 surfaces cannot be blended.
+     */
+    BLEND,
+
+    CALL_MAX
+};
+
+/**
+ * Error return values
+ */
+enum Result {
+    ERR_BAD_SURFACE = 1200,
+    ERR_BAD_FORMAT
+};
+
+/**
+ * Surface descriptor, in VM memory.
+ */
+struct Surface {
+    /** First pixel of the first row */
+    void*       pPixels;
+
+    /** Remap table for blit_copy_remap, only used on PXL_LUT_8 sources */
+    void const* pRemap;
+
+    /** Dimensions, in pixels */
+    uint32      uWidth;
+    uint32      uHeight;
+
+    /** Distance between rows in bytes. Zero for rows that are exactly uWidth pixels apart */
+    uint32      uStride;
+
+    /** Display::PixelFormat */
+    uint32      uFormat;
+};
+
+/**
+ * Rectangle, in VM memory. The position may be negative, the part outside the surface is clipped.
+ */
+struct Rect {
+    int32  iX;
+    int32  iY;
+    uint32 uWidth;
+    uint32 uHeight;
+};
+
+/**
+ * A Surface once validated, for the libraries that draw on Surfaces
+ */
+struct View {
+    uint8* puPixels;
+    uint64 uStride;
+    int64  iWidth;
+    int64  iHeight;
+    uint32 uFormat;
+    uint32 uPixelSize;
+};
+
+/**
+ * Check a Surface from the VM. Returns ERR_NONE and fills in the View if it is valid.
+ */
+uint64 view(Surface const* poSurface, View& oView);
+
+/**
+ * Host calls, indexed by Call
+ */
+extern ABI::HostCallTable<CALL_MAX> const acHostCalls;
+
+Interpreter::Status hostVector(uint8 uFunctionID);
+
+} // namespace
+
+#endif
@@ -0,0 +1,134 @@
+#ifndef MC64K_STANDARD_TEST_HOST_CALL_HPP
+    #define MC64K_STANDARD_TEST_HOST_CALL_HPP
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+#include <array>
+#include <type_traits>
+#include <utility>
+#include <machine/limits.hpp>
+#include "standard_test_host.hpp"
+
+namespace MC64K::StandardTestHost::ABI {
+
+/**
+ * Compile time binding of native functions to the host call ABI.
+ *
+ * ABI::call<&function> is an Interpreter::HostCall that reads the parameters of the native function from the ABI
+ * registers, calls it and writes any return value back. Parameters are assigned by class, in declaration order:
+ * pointers to a0-a2, floating point values to fp0-fp2 and everything else to d0-d2. The return value goes to the
+ * first register of its class. For example:
+ *
+ *     uint64 copy(void const* pFrom, void* pTo, uint64 uSize)  =>  a0, a1, d0 => d0
+ *
+ * Native functions with no parameters and no return value that access the registers themselves bind as is.
+ */
+enum RegisterClass {
+    CLASS_INT = 0,
+    CLASS_PTR = 1,
+    CLASS_FLT = 2
+};
+
+template<typename T>
+constexpr RegisterClass classOf() {
+    if constexpr (std::is_pointer<T>::value) {
+        return CLASS_PTR;
+    } else if constexpr (std::is_floating_point<T>::value) {
+        return CLASS_FLT;
+    } else {
+        static_assert(std::is_integral<T>::value, "Unsupported host call parameter type");
+        return CLASS_INT;
+    }
+}
+
+/**
+ * Fetch the Nth register of the class for T, as T.
+ */
+template<typename T, unsigned N>
+inline T parameter() {
+    static_assert(N < 3, "Too many host call parameters of the same register class");
+    if constexpr (CLASS_PTR == classOf<T>()) {
+        return Interpreter::gpr<PTR_REG_0 + N>().template address<typename std::remove_pointer<T>::type>();
+    } else if constexpr (CLASS_FLT == classOf<T>()) {
+        return Interpreter::fpr<FLT_REG_0 + N>().template value<T>();
+    } else {
+        return Interpreter::gpr<INT_REG_0 + N>().template value<T>();
+    }
+}
+
+/**
+ * Store a return value in the first register of its class. Integers are extended to the full register.
+ */
+template<typename T>
+inline void result(T xValue) {
+    if constexpr (CLASS_PTR == classOf<T>()) {
+        Interpreter::gpr<PTR_REG_0>().pAny = (void*)xValue;
+    } else if constexpr (CLASS_FLT == classOf<T>()) {
+        Interpreter::fpr<FLT_REG_0>().value<T>() = xValue;
+    } else if constexpr (std::is_signed<T>::value) {
+        Interpreter::gpr<INT_REG_0>().iQuad = (int64)xValue;
+    } else {
+        Interpreter::gpr<INT_REG_0>().uQuad = (uint64)xValue;
+    }
+}
+
+template<typename Signature, Signature cFunction>
+struct Binding;
+
+template<typename R, typename... A, R (*cFunction)(A...)>
+struct Binding<R (*)(A...), cFunction> {
+
+    /**
+     * Position of parameter I among the parameters of the same register class
+     */
+    template<std::size_t I>
+    static constexpr unsigned slot() {
+        constexpr RegisterClass aeClass[] = { classOf<A>()..., CLASS_INT };
+        unsigned uSlot = 0;
+        for (std::size_t u = 0; u < I; ++u) {
+            uSlot += (aeClass[u] == aeClass[I]) ? 1 : 0;
+        }
+        return uSlot;
+    }
+
+    template<std::size_t... I>
+    static inline R invoke(std::index_sequence<I...>) {
+        return cFunction(parameter<A, slot<I>()>()...);
+    }
+
+    static Interpreter::Status call() {
+        if constexpr (std::is_void<R>::value) {
+            invoke(std::index_sequence_for<A...>());
+        } else {
+            result<R>(invoke(std::index_sequence_for<A...>()));
+        }
+        return Interpreter::RUNNING;
+    }
+};
+
+/**
+ * The host call for a native function.
+ */
+template<auto cFunction>
+constexpr Interpreter::HostCall call = Binding<decltype(cFunction), cFunction>::call;
+
+/**
+ * A library host call table, indexed by function ID.
+ */
+template<std::size_t N>
+using HostCallTable = std::array<Interpreter::HostCall, N>;
+
+} // namespace
+
+#endif
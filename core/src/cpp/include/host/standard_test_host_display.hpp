@@ -15,6 +15,7 @@
  */
 
 #include "standard_test_host.hpp"
+#include "standard_test_host_call.hpp"
 
 namespace MC64K::StandardTestHost::Display {
 
@@ -108,6 +109,11 @@ enum Result {
     ERR_INVALID_ID     = 1010,
 };
 
+/**
+ * Host calls, indexed by Call
+ */
+extern ABI::HostCallTable<CALL_MAX> const acHostCalls;
+
 Interpreter::Status hostVector(uint8 uFunctionID);
 
 } // namespace
@@ -15,6 +15,7 @@
  */
 
 #include "standard_test_host.hpp"
+#include "standard_test_host_call.hpp"
 
 namespace MC64K::StandardTestHost::IO {
 
@@ -196,6 +197,8 @@ enum Call {
      */
     CBUF_PARSE_SINGLE,
     CBUF_PARSE_DOUBLE,
+
+    CALL_MAX
 };
 
 /**
@@ -230,6 +233,11 @@ enum Result {
     ERR_WRITE,
 };
 
+/**
+ * Host calls, indexed by Call
+ */
+extern ABI::HostCallTable<CALL_MAX> const acHostCalls;
+
 Interpreter::Status hostVector(uint8 uFunctionID);
 
 } // namespace
@@ -15,6 +15,7 @@
  */
 
 #include "standard_test_host.hpp"
+#include "standard_test_host_call.hpp"
 
 namespace MC64K::StandardTestHost::Mem {
 
@@ -30,14 +31,16 @@ enum Call {
     /**
      * func mem_alloc(r0/d0 uint64 size) => r8/a0 void* buffer, r0/d0 uint64 error
      *
-     * Allocates a contiguous block of memory of at least the reuested size.
+     * Allocates a contiguous block of memory of at least the reuested size. Blocks come from a slab allocator with
+     * power of two size classes, see Host::Memory::Slab.
      */
     ALLOC,
 
     /**
      * func mem_free(r8/a0 void* buffer) => r0/d0 uint64 error
      *
-     * Releases a previously allocated block of memory.
+     * Releases a previously allocated block of memory. Freeing a block twice, or an address that did not come from
+     * mem_alloc, is detected and ignored.
      */
     FREE,
 
@@ -155,6 +158,45 @@ enum Call {
 
     STR_LENGTH,
     STR_COMPARE,
+
+    /**
+     * func mem_free_all() => r0/d0 uint64 error
+     *
+     * Releases every block allocated by mem_alloc in one operation. Suited to data that lives for a single frame,
+     * the memory is kept for reuse so that steady state allocation makes no system calls.
+     */
+    FREE_ALL,
+
+    /**
+     * func mem_arena_create(r0/d0 uint64 capacity, r1/d1 uint32 flags) => r8/a0 Arena* arena, r0/d0 uint64 error
+     *
+     * Creates a bump allocator of fixed capacity for data that is released all at once, see Host::Memory::FrameArena.
+     * The flags enable the GUARD (1) and POISON (2) debugging checks.
+     */
+    ARENA_CREATE,
+
+    /**
+     * func mem_arena_alloc(r8/a0 Arena* arena, r0/d0 uint64 size, r1/d1 uint64 align) => r8/a0 void* block, r0/d0 uint64 error
+     *
+     * Allocates a block from an arena. The alignment must be a power of two up to 4096, zero gives 16.
+     */
+    ARENA_ALLOC,
+
+    /**
+     * func mem_arena_reset(r8/a0 Arena* arena) => r0/d0 uint64 error
+     *
+     * Releases every block allocated from an arena.
+     */
+    ARENA_RESET,
+
+    /**
+     * func mem_arena_destroy(r8/a0 Arena* arena) => r0/d0 uint64 error
+     *
+     * Frees an arena.
+     */
+    ARENA_DESTROY,
+
+    CALL_MAX
 };
 
 /**
@@ -165,9 +207,25 @@ enum Result {
     ERR_MEM,
     ERR_MEM_INVALID_BUFFER,
     ERR_MEM_BUFFER_FULL,
-    ERR_MEM_INVALID_ELEMENT
+    ERR_MEM_INVALID_ELEMENT,
+    ERR_MEM_INVALID_BLOCK,
+    ERR_MEM_INVALID_ARENA,
+    ERR_MEM_ARENA_FULL,
+    ERR_MEM_ARENA_CORRUPT
 };
 
+/**
+ * Host calls, indexed by Call
+ */
+extern ABI::HostCallTable<CALL_MAX> const acHostCalls;
+
+/**
+ * Library hooks: the allocator is created when the runtime initialises the library and everything the guest still
+ * holds in it is released when the runtime shuts down.
+ */
+void initLibrary();
+void doneLibrary();
+
 Interpreter::Status hostVector(uint8 uFunctionID);
 
 } // namespace
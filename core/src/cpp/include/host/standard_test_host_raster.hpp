@@ -0,0 +1,197 @@
+#ifndef MC64K_STANDARD_TEST_HOST_RASTER_HPP
+    #define MC64K_STANDARD_TEST_HOST_RASTER_HPP
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+
+#include "standard_test_host.hpp"
+#include "standard_test_host_call.hpp"
+#include "standard_test_host_blit.hpp"
+#include "raster/texels.hpp"
+
+namespace MC64K::StandardTestHost::Raster {
+
+/**
+ * Raster Namespace, for drawing triangles and spans and for affine texture mapping.
+ *
+ * Drawing targets are Blit Surfaces, see blit.s, so the display buffer is drawn on by way of blit_display_surface.
+ * Textures are Surfaces too, in the same format as the target. Texture coordinates are in texels. For triangles,
+ * textures have power of two dimensions and the coordinates wrap.
+ *
+ * Triangles are set up with fixed point edge functions at 1/16 pixel precision and filled with the top-left rule,
+ * so triangles that share an edge neither overlap nor leave gaps. Either winding is drawn. Everything is clipped to
+ * the target.
+ */
+enum Call {
+    INIT = 0,
+    DONE,
+
+    /**
+     * func raster_triangles(
+     *     r8/a0 Surface const* target,
+     *     r9/a1 Vertex const* vertices,
+     *     r10/a2 Surface const* texture,
+     *     r0/d0 uint32 count,
+     *     r1/d1 uint32 mode,
+     *     r2/d2 uint32 pixel
+     * ) => r0/d0 uint64 error
+     *
+     * Draws count triangles from a list of 3 x count vertices, in one of the modes below, plus any of the flags.
+     * The pixel is the colour for MODE_FLAT and the transparent texel for FLAG_KEY. The texture is only needed for
+     * the textured modes.
+     */
+    TRIANGLES,
+
+    /**
+     * func raster_spans(r8/a0 Surface const* target, r9/a1 Span const* spans, r0/d0 uint32 count) => r0/d0 uint64 error
+     *
+     * Fills a list of horizontal spans, each with its own pixel value.
+     */
+    SPANS,
+
+    /**
+     * func raster_affine(
+     *     r8/a0 Surface const* target,
+     *     r9/a1 Surface const* texture,
+     *     r10/a2 Transform const* transform,
+     *     r0/d0 uint32 mode,
+     *     r1/d1 uint32 key
+     * ) => r0/d0 uint64 error
+     *
+     * Fills a rectangle of the target with an affine mapping of the texture, for rotozoom, mode 7 and similar
+     * effects. The mode is one of the Wrap modes, plus FLAG_KEY to skip texels equal to the key. The texture has the
+     * same format as the target and, for WRAP_REPEAT, power of two dimensions.
+     */
+    AFFINE,
+
+    CALL_MAX
+};
+
+/**
+ * Triangle modes, in the low byte of the mode
+ */
+enum Mode {
+    /** Single colour */
+    MODE_FLAT = 0,
+
+    /**
+     * Vertex colours interpolated. Colours are ARGB for PXL_ARGB_32 and PXL_RGB_555 targets and a palette index in
+     * the low byte for PXL_LUT_8 targets.
+     */
+    MODE_GOURAUD,
+
+    /** Texture coordinates interpolated linearly in screen space */
+    MODE_TEXTURE,
+
+    /** Texture coordinates interpolated with perspective correction, using the vertex w */
+    MODE_TEXTURE_PERSPECTIVE,
+
+    MODE_MAX
+};
+
+/**
+ * Triangle flags
+ */
+enum Flag {
+    /** Texels equal to the pixel value are not drawn */
+    FLAG_KEY      = 0x100,
+
+    /** Split the target into bands of rows drawn by a thread each. Only worth it for large triangle counts */
+    FLAG_PARALLEL = 0x200,
+
+    FLAG_ALL      = FLAG_KEY | FLAG_PARALLEL
+};
+
+/**
+ * Texture wrap modes for raster_affine, in the low byte of the mode
+ */
+enum Wrap {
+    WRAP_REPEAT = Host::Raster::WRAP_REPEAT,
+    WRAP_CLAMP  = Host::Raster::WRAP_CLAMP,
+    WRAP_NONE   = Host::Raster::WRAP_NONE,
+    WRAP_MAX    = Host::Raster::WRAP_MAX
+};
+
+/**
+ * Error return values
+ */
+enum Result {
+    ERR_BAD_MODE = 1300,
+    ERR_BAD_TEXTURE
+};
+
+/**
+ * Vertex, in VM memory. The position is in pixels, with pixel centres at .5. The w is the clip space w from the
+ * projection, which must be positive for MODE_TEXTURE_PERSPECTIVE, and is otherwise unused.
+ */
+struct Vertex {
+    float32 fX;
+    float32 fY;
+    float32 fW;
+    float32 fU;
+    float32 fV;
+    uint32  uColour;
+};
+
+/**
+ * Span, in VM memory
+ */
+struct Span {
+    int32  iX;
+    int32  iY;
+    uint32 uLength;
+    uint32 uPixel;
+};
+
+/**
+ * Texture coordinates for one row of raster_affine: the coordinate sampled at the centre of the first pixel of the
+ * row and the step per pixel, in texels.
+ */
+struct TransformLine {
+    float32 fU;
+    float32 fV;
+    float32 fDUDX;
+    float32 fDVDX;
+};
+
+/**
+ * Transform for raster_affine, in VM memory. The texel sampled at the centre of pixel x, y of the rectangle is
+ *
+ *     u = fU + x.fDUDX + y.fDUDY
+ *     v = fV + x.fDVDX + y.fDVDY
+ *
+ * unless there is a line table, which has one TransformLine per row of the rectangle and is used instead. Rows and
+ * columns that are clipped off the target still count.
+ */
+struct Transform {
+    Blit::Rect           oRect;
+    float32              fU;
+    float32              fV;
+    float32              fDUDX;
+    float32              fDVDX;
+    float32              fDUDY;
+    float32              fDVDY;
+    TransformLine const* poLines;
+};
+
+/**
+ * Host calls, indexed by Call
+ */
+extern ABI::HostCallTable<CALL_MAX> const acHostCalls;
+
+Interpreter::Status hostVector(uint8 uFunctionID);
+
+} // namespace
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef MC64K_STANDARD_TEST_HOST_SORT_HPP
+    #define MC64K_STANDARD_TEST_HOST_SORT_HPP
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+
+#include "standard_test_host.hpp"
+#include "standard_test_host_call.hpp"
+
+namespace MC64K::StandardTestHost::Sort {
+
+/**
+ * Sort Namespace, for sorting arrays of keys in VM memory.
+ *
+ * Keys are sorted with a stable LSD radix sort, one pass per byte of the key, so the cost is linear in the count.
+ * Passes over a byte that is the same in every key are skipped. Each key can carry a payload, e.g. the index or
+ * address of the face or sprite it belongs to, which is moved along with it.
+ *
+ * The caller provides a scratch buffer of at least count x (key size + payload size) + 8 bytes, which must not
+ * overlap the keys or payloads.
+ */
+enum Call {
+    INIT = 0,
+    DONE,
+
+    /**
+     * func sort_keys(
+     *     r8/a0 void* keys,
+     *     r9/a1 void* payloads,
+     *     r10/a2 void* scratch,
+     *     r0/d0 uint64 count,
+     *     r1/d1 uint32 mode
+     * ) => r0/d0 uint64 error
+     *
+     * Sorts count keys in place, in ascending order unless FLAG_DESCENDING is given. The mode is one of the Type
+     * values, plus any of the flags. The payloads are optional, when given there is one per key and they are put in
+     * the same order as the keys.
+     */
+    KEYS,
+
+    CALL_MAX
+};
+
+/**
+ * Key types, in the low byte of the mode. Floating point keys order -0.0 before 0.0 and NaN values to the ends.
+ */
+enum Type {
+    TYPE_UINT16 = 0,
+    TYPE_INT16,
+    TYPE_UINT32,
+    TYPE_INT32,
+    TYPE_FLOAT32,
+    TYPE_UINT64,
+    TYPE_INT64,
+    TYPE_FLOAT64,
+    TYPE_MAX
+};
+
+/**
+ * Sort flags
+ */
+enum Flag {
+    /** Largest key first, e.g. for back to front drawing by depth. Equal keys stay in their original order */
+    FLAG_DESCENDING = 0x100,
+
+    /** Payloads are 64-bit rather than 32-bit */
+    FLAG_PAYLOAD_64 = 0x200,
+
+    /** Fill the payloads with 0 to count - 1 before sorting, giving the original index of each sorted key */
+    FLAG_INDEX      = 0x400,
+
+    /** Split each pass across threads. Only worth it for large counts, small ones are sorted on the calling thread */
+    FLAG_PARALLEL   = 0x800,
+
+    FLAG_ALL        = FLAG_DESCENDING | FLAG_PAYLOAD_64 | FLAG_INDEX | FLAG_PARALLEL
+};
+
+/**
+ * Error return values
+ */
+enum Result {
+    ERR_BAD_MODE = 1400
+};
+
+/**
+ * Host calls, indexed by Call
+ */
+extern ABI::HostCallTable<CALL_MAX> const acHostCalls;
+
+Interpreter::Status hostVector(uint8 uFunctionID);
+
+} // namespace
+
+#endif
@@ -0,0 +1,139 @@
+#ifndef MC64K_STANDARD_TEST_HOST_UNPACK_HPP
+    #define MC64K_STANDARD_TEST_HOST_UNPACK_HPP
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+
+#include "standard_test_host.hpp"
+#include "standard_test_host_call.hpp"
+
+namespace MC64K::StandardTestHost::Unpack {
+
+/**
+ * Unpack Namespace, for decompressing packed data into VM memory.
+ *
+ * The source is either a buffer or a file opened with io_file_open, read from its current position. LZ4 frames are
+ * read from a file one block at a time, raw LZ4 blocks and RLE data are read whole. The target is a buffer with a
+ * given capacity, data that would not fit is an error. Bytes of the target past the unpacked size, up to the
+ * capacity, may be overwritten. The source and target must not overlap.
+ */
+enum Call {
+    INIT = 0,
+    DONE,
+
+    /**
+     * func unpack_decode(
+     *     r8/a0 void const* source,
+     *     r9/a1 void* target,
+     *     r0/d0 uint64 source_size,
+     *     r1/d1 uint64 target_capacity,
+     *     r2/d2 uint32 mode
+     * ) => r0/d0 uint64 error, r1/d1 uint64 size
+     *
+     * Unpacks source_size bytes of the source into the target. The mode is one of the Format values, plus FLAG_FILE
+     * when the source is a file. Returns the unpacked size, which is valid up to the point of any error.
+     */
+    DECODE,
+
+    /**
+     * func unpack_start(
+     *     r8/a0 void const* source,
+     *     r9/a1 void* target,
+     *     r0/d0 uint64 source_size,
+     *     r1/d1 uint64 target_capacity,
+     *     r2/d2 uint32 mode
+     * ) => r8/a0 Job* job, r0/d0 uint64 error
+     *
+     * As unpack_decode, on a background thread. The source and target must be left alone until the job has been
+     * waited for. Returns null and an error if the job could not be started.
+     */
+    START,
+
+    /**
+     * func unpack_poll(r8/a0 Job* job) => r0/d0 uint64 finished
+     *
+     * Returns 1 once the job has finished, 0 while it is still running and ERR_BAD_JOB if the job is not one
+     * returned by unpack_start that has yet to be waited for.
+     */
+    POLL,
+
+    /**
+     * func unpack_wait(r8/a0 Job* job) => r0/d0 uint64 error, r1/d1 uint64 size
+     *
+     * Waits for the job to finish, returns its result as unpack_decode and releases it. Returns ERR_BAD_JOB, and
+     * a zero size, if the job is not valid, including one that has already been waited for.
+     */
+    WAIT,
+
+    CALL_MAX
+};
+
+/**
+ * Packed formats, in the low byte of the mode
+ */
+enum Format {
+    /** One or more LZ4 frames, as written by the lz4 command line tool. Checksums are verified when present */
+    FORMAT_LZ4_FRAME = 0,
+
+    /** A raw LZ4 block, without any framing */
+    FORMAT_LZ4_BLOCK,
+
+    /**
+     * PackBits run length encoding, as used by IFF ILBM images. Each control byte n is followed either by n + 1
+     * literal bytes for n = 0 to 127, or by one byte repeated 1 - n times for n = -1 to -127. n = -128 is skipped.
+     */
+    FORMAT_RLE,
+
+    FORMAT_MAX
+};
+
+/**
+ * Unpack flags
+ */
+enum Flag {
+    /** The source is a FILE* from io_file_open rather than a buffer */
+    FLAG_FILE = 0x100,
+
+    FLAG_ALL  = FLAG_FILE
+};
+
+/**
+ * Error return values
+ */
+enum Result {
+    ERR_BAD_MODE = 1500,
+
+    /** The packed data is corrupt or truncated */
+    ERR_BAD_DATA,
+
+    /** The unpacked data does not fit the target */
+    ERR_TARGET_FULL,
+
+    /** An LZ4 header, block or content checksum did not match */
+    ERR_CHECKSUM,
+
+    /** The job handle is not a live job from unpack_start */
+    ERR_BAD_JOB
+};
+
+/**
+ * Host calls, indexed by Call
+ */
+extern ABI::HostCallTable<CALL_MAX> const acHostCalls;
+
+Interpreter::Status hostVector(uint8 uFunctionID);
+
+} // namespace
+
+#endif
@@ -15,6 +15,7 @@
  */
 
 #include "standard_test_host.hpp"
+#include "standard_test_host_call.hpp"
 
 namespace MC64K::StandardTestHost::VectorMath {
 
@@ -310,6 +311,21 @@ enum Call {
     M4X4D_DET,          // fp0  = Determinant(a0)
     M4X4D_INVERSE,      // (a1) = Inverse(a0)
 
+    /**
+     * Visibility
+     *
+     * Frustum culling of bounding spheres { x, y, z, r } and axis aligned boxes { min x, y, z, max x, y, z }. The
+     * frustum is 6 planes { a, b, c, d } with the inside at ax + by + cz + d >= 0, and can be extracted from a view
+     * projection matrix. The mask variants write one bit per volume, set when visible, in ceil(count / 8) bytes. The
+     * index variants write the uint32 index of each visible volume. All return the visible count.
+     */
+    M4X4F_FRUSTUM,      // (a1) = Frustum(a0)
+    CULL_SPHERES_MASK,  // (a2) = Visible((a0), frustum (a1)), count in r0, visible count in r0
+    CULL_SPHERES_INDEX, // (a2) = Visible((a0), frustum (a1)), count in r0, visible count in r0
+    CULL_BOXES_MASK,    // (a2) = Visible((a0), frustum (a1)), count in r0, visible count in r0
+    CULL_BOXES_INDEX,   // (a2) = Visible((a0), frustum (a1)), count in r0, visible count in r0
+
+    CALL_MAX
 };
 
 /**
@@ -319,6 +335,10 @@ enum Result {
     ERR_ZERO_DIVIDE = 1000
 };
 
+/**
+ * Host calls, indexed by Call
+ */
+extern ABI::HostCallTable<CALL_MAX> const acHostCalls;
 
 Interpreter::Status hostVector(uint8 uFunctionID);
 
@@ -0,0 +1,108 @@
+#ifndef MC64K_STANDARD_TEST_HOST_VECTOR_MATH_AVX2_FRUSTUM_HPP
+    #define MC64K_STANDARD_TEST_HOST_VECTOR_MATH_AVX2_FRUSTUM_HPP
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+#include <immintrin.h>
+#include <misc/scalar.hpp>
+#include "../offsets.hpp"
+
+/**
+ * AVX2 frustum tests, 8 bounding volumes at a time, with the same results as the generic ones: the plane distances
+ * are summed in the same order and without fused multiply-add. As with the other AVX2 kernels, these must only be
+ * called when the host CPU supports it, see Host::CPU.
+ */
+#pragma GCC push_options
+#pragma GCC target("avx2")
+
+namespace MC64K::StandardTestHost::VectorMath::AVX2 {
+
+/**
+ * Plane distance for 8 points at once
+ */
+inline __m256 distance(float32 const* pfPlane, __m256 vX, __m256 vY, __m256 vZ) {
+    return _mm256_add_ps(
+        _mm256_add_ps(
+            _mm256_add_ps(
+                _mm256_mul_ps(_mm256_set1_ps(pfPlane[V_X]), vX),
+                _mm256_mul_ps(_mm256_set1_ps(pfPlane[V_Y]), vY)
+            ),
+            _mm256_mul_ps(_mm256_set1_ps(pfPlane[V_Z]), vZ)
+        ),
+        _mm256_set1_ps(pfPlane[V_W])
+    );
+}
+
+/**
+ * Two 4 float vectors as the low and high halves of one register
+ */
+inline __m256 pair(float32 const* pfLow, float32 const* pfHigh) {
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(pfLow)), _mm_loadu_ps(pfHigh), 1);
+}
+
+/**
+ * Visibility bits of 8 spheres. The spheres are loaded in pairs 4 apart, so that transposing each 128-bit half
+ * leaves the components in sphere order.
+ */
+inline uint32 spheres8(float32 const* pfPlanes, float32 const* pfSpheres) {
+    __m256 vS04 = pair(pfSpheres,      pfSpheres + 16);
+    __m256 vS15 = pair(pfSpheres + 4,  pfSpheres + 20);
+    __m256 vS26 = pair(pfSpheres + 8,  pfSpheres + 24);
+    __m256 vS37 = pair(pfSpheres + 12, pfSpheres + 28);
+
+    __m256 vXY01 = _mm256_unpacklo_ps(vS04, vS15);
+    __m256 vZR01 = _mm256_unpackhi_ps(vS04, vS15);
+    __m256 vXY23 = _mm256_unpacklo_ps(vS26, vS37);
+    __m256 vZR23 = _mm256_unpackhi_ps(vS26, vS37);
+
+    __m256 vX      = _mm256_shuffle_ps(vXY01, vXY23, 0x44);
+    __m256 vY      = _mm256_shuffle_ps(vXY01, vXY23, 0xEE);
+    __m256 vZ      = _mm256_shuffle_ps(vZR01, vZR23, 0x44);
+    __m256 vRadius = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_shuffle_ps(vZR01, vZR23, 0xEE));
+
+    __m256 vOutside = _mm256_setzero_ps();
+    for (unsigned u = 0; u < 6; ++u, pfPlanes += 4) {
+        vOutside = _mm256_or_ps(vOutside, _mm256_cmp_ps(distance(pfPlanes, vX, vY, vZ), vRadius, _CMP_LT_OQ));
+    }
+    return ~(uint32)_mm256_movemask_ps(vOutside) & 0xFF;
+}
+
+/**
+ * Visibility bits of 8 boxes, each tested by the corner furthest along the plane normal
+ */
+inline uint32 boxes8(float32 const* pfPlanes, float32 const* pfBoxes) {
+    __m256i const vIndex = _mm256_setr_epi32(0, 6, 12, 18, 24, 30, 36, 42);
+    __m256 avMin[3], avMax[3];
+    for (unsigned u = 0; u < 3; ++u) {
+        avMin[u] = _mm256_i32gather_ps(pfBoxes + u,     vIndex, 4);
+        avMax[u] = _mm256_i32gather_ps(pfBoxes + 3 + u, vIndex, 4);
+    }
+    __m256 vOutside = _mm256_setzero_ps();
+    for (unsigned u = 0; u < 6; ++u, pfPlanes += 4) {
+        __m256 vDistance = distance(
+            pfPlanes,
+            pfPlanes[V_X] >= 0.0f ? avMax[V_X] : avMin[V_X],
+            pfPlanes[V_Y] >= 0.0f ? avMax[V_Y] : avMin[V_Y],
+            pfPlanes[V_Z] >= 0.0f ? avMax[V_Z] : avMin[V_Z]
+        );
+        vOutside = _mm256_or_ps(vOutside, _mm256_cmp_ps(vDistance, _mm256_setzero_ps(), _CMP_LT_OQ));
+    }
+    return ~(uint32)_mm256_movemask_ps(vOutside) & 0xFF;
+}
+
+} // namespace
+
+#pragma GCC pop_options
+
+#endif
@@ -0,0 +1,201 @@
+#ifndef MC64K_STANDARD_TEST_HOST_VECTOR_MATH_FRUSTUM_HPP
+    #define MC64K_STANDARD_TEST_HOST_VECTOR_MATH_FRUSTUM_HPP
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+#include <cmath>
+#include <host/cpu.hpp>
+#include "offsets.hpp"
+#include "avx2/frustum.hpp"
+
+/**
+ * Frustum culling of bounding spheres and boxes.
+ *
+ * A frustum is 6 planes of 4 components { a, b, c, d }, in the order left, right, bottom, top, near, far. A point
+ * p is inside a plane when a.px + b.py + c.pz + d >= 0. With a unit normal, this is also the distance to the plane.
+ * Spheres are { x, y, z, radius } and boxes are axis aligned { min x, min y, min z, max x, max y, max z }.
+ *
+ * The tests are conservative: a volume is only culled when it is entirely outside one of the planes. Volumes near a
+ * corner of the frustum may be kept even though they are outside it.
+ */
+namespace MC64K::StandardTestHost::VectorMath {
+
+enum {
+    FRUSTUM_PLANES = 6,
+    SPHERE_SIZE    = 4,
+    BOX_SIZE       = 6,
+    CULL_BLOCK     = 8
+};
+
+/**
+ * Extracts the frustum planes of a view projection matrix, which maps positions to clip space with the visible
+ * volume at -w <= x, y, z <= w. The planes are normalised, in double precision.
+ */
+template<typename T>
+inline void frustum_from_mat4x4(T* pfPlanes, T const* pfM) {
+    for (unsigned u = 0; u < FRUSTUM_PLANES; ++u, pfPlanes += 4) {
+        // Left and right from row 1, bottom and top from row 2, near and far from row 3, each against row 4
+        unsigned uRow  = (u >> 1) * 4;
+        float64  fSign = (u & 1) ? -1.0 : 1.0;
+        float64  afPlane[4];
+        for (unsigned uColumn = 0; uColumn < 4; ++uColumn) {
+            afPlane[uColumn] = (float64)pfM[M4_41 + uColumn] + fSign * (float64)pfM[uRow + uColumn];
+        }
+        float64 fLength = std::sqrt(
+            afPlane[V_X] * afPlane[V_X] + afPlane[V_Y] * afPlane[V_Y] + afPlane[V_Z] * afPlane[V_Z]
+        );
+        float64 fScale  = fLength > 0.0 ? 1.0 / fLength : 1.0;
+        for (unsigned uColumn = 0; uColumn < 4; ++uColumn) {
+            pfPlanes[uColumn] = (T)(afPlane[uColumn] * fScale);
+        }
+    }
+}
+
+/**
+ * Plane distance of a point
+ */
+inline float32 plane_distance(float32 const* pfPlane, float32 fX, float32 fY, float32 fZ) {
+    return pfPlane[V_X] * fX + pfPlane[V_Y] * fY + pfPlane[V_Z] * fZ + pfPlane[V_W];
+}
+
+/**
+ * Visibility of one sphere
+ */
+inline bool sphere_visible(float32 const* pfPlanes, float32 const* pfSphere) {
+    float32 fRadius = -pfSphere[V_W];
+    for (unsigned u = 0; u < FRUSTUM_PLANES; ++u, pfPlanes += 4) {
+        if (plane_distance(pfPlanes, pfSphere[V_X], pfSphere[V_Y], pfSphere[V_Z]) < fRadius) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Visibility of one box, tested by the corner furthest along each plane normal
+ */
+inline bool box_visible(float32 const* pfPlanes, float32 const* pfBox) {
+    for (unsigned u = 0; u < FRUSTUM_PLANES; ++u, pfPlanes += 4) {
+        float32 fDistance = plane_distance(
+            pfPlanes,
+            pfPlanes[V_X] >= 0.0f ? pfBox[3 + V_X] : pfBox[V_X],
+            pfPlanes[V_Y] >= 0.0f ? pfBox[3 + V_Y] : pfBox[V_Y],
+            pfPlanes[V_Z] >= 0.0f ? pfBox[3 + V_Z] : pfBox[V_Z]
+        );
+        if (fDistance < 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Visibility of one sphere or box
+ */
+template<bool bBox>
+inline bool visible(float32 const* pfPlanes, float32 const* pfVolume) {
+    return bBox ? box_visible(pfPlanes, pfVolume) : sphere_visible(pfPlanes, pfVolume);
+}
+
+/**
+ * Visibility bits of up to CULL_BLOCK spheres or boxes, one at a time
+ */
+template<bool bBox>
+uint32 cull_block(float32 const* pfPlanes, float32 const* pfVolumes, uint32 uCount = CULL_BLOCK) {
+    uint32 uBits = 0;
+    for (uint32 u = 0; u < uCount; ++u) {
+        uBits |= (uint32)visible<bBox>(pfPlanes, pfVolumes + u * (bBox ? BOX_SIZE : SPHERE_SIZE)) << u;
+    }
+    return uBits;
+}
+
+/**
+ * Block test for the host CPU
+ */
+template<bool bBox>
+inline auto cull_block_for_cpu() {
+    static uint32 (*const cBlock)(float32 const*, float32 const*) = Host::CPU::getLevel() >= Host::CPU::AVX2 ?
+        (bBox ? AVX2::boxes8 : AVX2::spheres8) :
+        [](float32 const* pfPlanes, float32 const* pfVolumes) {
+            return cull_block<bBox>(pfPlanes, pfVolumes);
+        };
+    return cBlock;
+}
+
+/**
+ * Tests a set of spheres or boxes against a frustum. Writes either a bitmask, with bit n of byte n / 8 set for each
+ * visible volume, or the indices of the visible volumes. Returns the visible count.
+ */
+template<bool bBox, bool bIndex>
+uint64 cull(float32 const* pfVolumes, float32 const* pfPlanes, void* pOutput, uint32 uCount) {
+    constexpr unsigned SIZE = bBox ? BOX_SIZE : SPHERE_SIZE;
+    auto    cBlock   = cull_block_for_cpu<bBox>();
+    uint8*  puMask   = (uint8*)pOutput;
+    uint32* puIndex  = (uint32*)pOutput;
+    uint64  uVisible = 0;
+    for (uint32 uBase = 0; uBase < uCount; uBase += CULL_BLOCK, pfVolumes += CULL_BLOCK * SIZE) {
+        uint32 uBits = uCount - uBase >= CULL_BLOCK ?
+            cBlock(pfPlanes, pfVolumes) :
+            cull_block<bBox>(pfPlanes, pfVolumes, uCount - uBase);
+        uVisible += (uint64)__builtin_popcount(uBits);
+        if constexpr (bIndex) {
+            while (uBits) {
+                *puIndex++ = uBase + (uint32)__builtin_ctz(uBits);
+                uBits &= uBits - 1;
+            }
+        } else {
+            *puMask++ = (uint8)uBits;
+        }
+    }
+    return uVisible;
+}
+
+/**
+ * frustum(a1) = planes of m4x4(a0)
+ */
+inline void m4x4_frustum(float32 const* pfM, float32* pfPlanes) {
+    frustum_from_mat4x4<float32>(pfPlanes, pfM);
+}
+
+/**
+ * bits(a2) = visible(sphere[0 ... d0-1](a0), frustum(a1)), d0 = visible count
+ */
+inline uint64 cull_spheres_mask(float32 const* pfSpheres, float32 const* pfPlanes, uint8* puMask, uint32 uCount) {
+    return cull<false, false>(pfSpheres, pfPlanes, puMask, uCount);
+}
+
+/**
+ * indices(a2) = visible(sphere[0 ... d0-1](a0), frustum(a1)), d0 = visible count
+ */
+inline uint64 cull_spheres_index(float32 const* pfSpheres, float32 const* pfPlanes, uint32* puIndex, uint32 uCount) {
+    return cull<false, true>(pfSpheres, pfPlanes, puIndex, uCount);
+}
+
+/**
+ * bits(a2) = visible(box[0 ... d0-1](a0), frustum(a1)), d0 = visible count
+ */
+inline uint64 cull_boxes_mask(float32 const* pfBoxes, float32 const* pfPlanes, uint8* puMask, uint32 uCount) {
+    return cull<true, false>(pfBoxes, pfPlanes, puMask, uCount);
+}
+
+/**
+ * indices(a2) = visible(box[0 ... d0-1](a0), frustum(a1)), d0 = visible count
+ */
+inline uint64 cull_boxes_index(float32 const* pfBoxes, float32 const* pfPlanes, uint32* puIndex, uint32 uCount) {
+    return cull<true, true>(pfBoxes, pfPlanes, puIndex, uCount);
+}
+
+} // namespace
+
+#endif
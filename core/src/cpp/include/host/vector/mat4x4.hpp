@@ -15,6 +15,7 @@
  */
 
 #include <machine/register.hpp>
+#include <host/cpu.hpp>
 #include "matrix_common.hpp"
 
 #ifdef MATRIX_FORCE_DOUBLE
@@ -29,7 +30,7 @@ namespace MC64K::StandardTestHost::VectorMath {
  * Apply a Mat4x4 to an input set of Vec4.
  */
 template<typename T>
-inline void vec4_transform_4x4(T* pfDst, T const* pfSrc, T const* pfM, size_t uCount) {
+CPU_MULTIVERSION inline void vec4_transform_4x4(T* pfDst, T const* pfSrc, T const* pfM, size_t uCount) {
     while (uCount--) {
         *pfDst++ = pfM[M4_11] * pfSrc[V_X] + pfM[M4_12] * pfSrc[V_Y] + pfM[M4_13] * pfSrc[V_Z] + pfM[M4_14] * pfSrc[V_W];
         *pfDst++ = pfM[M4_21] * pfSrc[V_X] + pfM[M4_22] * pfSrc[V_Y] + pfM[M4_23] * pfSrc[V_Z] + pfM[M4_24] * pfSrc[V_W];
@@ -16,6 +16,7 @@
 
 #include <cmath>
 #include <machine/register.hpp>
+#include <host/cpu.hpp>
 #include "offsets.hpp"
 /**
  * 2D Vector Operations
@@ -34,7 +35,7 @@ inline constexpr T dot2(T const* pfVec2a, T const* pfVec2b) {
  * Applies a Mat2x2 to an input set of Vec2
  */
 template<typename T>
-inline void vec2_transform_2x2(T* pfDst, T const* pfSrc, T const* pfM, size_t uCount) {
+CPU_MULTIVERSION inline void vec2_transform_2x2(T* pfDst, T const* pfSrc, T const* pfM, size_t uCount) {
     while (uCount--) {
         *pfDst++ = pfM[M2_11] * pfSrc[V_X] + pfM[M2_12] * pfSrc[V_Y];
         *pfDst++ = pfM[M2_21] * pfSrc[V_X] + pfM[M2_22] * pfSrc[V_Y];
@@ -47,7 +48,7 @@ inline void vec2_transform_2x2(T* pfDst, T const* pfSrc, T const* pfM, size_t uC
  * Output is also a set of Vec2. Only the first 2 rows of the matrix are considered.
  */
 template<typename T>
-inline void vec2_0_transform_3x3(T* pfDst, T const* pfSrc, T const* pfM, size_t uCount) {
+CPU_MULTIVERSION inline void vec2_0_transform_3x3(T* pfDst, T const* pfSrc, T const* pfM, size_t uCount) {
     while (uCount--) {
         *pfDst++ = pfM[M3_11] * pfSrc[V_X] + pfM[M3_12] * pfSrc[V_Y];
         *pfDst++ = pfM[M3_21] * pfSrc[V_X] + pfM[M3_22] * pfSrc[V_Y];
@@ -60,7 +61,7 @@ inline void vec2_0_transform_3x3(T* pfDst, T const* pfSrc, T const* pfM, size_t
  * Output is also a set of Vec2. Only the first 2 rows of the matrix are considered.
  */
 template<typename T>
-inline void vec2_1_transform_3x3(T* pfDst, T const* pfSrc, T const* pfM, size_t uCount) {
+CPU_MULTIVERSION inline void vec2_1_transform_3x3(T* pfDst, T const* pfSrc, T const* pfM, size_t uCount) {
     while (uCount--) {
         *pfDst++ = pfM[M3_11] * pfSrc[V_X] + pfM[M3_12] * pfSrc[V_Y] + pfM[M3_13];
         *pfDst++ = pfM[M3_21] * pfSrc[V_X] + pfM[M3_22] * pfSrc[V_Y] + pfM[M3_23];
@@ -72,7 +73,7 @@ inline void vec2_1_transform_3x3(T* pfDst, T const* pfSrc, T const* pfM, size_t
  * Vec2 to Vec3 expand
  */
 template<typename T>
-inline void vec2_expand_vec3(T* pfDst, T const* pfSrc, T fValue, size_t uCount) {
+CPU_MULTIVERSION inline void vec2_expand_vec3(T* pfDst, T const* pfSrc, T fValue, size_t uCount) {
     while (uCount--) {
         *pfDst++ = *pfSrc++;
         *pfDst++ = *pfSrc++;
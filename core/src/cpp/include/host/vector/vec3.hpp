@@ -16,6 +16,7 @@
 
 #include <cmath>
 #include <machine/register.hpp>
+#include <host/cpu.hpp>
 #include "offsets.hpp"
 
 /**
@@ -36,7 +37,7 @@ inline constexpr T dot3(T const* pfVec3a, T const* pfVec3b) {
  * Applies a Mat3x3 to an input set of Vec3
  */
 template<typename T>
-inline void vec3_transform_3x3(T* pfDst, T const* pfSrc, T const* pfM, size_t uCount) {
+CPU_MULTIVERSION inline void vec3_transform_3x3(T* pfDst, T const* pfSrc, T const* pfM, size_t uCount) {
     while (uCount--) {
         *pfDst++ = pfM[M3_11] * pfSrc[V_X] + pfM[M3_12] * pfSrc[V_Y] + pfM[M3_13] * pfSrc[V_Z];
         *pfDst++ = pfM[M3_21] * pfSrc[V_X] + pfM[M3_22] * pfSrc[V_Y] + pfM[M3_23] * pfSrc[V_Z];
@@ -50,7 +51,7 @@ inline void vec3_transform_3x3(T* pfDst, T const* pfSrc, T const* pfM, size_t uC
  * Output is also a set of Vec3. Only the first 3 rows of the matrix are considered.
  */
 template<typename T>
-inline void vec3_0_transform_4x4(T* pfDst, T const* pfSrc, T const* pfM, size_t uCount) {
+CPU_MULTIVERSION inline void vec3_0_transform_4x4(T* pfDst, T const* pfSrc, T const* pfM, size_t uCount) {
     while (uCount--) {
         *pfDst++ = pfM[M4_11] * pfSrc[V_X] + pfM[M4_12] * pfSrc[V_Y] + pfM[M4_13] * pfSrc[V_Z];
         *pfDst++ = pfM[M4_21] * pfSrc[V_X] + pfM[M4_22] * pfSrc[V_Y] + pfM[M4_23] * pfSrc[V_Z];
@@ -64,7 +65,7 @@ inline void vec3_0_transform_4x4(T* pfDst, T const* pfSrc, T const* pfM, size_t
  * Output is also a set of Vec3. Only the first thee rows of the matrix are considered.
  */
 template<typename T>
-inline void vec3_1_transform_4x4(T* pfDst, T const* pfSrc, T const* pfM, size_t uCount) {
+CPU_MULTIVERSION inline void vec3_1_transform_4x4(T* pfDst, T const* pfSrc, T const* pfM, size_t uCount) {
     while (uCount--) {
         *pfDst++ = pfM[M4_11] * pfSrc[V_X] + pfM[M4_12] * pfSrc[V_Y] + pfM[M4_13] * pfSrc[V_Z] + pfM[M4_14];
         *pfDst++ = pfM[M4_21] * pfSrc[V_X] + pfM[M4_22] * pfSrc[V_Y] + pfM[M4_23] * pfSrc[V_Z] + pfM[M4_24];
@@ -77,7 +78,7 @@ inline void vec3_1_transform_4x4(T* pfDst, T const* pfSrc, T const* pfM, size_t
  * Vec3 to Vec4 expand
  */
 template<typename T>
-inline void vec3_expand_vec4(T* pfDst, T const* pfSrc, T fValue, size_t uCount) {
+CPU_MULTIVERSION inline void vec3_expand_vec4(T* pfDst, T const* pfSrc, T fValue, size_t uCount) {
     while (uCount--) {
         *pfDst++ = *pfSrc++;
         *pfDst++ = *pfSrc++;
@@ -55,9 +55,9 @@ class Binary {
          * Loader. Attempts to load the named binary file and return an executable structure.
          *
          * @param  char const* sFileName
-         * @return Executable const*
+         * @return Executable*
          */
-        Executable const* load(char const* sFileName);
+        Executable* load(char const* sFileName);
 
     private:
         /**
@@ -151,12 +151,13 @@ class Binary {
 
         /**
          * Load a chunk with the given ID. Uses the manifest data to locate the offset (if present),
-         * allocates storage and loads the raw data.
+         * allocates storage and loads the raw data. The unpadded chunk size is written to puSize, if given.
          *
          * @param  uint64 const uChunkID
+         * @param  uint64*      puSize
          * @return uint8*
          */
-        uint8* readChunkData(uint64 const uChunkID);
+        uint8* readChunkData(uint64 const uChunkID, uint64* puSize = 0);
 
         /**
          * Validate the raw taget data (minimum verification)
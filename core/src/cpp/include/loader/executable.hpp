@@ -15,6 +15,7 @@
  */
 
 #include <cstdio>
+#include <vector>
 #include <misc/scalar.hpp>
 #include <machine/limits.hpp>
 #include "dependency.hpp"
@@ -30,7 +31,7 @@ namespace MC64K::Loader {
  * End product of successfully loading an MC64K object file for execution.
  */
 class Executable {
-    friend Executable const* Binary::load(char const*);
+    friend Executable* Binary::load(char const*);
 
     private:
         // Symbols are managed by SymbolSet.
@@ -39,6 +40,9 @@ class Executable {
 
         uint8 const* puTargetData;
         uint8 const* puByteCode;
+        uint64       uByteCodeSize;
+        Dependency*  poDependencies;
+        uint32       uNumDependencies;
 
         enum {
             TD_OFFSET_FLAGS    = 0,
@@ -62,11 +66,50 @@ class Executable {
          */
         SymbolSet const* getExportedSymbolSet() const;
 
+        /**
+         * Obtain the start of the loaded bytecode.
+         *
+         * @return uint8 const*
+         */
+        uint8 const* getByteCode() const;
+
+        /**
+         * Obtain the length of the loaded bytecode, excluding any alignment padding.
+         *
+         * @return uint64
+         */
+        uint64 getByteCodeSize() const;
+
         /**
          * Get the stack size indicated by the executable
          */
         uint32 getStackSize() const;
 
+        /**
+         * Obtain the dependency table from the target information. The first entry is the target itself and
+         * for executables the second is the host. Any remaining entries are host libraries the binary declares.
+         *
+         * @return Dependency const*
+         */
+        Dependency const* getDependencies() const;
+
+        /**
+         * @return uint32
+         */
+        uint32 getNumDependencies() const;
+
+        /**
+         * Rewrite import symbol operands in the bytecode as PC relative references to their linked addresses, so
+         * that executing them no longer goes through the import table. Both forms are the same length. The offsets
+         * must be those of the effective address byte of operands known to be decoded as such, i.e. as found by
+         * the verifier. Operands whose target is beyond the reach of a 32-bit displacement are reported and left
+         * using the import table.
+         *
+         * @param  std::vector<uint64> const& auOffsets
+         * @return uint32 - number of operands rewritten
+         */
+        uint32 bindImportReferences(std::vector<uint64> const& auOffsets);
+
         /**
          * Destructor
          */
@@ -85,6 +128,7 @@ class Executable {
          * @param Host::Definition const& roDefinition
          * @param uint8 const*            puRawTargetData
          * @param uint8 const*            puRawByteCode
+         * @param uint64                  uRawByteCodeSize
          * @param uint8*                  puRawImportData
          * @param uint8*                  puRawExportData
          */
@@ -92,10 +136,16 @@ class Executable {
             Host::Definition const& roDefinition,
             uint8 const*            puRawTargetData,
             uint8 const*            puRawByteCode,
+            uint64                  uRawByteCodeSize,
             uint8*                  puRawImportData,
             uint8*                  puRawExportData
         );
 
+        /**
+         * Builds the dependency table from the raw target data. The names reference the target data directly.
+         */
+        void processDependencies();
+
         /**
          * Extracts the symbol access flags from the end of the symbol name and returns
          * the starting address of the next one. In the process, the access flags in the
@@ -128,5 +178,33 @@ inline SymbolSet const* Executable::getExportedSymbolSet() const {
     return &oExportedSymbols;
 }
 
+/**
+ * @inheritDoc
+ */
+inline uint8 const* Executable::getByteCode() const {
+    return puByteCode;
+}
+
+/**
+ * @inheritDoc
+ */
+inline uint64 Executable::getByteCodeSize() const {
+    return uByteCodeSize;
+}
+
+/**
+ * @inheritDoc
+ */
+inline Dependency const* Executable::getDependencies() const {
+    return poDependencies;
+}
+
+/**
+ * @inheritDoc
+ */
+inline uint32 Executable::getNumDependencies() const {
+    return uNumDependencies;
+}
+
 } // namespace
 #endif
@@ -163,6 +163,13 @@ class SymbolSet {
          * Link symbols against another symbol set.
          */
         void linkAgainst(SymbolSet const& roOther) const;
+
+        /**
+         * Check that every symbol can be linked against another symbol set, without linking any of them.
+         *
+         * @throws LinkError
+         */
+        void checkAgainst(SymbolSet const& roOther) const;
 };
 
 /**
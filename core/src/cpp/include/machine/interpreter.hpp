@@ -25,6 +25,8 @@ namespace MC64K::Loader {
 
 namespace MC64K::Machine {
 
+class Verifier;
+
 /**
  * Interpreter
  *
@@ -50,7 +52,9 @@ class Interpreter {
             UNIMPLEMENTED_OPCODE,
             UNIMPLEMENTED_EAMODE,
             UNKNOWN_HOST_CALL,
-            INVALID_ENTRYPOINT
+            INVALID_ENTRYPOINT,
+            UNRESOLVED_SYMBOL,
+            ILLEGAL_EAMODE
         };
 
         /**
@@ -61,7 +65,8 @@ class Interpreter {
             STATE_FPR   =  2,
             STATE_TMP   =  4,
             STATE_STACK =  8,
-            STATE_HCF   = 16
+            STATE_HCF   = 16,
+            STATE_VR    = 32
         };
 
         /**
@@ -77,14 +82,59 @@ class Interpreter {
          */
         static void initHCFVectors(HCFVector const* pcHCFVectors, uint32 const uNumHCFVectors);
 
+        /**
+         * Host call (a single host native function, already resolved by library and function ID)
+         */
+        typedef Status (*HostCall)();
+
+        /**
+         * Initialise the flat host call table. There are Limits::HOST_CALLS_PER_VECTOR entries for each HCF vector, indexed
+         * by (vector << 8 | function ID). A null entry falls back to calling the HCF vector with the function ID.
+         * Only a reference is taken so the supplied table must not go out of scope.
+         *
+         * @param HostCall const* pcHostCalls
+         */
+        static void initHostCalls(HostCall const* pcHostCalls);
+
         /**
          * Initialise the imported symbols. Only a reference is taken so the supplied table must not go out of scope.
+         * The loader links every import before the executable is run.
          *
          * @param Loader::Symbol* poImportSymbols
          * @param uint32 const    uNumImportSymbols
          */
         static void initImportSymbols(Loader::Symbol* poImportSymbols, uint32 const uNumImportSymbols);
 
+        /**
+         * Set the verifier for the current executable, or null for none. Code it has verified is dispatched without
+         * the status check after each instruction. Only a reference is taken.
+         *
+         * @param Verifier const* poVerifier
+         */
+        static void setVerifier(Verifier const* poVerifier);
+
+        /**
+         * Memory services the host can supply, so that the machine does not depend on how the host manages memory.
+         * The stack allocator must return cleared memory or null. The fill functions are only given blocks aligned to
+         * the element size.
+         */
+        struct MemoryHooks {
+            void* (*cAllocateStack)(uint64 uSize);
+            void  (*cReleaseStack)(void* pStack);
+            void  (*cFillByte)(void* pBuffer, uint8 uValue, uint64 uCount);
+            void  (*cFillWord)(void* pBuffer, uint16 uValue, uint64 uCount);
+            void  (*cFillLong)(void* pBuffer, uint32 uValue, uint64 uCount);
+            void  (*cFillQuad)(void* pBuffer, uint64 uValue, uint64 uCount);
+        };
+
+        /**
+         * Set the memory hooks, or null for the defaults, which use the C library. Must be set before the stack is
+         * allocated and left alone until it has been freed. Only a reference is taken.
+         *
+         * @param MemoryHooks const* poMemoryHooks
+         */
+        static void initMemoryHooks(MemoryHooks const* poMemoryHooks);
+
         /**
          * Allocate the machine stack. The top of the stack will be assigned to r15 as the USP.
          *
@@ -108,6 +158,16 @@ class Interpreter {
          */
         static void run();
 
+        /**
+         * Make a host call exactly as the hcf operation would and return the resulting status. For host code that
+         * performs host calls on behalf of the VM code.
+         *
+         * @param  uint8 const uVector
+         * @param  uint8 const uFunctionID
+         * @return Status
+         */
+        static Status callHost(uint8 const uVector, uint8 const uFunctionID);
+
         /**
          * Get the GP register set (array access)
          */
@@ -118,6 +178,11 @@ class Interpreter {
          */
         static FPRegister* fpr();
 
+        /**
+         * Get the vector register set (array access)
+         */
+        static VRegister* vr();
+
         /**
          * Compile-time range-checked access to GPR
          *
@@ -142,6 +207,17 @@ class Interpreter {
          */
         static void dumpState(std::FILE* poStream, unsigned int const uFlags);
 
+        /**
+         * Check if anything the machine can still execute or load from may point into the given block of memory:
+         * the program counter, the return addresses of host calls in progress, the general purpose registers and
+         * the live part of the stack. The stack is untyped, so any matching value counts.
+         *
+         * @param  void const*  pStart
+         * @param  uint64 const uSize
+         * @return bool
+         */
+        static bool isReferenced(void const* pStart, uint64 const uSize);
+
         /**
          * Return the current interpreter status
          *
@@ -152,16 +228,30 @@ class Interpreter {
     private:
         static GPRegister       aoGPR[GPRegister::MAX];
         static FPRegister       aoFPR[FPRegister::MAX];
+        static VRegister        aoVR[VRegister::MAX];
         //static void*            pDstEA;
         static void*            pSrcEA;
         static void*            pTmpEA;
         static uint8*           puStackTop;
         static uint8*           puStackBase;
         static HCFVector const* pcHCFVectors;
+        static HostCall const*  pcHostCalls;
         static Loader::Symbol*  poImportSymbols;
+        static Verifier const*  poVerifier;
+        static MemoryHooks const* poMemoryHooks;
         static uint32           uNumHCFVectors;
         static uint32           uNumImportSymbols;
 
+        /**
+         * Return address of a host call in progress. Host calls can run further code, e.g. callbacks, so these are
+         * chained through the native stack.
+         */
+        struct HostFrame {
+            uint8 const*     puReturn;
+            HostFrame const* poPrevious;
+        };
+        static HostFrame const* poHostFrame;
+
         /**
          * Operation size
          */
@@ -169,7 +259,8 @@ class Interpreter {
             SIZE_BYTE = 1,
             SIZE_WORD = 2,
             SIZE_LONG = 4,
-            SIZE_QUAD = 8
+            SIZE_QUAD = 8,
+            SIZE_VECTOR = VRegister::SIZE
         } eOperationSize;
 
         /**
@@ -184,6 +275,15 @@ class Interpreter {
          */
         static void* decodeEffectiveAddress();
 
+        /**
+         * Decode the effective address currently under evaluation for an operation that accesses a block of memory
+         * through it, e.g. a vector load. Register direct and immediate modes do not give enough storage, so the
+         * machine halts with ILLEGAL_EAMODE and null is returned. The caller must then skip the operation.
+         *
+         * @return void* - null if the mode does not refer to memory
+         */
+        static void* decodeBlockEffectiveAddress();
+
         /**
          * Save the registers implied by the 32-bit mask, using the specified EA mode
          *
@@ -207,6 +307,16 @@ class Interpreter {
         static void  handleSDC();
         static void  handleRBMC();
         static void  handleR2RBDC();
+        static void  handleVEC();
+        static void  handleBIT();
+        static void  handleCSEL();
+        static void  handleMINMAX();
+        static void  handleBLK();
+
+        /**
+         * Handler set for the tail call dispatch build, see interpreter_run_tailcall.cpp
+         */
+        struct TailCall;
 };
 
 /**
@@ -216,6 +326,24 @@ inline Interpreter::Status Interpreter::getStatus() {
     return eStatus;
 }
 
+/**
+ * @inheritDoc
+ */
+inline Interpreter::Status Interpreter::callHost(uint8 const uVector, uint8 const uFunctionID) {
+    if (uVector < uNumHCFVectors) {
+        HostCall cHostCall = pcHostCalls ? pcHostCalls[(uint32)uVector << 8 | uFunctionID] : 0;
+        return cHostCall ? cHostCall() : pcHCFVectors[uVector](uFunctionID);
+    }
+    return UNKNOWN_HOST_CALL;
+}
+
+/**
+ * @inheritDoc
+ */
+inline void Interpreter::setVerifier(Verifier const* poNewVerifier) {
+    poVerifier = poNewVerifier;
+}
+
 /**
  * @inheritDoc
  */
@@ -230,6 +358,13 @@ inline FPRegister* Interpreter::fpr() {
     return aoFPR;
 }
 
+/**
+ * @inheritDoc
+ */
+inline VRegister* Interpreter::vr() {
+    return aoVR;
+}
+
 /**
  * @inheritDoc
  */
@@ -21,10 +21,11 @@
 namespace MC64K::Machine::Limits {
 
 enum {
-    MAX_HCF_VECTORS = 256,
-    STACK_ALIGN     = 32,
-    MIN_STACK_SIZE  = 64,
-    MAX_STACK_SIZE  = 1 << 23
+    MAX_HCF_VECTORS       = 256,
+    HOST_CALLS_PER_VECTOR = 256,
+    STACK_ALIGN           = 32,
+    MIN_STACK_SIZE        = 64,
+    MAX_STACK_SIZE        = 1 << 23
 };
 
 enum {
@@ -0,0 +1,27 @@
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+/**
+ * Includes every opcode handler. Each interpreter backend includes this once per dispatch loop, after defining
+ * the defOp(), end(), status(), next(), check() and jump() macros described in the individual handler files.
+ */
+
+#include <machine/opcode_handlers/control.hpp>
+#include <machine/opcode_handlers/fast_path.hpp>
+#include <machine/opcode_handlers/data_move.hpp>
+#include <machine/opcode_handlers/logical.hpp>
+#include <machine/opcode_handlers/arithmetic.hpp>
+#include <machine/opcode_handlers/vector.hpp>
+#include <machine/opcode_handlers/bit.hpp>
+#include <machine/opcode_handlers/select.hpp>
+#include <machine/opcode_handlers/block.hpp>
@@ -1,5 +1,3 @@
-#ifndef MC64K_MACHINE_OPCODE_HANDLERS_ARITHMETIC_HPP
-    #define MC64K_MACHINE_OPCODE_HANDLERS_ARITHMETIC_HPP
 /**
  *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
  *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
@@ -16,7 +14,8 @@
 /**
  * Declares the actual handlers for the main opcodes.
  *
- * This file is intended to be by a source and requires the following macros are defined:
+ * This file is intended to be included by a source, possibly more than once, and requires the
+ * following macros are defined:
  *
  * defOp(NAME) - This defines the handler. This could generate a case statement, label,
  *               function definition, depending on how the interpreter build is configured.
@@ -33,6 +32,12 @@
  *               the handler does not modify the the status register and so the interpreter
  *               may choose to skip the check.
  *
+ * check()     - As status(), but the check is required even for verified code, e.g. host calls
+ *               or sub-operations that can only be refused at run time.
+ *
+ * jump()      - This macro defines code that exits from the handler after a computed transfer
+ *               of control, where the destination may not be verified.
+ *
  */
 
 
@@ -480,13 +485,13 @@ defOp(FASIN_D) {
  */
 defOp(FATAN_S) {
     dyadic(SIZE_LONG);
-    asSingle(pDstEA) = std::atan(asSingle(pSrcEA));
+    asSingle(pDstEA) = Transcendental::atan(asSingle(pSrcEA));
     status();
 }
 
 defOp(FATAN_D) {
     dyadic(SIZE_QUAD);
-    asDouble(pDstEA) = std::atan(asDouble(pSrcEA));
+    asDouble(pDstEA) = Transcendental::atan(asDouble(pSrcEA));
     status();
 }
 
@@ -495,13 +500,13 @@ defOp(FATAN_D) {
  */
 defOp(FCOS_S) {
     dyadic(SIZE_LONG);
-    asSingle(pDstEA) = std::cos(asSingle(pSrcEA));
+    asSingle(pDstEA) = Transcendental::cos(asSingle(pSrcEA));
     status();
 }
 
 defOp(FCOS_D) {
     dyadic(SIZE_QUAD);
-    asDouble(pDstEA) = std::cos(asDouble(pSrcEA));
+    asDouble(pDstEA) = Transcendental::cos(asDouble(pSrcEA));
     status();
 }
 
@@ -510,13 +515,13 @@ defOp(FCOS_D) {
  */
 defOp(FSIN_S) {
     dyadic(SIZE_LONG);
-    asSingle(pDstEA) = std::sin(asSingle(pSrcEA));
+    asSingle(pDstEA) = Transcendental::sin(asSingle(pSrcEA));
     status();
 }
 
 defOp(FSIN_D) {
     dyadic(SIZE_QUAD);
-    asDouble(pDstEA) = std::sin(asDouble(pSrcEA));
+    asDouble(pDstEA) = Transcendental::sin(asDouble(pSrcEA));
     status();
 }
 
@@ -525,17 +530,13 @@ defOp(FSIN_D) {
  */
 defOp(FSINCOS_S) {
     dyadic(SIZE_LONG);
-    float32 f = asSingle(pSrcEA);
-    asSingle(pDstEA) = std::sin(f);
-    asSingle(pSrcEA) = std::cos(f);
+    Transcendental::sincos(asSingle(pSrcEA), asSingle(pDstEA), asSingle(pSrcEA));
     status();
 }
 
 defOp(FSINCOS_D) {
     dyadic(SIZE_QUAD);
-    float64 f = asDouble(pSrcEA);
-    asDouble(pDstEA) = std::sin(f);
-    asDouble(pSrcEA) = std::cos(f);
+    Transcendental::sincos(asDouble(pSrcEA), asDouble(pDstEA), asDouble(pSrcEA));
     status();
 }
 
@@ -544,13 +545,13 @@ defOp(FSINCOS_D) {
  */
 defOp(FTAN_S) {
     dyadic(SIZE_LONG);
-    asSingle(pDstEA) = std::tan(asSingle(pSrcEA));
+    asSingle(pDstEA) = Transcendental::tan(asSingle(pSrcEA));
     status();
 }
 
 defOp(FTAN_D) {
     dyadic(SIZE_QUAD);
-    asDouble(pDstEA) = std::tan(asDouble(pSrcEA));
+    asDouble(pDstEA) = Transcendental::tan(asDouble(pSrcEA));
     status();
 }
 
@@ -559,13 +560,13 @@ defOp(FTAN_D) {
  */
 defOp(FETOX_S) {
     dyadic(SIZE_LONG);
-    asSingle(pDstEA) = std::exp(asSingle(pSrcEA));
+    asSingle(pDstEA) = Transcendental::exp(asSingle(pSrcEA));
     status();
 }
 
 defOp(FETOX_D) {
     dyadic(SIZE_QUAD);
-    asDouble(pDstEA) = std::exp(asDouble(pSrcEA));
+    asDouble(pDstEA) = Transcendental::exp(asDouble(pSrcEA));
     status();
 }
 
@@ -574,13 +575,13 @@ defOp(FETOX_D) {
  */
 defOp(FLOGN_S) {
     dyadic(SIZE_LONG);
-    asSingle(pDstEA) = std::log(asSingle(pSrcEA));
+    asSingle(pDstEA) = Transcendental::log(asSingle(pSrcEA));
     status();
 }
 
 defOp(FLOGN_D) {
     dyadic(SIZE_QUAD);
-    asDouble(pDstEA) = std::log(asDouble(pSrcEA));
+    asDouble(pDstEA) = Transcendental::log(asDouble(pSrcEA));
     status();
 }
 
@@ -589,13 +590,13 @@ defOp(FLOGN_D) {
  */
 defOp(FLOG2_S) {
     dyadic(SIZE_LONG);
-    asSingle(pDstEA) = std::log2(asSingle(pSrcEA));
+    asSingle(pDstEA) = Transcendental::log2(asSingle(pSrcEA));
     status();
 }
 
 defOp(FLOG2_D) {
     dyadic(SIZE_QUAD);
-    asDouble(pDstEA) = std::log2(asDouble(pSrcEA));
+    asDouble(pDstEA) = Transcendental::log2(asDouble(pSrcEA));
     status();
 }
 
@@ -604,14 +605,12 @@ defOp(FLOG2_D) {
  */
 defOp(FTWOTOX_S) {
     dyadic(SIZE_LONG);
-    asSingle(pDstEA) = std::exp2(asSingle(pSrcEA));
+    asSingle(pDstEA) = Transcendental::exp2(asSingle(pSrcEA));
     status();
 }
 
 defOp(FTWOTOX_D) {
     dyadic(SIZE_QUAD);
-    asDouble(pDstEA) = std::exp2(asDouble(pSrcEA));
+    asDouble(pDstEA) = Transcendental::exp2(asDouble(pSrcEA));
     status();
 }
-
-#endif
@@ -1,5 +1,3 @@
-#ifndef MC64K_MACHINE_OPCODE_HANDLERS_LOGIC_HPP
-    #define MC64K_MACHINE_OPCODE_HANDLERS_LOGIC_HPP
 /**
  *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
  *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
@@ -16,7 +14,8 @@
 /**
  * Declares the actual handlers for the main opcodes.
  *
- * This file is intended to be by a source and requires the following macros are defined:
+ * This file is intended to be included by a source, possibly more than once, and requires the
+ * following macros are defined:
  *
  * defOp(NAME) - This defines the handler. This could generate a case statement, label,
  *               function definition, depending on how the interpreter build is configured.
@@ -33,6 +32,12 @@
  *               the handler does not modify the the status register and so the interpreter
  *               may choose to skip the check.
  *
+ * check()     - As status(), but the check is required even for verified code, e.g. host calls
+ *               or sub-operations that can only be refused at run time.
+ *
+ * jump()      - This macro defines code that exits from the handler after a computed transfer
+ *               of control, where the destination may not be verified.
+ *
  */
 
 /**
@@ -303,5 +308,3 @@ defOp(BSET_Q) {
     asUQuad(pDstEA) |= (uint64) (1 << (asUByte(pSrcEA) & 63));
     status();
 }
-
-#endif
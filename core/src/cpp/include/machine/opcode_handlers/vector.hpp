@@ -0,0 +1,50 @@
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+/**
+ * Declares the actual handlers for the main opcodes.
+ *
+ * This file is intended to be included by a source, possibly more than once, and requires the
+ * following macros are defined:
+ *
+ * defOp(NAME) - This defines the handler. This could generate a case statement, label,
+ *               function definition, depending on how the interpreter build is configured.
+ *               The parameter is expected to match the Opcode:: enumerated operation names.
+ *
+ * end()       - This macro defines code that exits from the handler with the explicit
+ *               requrement to halt further execution.
+ *
+ * status()    - This macro defines code that exits from the handler with the explicit
+ *               requirement to check the status register before continuing, e.g. that the
+ *               handler could have set an error condition.
+ *
+ * next()      - This macro defines code that exits from the handler with the indication that
+ *               the handler does not modify the the status register and so the interpreter
+ *               may choose to skip the check.
+ *
+ * check()     - As status(), but the check is required even for verified code, e.g. host calls
+ *               or sub-operations that can only be refused at run time.
+ *
+ * jump()      - This macro defines code that exits from the handler after a computed transfer
+ *               of control, where the destination may not be verified.
+ *
+ */
+
+
+/**
+ * Packed vector operation. The sub-operation is decoded, and may be refused, by handleVEC().
+ */
+defOp(VEC) {
+    handleVEC();
+    check();
+}
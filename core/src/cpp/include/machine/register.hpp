@@ -185,5 +185,52 @@ union FPRegister {
     }
 };
 
+/**
+ * VRegister
+ *
+ * Packed vector register definition. Each register is 256 bits and can be viewed as lanes of any of the integer or
+ * floating point types.
+ */
+union alignas(32) VRegister {
+    public:
+        enum Names {
+            V0   = 0,
+            V1   = 1,
+            V2   = 2,
+            V3   = 3,
+            V4   = 4,
+            V5   = 5,
+            V6   = 6,
+            V7   = 7,
+            V8   = 8,
+            V9   = 9,
+            V10  = 10,
+            V11  = 11,
+            V12  = 12,
+            V13  = 13,
+            V14  = 14,
+            V15  = 15,
+            MAX  = 16,
+            MASK = 0xF
+        };
+
+        enum {
+            SIZE = 32
+        };
+
+        uint64  auQuad[SIZE / sizeof(uint64)];
+        int64   aiQuad[SIZE / sizeof(int64)];
+        uint32  auLong[SIZE / sizeof(uint32)];
+        int32   aiLong[SIZE / sizeof(int32)];
+        uint16  auWord[SIZE / sizeof(uint16)];
+        int16   aiWord[SIZE / sizeof(int16)];
+        uint8   auByte[SIZE];
+        int8    aiByte[SIZE];
+        float64 afDouble[SIZE / sizeof(float64)];
+        float32 afSingle[SIZE / sizeof(float32)];
+
+        VRegister() : auQuad{0, 0, 0, 0} {}
+};
+
 } // namespace
 #endif
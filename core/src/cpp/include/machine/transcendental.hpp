@@ -0,0 +1,356 @@
+#ifndef MC64K_MACHINE_TRANSCENDENTAL_HPP
+    #define MC64K_MACHINE_TRANSCENDENTAL_HPP
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+#include <cmath>
+#include <cstring>
+#include <mc64k.hpp>
+
+/**
+ * Accuracy of the transcendental FPU operations, selected at build time (see VM_FPU_ACCURACY in the Makefile):
+ *
+ *   0 - Exact:   The host C++ standard library.
+ *   1 - Fast:    Polynomial approximations, good to about single precision.
+ *   2 - Fastest: Low order approximations, for effects where a few parts in 10^5 don't matter.
+ *
+ * The maximum errors of the approximations are documented per function below. Arguments outside the range of an
+ * approximation (including infinities and NaN) are passed to the standard library, so the results there are exact.
+ * Approximations are evaluated in double precision for both operation sizes.
+ */
+#ifndef FPU_ACCURACY
+    #define FPU_ACCURACY 0
+#endif
+
+namespace MC64K::Machine::Transcendental {
+
+enum Accuracy {
+    EXACT   = 0,
+    FAST    = 1,
+    FASTEST = 2
+};
+
+constexpr Accuracy const ACCURACY = (Accuracy)FPU_ACCURACY;
+
+static_assert(ACCURACY >= EXACT && ACCURACY <= FASTEST, "Invalid FPU_ACCURACY");
+
+namespace Approx {
+
+constexpr float64 const PI_OVER_2    = 1.57079632679489661923;
+constexpr float64 const PI_OVER_6    = 0.52359877559829887308;
+constexpr float64 const TWO_OVER_PI  = 0.63661977236758134308;
+constexpr float64 const TAN_PI_12    = 0.26794919243112270647;
+constexpr float64 const SQRT_3       = 1.73205080756887729353;
+constexpr float64 const SQRT_2       = 1.41421356237309504880;
+constexpr float64 const LN_2         = 0.69314718055994530942;
+constexpr float64 const LOG2_E       = 1.44269504088896340736;
+
+// Cody-Waite split of pi/2. The upper part has 33 significant bits, so k * PIO2_HI is exact for |k| < 2^20.
+constexpr float64 const PIO2_HI      = 1.57079632673412561417e+00;
+constexpr float64 const PIO2_LO      = 6.07710050650619224932e-11;
+constexpr float64 const REDUCE_LIMIT = 1.0e6;
+
+// Fast path limits for the exponential and logarithm
+constexpr float64 const EXP2_MIN     = -1022.0;
+constexpr float64 const EXP2_MAX     = 1023.0;
+constexpr float64 const LOG_MIN      = 2.2250738585072014e-308;
+constexpr float64 const LOG_MAX      = 1.7976931348623157e+308;
+
+/**
+ * Sine and cosine of r in [-pi/4, pi/4], by truncated Taylor series.
+ *
+ * Fast:    Max absolute error 2.5e-8, for sine and cosine of any argument
+ * Fastest: Max absolute error 3.7e-5
+ */
+inline float64 sinPoly(float64 fR) {
+    float64 fZ = fR * fR;
+    if constexpr (FASTEST == ACCURACY) {
+        return fR + fR * fZ * (-1.0/6.0 + fZ * (1.0/120.0));
+    } else {
+        return fR + fR * fZ * (-1.0/6.0 + fZ * (1.0/120.0 + fZ * (-1.0/5040.0 + fZ * (1.0/362880.0))));
+    }
+}
+
+inline float64 cosPoly(float64 fR) {
+    float64 fZ = fR * fR;
+    if constexpr (FASTEST == ACCURACY) {
+        return 1.0 + fZ * (-0.5 + fZ * (1.0/24.0 + fZ * (-1.0/720.0)));
+    } else {
+        return 1.0 + fZ * (-0.5 + fZ * (1.0/24.0 + fZ * (-1.0/720.0 + fZ * (1.0/40320.0))));
+    }
+}
+
+/**
+ * Reduces fX to r in [-pi/4, pi/4] and returns the quadrant, i.e. fX = quadrant * pi/2 + r.
+ * Requires |fX| < REDUCE_LIMIT.
+ */
+inline uint32 reduce(float64 fX, float64& rfR) {
+    float64 fK = std::rint(fX * TWO_OVER_PI);
+    rfR = (fX - fK * PIO2_HI) - fK * PIO2_LO;
+    return (uint32)(int32)fK & 3;
+}
+
+inline float64 sin(float64 fX) {
+    if (!(std::fabs(fX) < REDUCE_LIMIT)) {
+        return std::sin(fX);
+    }
+    float64 fR;
+    uint32  uQuadrant = reduce(fX, fR);
+    float64 fResult   = (uQuadrant & 1) ? cosPoly(fR) : sinPoly(fR);
+    return (uQuadrant & 2) ? -fResult : fResult;
+}
+
+inline float64 cos(float64 fX) {
+    if (!(std::fabs(fX) < REDUCE_LIMIT)) {
+        return std::cos(fX);
+    }
+    float64 fR;
+    uint32  uQuadrant = reduce(fX, fR);
+    float64 fResult   = (uQuadrant & 1) ? sinPoly(fR) : cosPoly(fR);
+    return ((uQuadrant + 1) & 2) ? -fResult : fResult;
+}
+
+inline void sincos(float64 fX, float64& rfSin, float64& rfCos) {
+    if (!(std::fabs(fX) < REDUCE_LIMIT)) {
+        rfSin = std::sin(fX);
+        rfCos = std::cos(fX);
+        return;
+    }
+    float64 fR;
+    uint32  uQuadrant = reduce(fX, fR);
+    float64 fS = sinPoly(fR);
+    float64 fC = cosPoly(fR);
+    if (uQuadrant & 1) {
+        float64 fT = fS;
+        fS = fC;
+        fC = -fT;
+    }
+    if (uQuadrant & 2) {
+        fS = -fS;
+        fC = -fC;
+    }
+    rfSin = fS;
+    rfCos = fC;
+}
+
+/**
+ * Tangent as the ratio of the above. The relative error grows without bound close to the poles.
+ */
+inline float64 tan(float64 fX) {
+    float64 fS, fC;
+    sincos(fX, fS, fC);
+    return fS / fC;
+}
+
+/**
+ * Two to the power of fX, by 2^k * 2^f where k is the nearest integer and f in [-0.5, 0.5] is evaluated as the
+ * truncated Taylor series of e^(f * ln 2).
+ *
+ * Fast:    Max relative error 7.1e-9
+ * Fastest: Max relative error 5.6e-5
+ */
+inline float64 exp2(float64 fX) {
+    if (!(fX > EXP2_MIN && fX < EXP2_MAX)) {
+        return std::exp2(fX);
+    }
+    float64 fK = std::rint(fX);
+    float64 fU = (fX - fK) * LN_2;
+    float64 fP;
+    if constexpr (FASTEST == ACCURACY) {
+        fP = 1.0 + fU * (1.0 + fU * (1.0/2.0 + fU * (1.0/6.0 + fU * (1.0/24.0))));
+    } else {
+        fP = 1.0/120.0 + fU * (1.0/720.0 + fU * (1.0/5040.0));
+        fP = 1.0 + fU * (1.0 + fU * (1.0/2.0 + fU * (1.0/6.0 + fU * (1.0/24.0 + fU * fP))));
+    }
+    uint64  uScale = (uint64)((int64)fK + 1023) << 52;
+    float64 fScale;
+    std::memcpy(&fScale, &uScale, sizeof(fScale));
+    return fP * fScale;
+}
+
+inline float64 exp(float64 fX) {
+    return exp2(fX * LOG2_E);
+}
+
+/**
+ * Natural logarithm of the mantissa m in [sqrt(0.5), sqrt(2)), by the series for 2 * atanh((m - 1) / (m + 1)).
+ * The binary exponent is returned separately so that the base 2 logarithm doesn't lose precision.
+ *
+ * Fast:    Max absolute error 2.9e-8 (natural), 4.3e-8 (base 2)
+ * Fastest: Max absolute error 6.1e-5 (natural), 8.8e-5 (base 2)
+ */
+inline float64 logMantissa(float64 fX, float64& rfExponent) {
+    uint64 uBits;
+    std::memcpy(&uBits, &fX, sizeof(uBits));
+    int64 iExponent = (int64)((uBits >> 52) & 0x7FF) - 1023;
+    uBits = (uBits & 0x000FFFFFFFFFFFFFULL) | 0x3FF0000000000000ULL;
+    float64 fM;
+    std::memcpy(&fM, &uBits, sizeof(fM));
+    if (fM > SQRT_2) {
+        fM *= 0.5;
+        ++iExponent;
+    }
+    rfExponent = (float64)iExponent;
+    float64 fS = (fM - 1.0) / (fM + 1.0);
+    float64 fZ = fS * fS;
+    if constexpr (FASTEST == ACCURACY) {
+        return 2.0 * fS * (1.0 + fZ * (1.0/3.0));
+    } else {
+        return 2.0 * fS * (1.0 + fZ * (1.0/3.0 + fZ * (1.0/5.0 + fZ * (1.0/7.0))));
+    }
+}
+
+inline float64 log(float64 fX) {
+    if (!(fX >= LOG_MIN && fX <= LOG_MAX)) {
+        return std::log(fX);
+    }
+    float64 fExponent;
+    float64 fLog = logMantissa(fX, fExponent);
+    return fExponent * LN_2 + fLog;
+}
+
+inline float64 log2(float64 fX) {
+    if (!(fX >= LOG_MIN && fX <= LOG_MAX)) {
+        return std::log2(fX);
+    }
+    float64 fExponent;
+    float64 fLog = logMantissa(fX, fExponent);
+    return fExponent + fLog * LOG2_E;
+}
+
+/**
+ * Arc tangent. The argument is reduced to [0, 1] by atan(x) = pi/2 - atan(1/x) and then to [0, tan(pi/12)] by
+ * atan(x) = pi/6 + atan((x * sqrt(3) - 1) / (x + sqrt(3))), where the truncated Taylor series is used.
+ *
+ * Fast:    Max absolute error 4.4e-8
+ * Fastest: Max absolute error 1.4e-5
+ */
+inline float64 atan(float64 fX) {
+    float64 fA      = std::fabs(fX);
+    bool    bInvert = fA > 1.0;
+    if (bInvert) {
+        fA = 1.0 / fA;
+    }
+    bool bShift = fA > TAN_PI_12;
+    if (bShift) {
+        fA = (fA * SQRT_3 - 1.0) / (fA + SQRT_3);
+    }
+    float64 fZ = fA * fA;
+    float64 fResult;
+    if constexpr (FASTEST == ACCURACY) {
+        fResult = fA * (1.0 + fZ * (-1.0/3.0 + fZ * (1.0/5.0)));
+    } else {
+        fResult = fA * (1.0 + fZ * (-1.0/3.0 + fZ * (1.0/5.0 + fZ * (-1.0/7.0 + fZ * (1.0/9.0)))));
+    }
+    if (bShift) {
+        fResult += PI_OVER_6;
+    }
+    if (bInvert) {
+        fResult = PI_OVER_2 - fResult;
+    }
+    return std::copysign(fResult, fX);
+}
+
+} // namespace Approx
+
+/**
+ * The operations used by the FPU opcode handlers, for either operation size.
+ */
+template<typename T>
+inline T sin(T fX) {
+    if constexpr (EXACT == ACCURACY) {
+        return std::sin(fX);
+    } else {
+        return (T)Approx::sin((float64)fX);
+    }
+}
+
+template<typename T>
+inline T cos(T fX) {
+    if constexpr (EXACT == ACCURACY) {
+        return std::cos(fX);
+    } else {
+        return (T)Approx::cos((float64)fX);
+    }
+}
+
+template<typename T>
+inline void sincos(T fX, T& rfSin, T& rfCos) {
+    if constexpr (EXACT == ACCURACY) {
+        rfSin = std::sin(fX);
+        rfCos = std::cos(fX);
+    } else {
+        float64 fSin, fCos;
+        Approx::sincos((float64)fX, fSin, fCos);
+        rfSin = (T)fSin;
+        rfCos = (T)fCos;
+    }
+}
+
+template<typename T>
+inline T tan(T fX) {
+    if constexpr (EXACT == ACCURACY) {
+        return std::tan(fX);
+    } else {
+        return (T)Approx::tan((float64)fX);
+    }
+}
+
+template<typename T>
+inline T atan(T fX) {
+    if constexpr (EXACT == ACCURACY) {
+        return std::atan(fX);
+    } else {
+        return (T)Approx::atan((float64)fX);
+    }
+}
+
+template<typename T>
+inline T exp(T fX) {
+    if constexpr (EXACT == ACCURACY) {
+        return std::exp(fX);
+    } else {
+        return (T)Approx::exp((float64)fX);
+    }
+}
+
+template<typename T>
+inline T exp2(T fX) {
+    if constexpr (EXACT == ACCURACY) {
+        return std::exp2(fX);
+    } else {
+        return (T)Approx::exp2((float64)fX);
+    }
+}
+
+template<typename T>
+inline T log(T fX) {
+    if constexpr (EXACT == ACCURACY) {
+        return std::log(fX);
+    } else {
+        return (T)Approx::log((float64)fX);
+    }
+}
+
+template<typename T>
+inline T log2(T fX) {
+    if constexpr (EXACT == ACCURACY) {
+        return std::log2(fX);
+    } else {
+        return (T)Approx::log2((float64)fX);
+    }
+}
+
+} // namespace
+#endif
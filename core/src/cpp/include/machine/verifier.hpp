@@ -0,0 +1,177 @@
+#ifndef MC64K_MACHINE_VERIFIER_HPP
+    #define MC64K_MACHINE_VERIFIER_HPP
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+#include <vector>
+#include <misc/scalar.hpp>
+
+namespace MC64K::Loader {
+    class Executable;
+    class SymbolSet;
+}
+
+namespace MC64K::Machine {
+
+/**
+ * Verifier
+ *
+ * Load time bytecode verification. Starting from the exported code symbols, every statically reachable instruction
+ * is decoded once and checked for a valid opcode, condition, sub-operation and effective address modes, and for
+ * branch targets that land on instruction boundaries within the bytecode. Any failure rejects the executable.
+ *
+ * Addresses taken with a PC relative lea or pea are treated as likely code (callbacks, jump tables) and verified
+ * speculatively. Failures there are not an error, the code just isn't marked as verified.
+ *
+ * Instructions that start at a verified address can be executed by the interpreter without checking the status
+ * after each operation, since the only way for them to change it is through a host call, stop, the final rts or a
+ * sub-operation that is refused at run time, e.g. a vector operation the build does not implement. Those handlers
+ * still check the status.
+ */
+class Verifier {
+
+    public:
+        /**
+         * Constructor. Performs the verification.
+         *
+         * @param  Loader::Executable const& roExecutable
+         * @throws Error
+         */
+        Verifier(Loader::Executable const& roExecutable);
+
+        /**
+         * Check if an address is the start of a verified instruction.
+         *
+         * @param  uint8 const* puAddress
+         * @return bool
+         */
+        bool isVerified(uint8 const* puAddress) const;
+
+        /**
+         * Obtain the bytecode offsets of the import symbol operands in verified code, i.e. those that can safely be
+         * bound to their linked address by the loader.
+         *
+         * @return std::vector<uint64> const&
+         */
+        std::vector<uint64> const& getImportReferences() const;
+
+    private:
+        enum State {
+            STATE_UNVISITED   = 0,
+            STATE_INSTRUCTION = 1,
+            STATE_OPERAND     = 2
+        };
+
+        Loader::Executable const& roExecutable;
+        uint8 const*              puByteCode;
+        uint64                    uByteCodeSize;
+        uint64                    uVerifiedSize;
+        std::vector<uint8>        auState;
+        std::vector<uint64>       auPending;
+        std::vector<uint64>       auSpeculative;
+        std::vector<uint64>       auClaimed;
+        std::vector<uint64>       auImportReferences;
+        char const*               sIssue;
+        uint32                    uNumUnresolved;
+        bool                      bSpeculative;
+
+        /**
+         * Walk everything reachable from the given offset. On failure, sIssue describes the problem and the offset
+         * of the failing instruction is returned via ruFailedAt.
+         *
+         * @param  uint64 const uOffset
+         * @param  uint64&      ruFailedAt
+         * @return bool
+         */
+        bool walk(uint64 const uOffset, uint64& ruFailedAt);
+
+        /**
+         * Decode a single instruction, queueing any branch targets.
+         *
+         * @param  uint64 const uOffset
+         * @param  uint64&      ruLength
+         * @param  bool&        rbContinues - set when execution can fall through to the next instruction
+         * @return bool
+         */
+        bool decodeInstruction(uint64 const uOffset, uint64& ruLength, bool& rbContinues);
+
+        /**
+         * Decode an effective address at the given position, advancing it.
+         *
+         * @param  uint64&    ruPosition
+         * @param  bool const bFirst - SAME_AS_DEST is only meaningful after some other operand
+         * @param  bool const bAddressTaken - PC relative targets are queued as speculative code
+         * @return bool
+         */
+        bool decodeEffectiveAddress(uint64& ruPosition, bool const bFirst, bool const bAddressTaken = false);
+
+        /**
+         * Queue a branch target, given relative to the end of the instruction.
+         *
+         * @param  uint64 const uEnd
+         * @param  int64  const iDisplacement
+         * @return bool
+         */
+        bool queueBranch(uint64 const uEnd, int64 const iDisplacement);
+
+        /**
+         * Check that an import table reference is valid and has been linked
+         *
+         * @param  uint32 const uIndex
+         * @return bool
+         */
+        bool checkImport(uint32 const uIndex);
+
+        /**
+         * Read a little endian 32-bit value from the bytecode. Bounds are checked by the caller.
+         *
+         * @param  uint64 const uPosition
+         * @return int32
+         */
+        int32 readLong(uint64 const uPosition) const;
+
+        /**
+         * Record the reason for a failure.
+         *
+         * @param  char const* sReason
+         * @return false
+         */
+        bool fail(char const* sReason);
+};
+
+/**
+ * @inheritDoc
+ */
+inline bool Verifier::fail(char const* sReason) {
+    sIssue = sReason;
+    return false;
+}
+
+/**
+ * @inheritDoc
+ */
+inline bool Verifier::isVerified(uint8 const* puAddress) const {
+    uint64 uOffset = (uint64)(puAddress - puByteCode);
+    return uOffset < uVerifiedSize && STATE_INSTRUCTION == auState[uOffset];
+}
+
+/**
+ * @inheritDoc
+ */
+inline std::vector<uint64> const& Verifier::getImportReferences() const {
+    return auImportReferences;
+}
+
+} // namespace
+#endif
@@ -0,0 +1,150 @@
+#ifndef MC64K_SYNTH_RENDER_HPP
+    #define MC64K_SYNTH_RENDER_HPP
+
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+#include <functional>
+#include <string>
+#include <vector>
+#include <misc/scalar.hpp>
+#include <synth/signal.hpp>
+
+namespace MC64K::Synth::Audio {
+
+/**
+ * OfflineRenderer
+ *
+ * Renders one or more jobs to disk as fast as possible. Each job is a set of independent voices
+ * whose outputs are summed and written as a 16-bit mono file at PROCESS_RATE. Voices are described
+ * by factories rather than instances so that each one is constructed on the worker thread that
+ * renders it, meaning no stream graph is ever shared between threads.
+ *
+ * Voices of all jobs are distributed over the available worker threads. Once every voice of a job
+ * has been rendered, the job is mixed down, dithered, converted and written.
+ *
+ * Jobs can also be loaded from a text description, see loadJob().
+ */
+class OfflineRenderer {
+
+    public:
+        /**
+         * Builds the stream for a voice. Called once, on the worker thread.
+         */
+        typedef std::function<Signal::IStream::Ptr()> VoiceFactory;
+
+        enum Format {
+            RAW_16 = 0, // Headerless signed 16-bit little endian
+            WAV_16 = 1, // RIFF WAVE, signed 16-bit PCM
+        };
+
+        /**
+         * A voice occupies uPackets packets of its job, starting at uStartPacket. A uPackets of
+         * zero means to the end of the job.
+         */
+        struct Voice {
+            VoiceFactory cCreate;
+            size_t       uStartPacket;
+            size_t       uPackets;
+        };
+
+        struct Job {
+            std::vector<Voice>        aVoices;
+            std::string               sFileName;
+            size_t                    uPackets;
+            float32                   fLevel;
+            Format                    eFormat;
+        };
+
+        /**
+         * Timing summary for a call to render()
+         */
+        struct Statistics {
+            float64 fRenderSeconds;    // Wall time spent generating packets
+            float64 fOutputSeconds;    // Wall time spent mixing, converting and writing
+            float64 fAudioSeconds;     // Total duration of audio generated, over all voices
+            float64 fRealtimeFactor;   // fAudioSeconds / (fRenderSeconds + fOutputSeconds)
+            uint32  uThreads;
+            uint32  uVoices;
+        };
+
+        /**
+         * @param uint32 uMaxThreads - zero to use all available cores
+         */
+        OfflineRenderer(uint32 uMaxThreads = 0);
+
+        /**
+         * Queue a job for the next call to render()
+         *
+         * @param  Job const& roJob
+         * @return this
+         */
+        OfflineRenderer* addJob(Job const& roJob);
+
+        /**
+         * Parse a job description file and queue the job for the next call to render(). The file is
+         * line based, with # starting a comment. Each line is a keyword followed by its arguments:
+         *
+         *   output  <file>           Output file. A .wav extension selects WAV_16, otherwise RAW_16
+         *   level   <level>          Final mix level, default 1.0
+         *   tail    <seconds>        Time rendered after the last voice ends, default 0
+         *
+         * The current patch applies to each note that follows it:
+         *
+         *   wave    <name>           sine, triangle, saw_down, saw_up, square, pulse, pokey or noise
+         *   attack  <seconds>        Level envelope attack time to full level
+         *   decay   <seconds>        Level envelope decay time to the sustain level
+         *   sustain <level>          Level envelope sustain level
+         *   release <seconds>        Level envelope release time after the note ends
+         *   filter  <mode> <cutoff> <resonance>
+         *                            low_pass, hi_pass, band_pass or band_reject, with the cutoff
+         *                            and resonance in the range 0 to 1. Use "filter off" to remove.
+         *
+         * The sequence is a list of notes, each rendered as an independent voice:
+         *
+         *   note    <name> <start> <duration> [velocity]
+         *                            Note name as per Note::getNumber(), start and duration in
+         *                            seconds and an optional MIDI style velocity, 0 to 127
+         *                            (default 127), that scales the level envelope
+         *
+         * @param  char const* sFileName
+         * @return bool - false if the description could not be read or contains errors
+         */
+        bool loadJob(char const* sFileName);
+
+        /**
+         * Render all queued jobs. The queue is emptied on completion.
+         *
+         * @return Statistics
+         */
+        Statistics render();
+
+        /**
+         * Convert float samples to signed 16-bit with TPDF dither. Uses AVX2 where available.
+         *
+         * @param int16*         piDestination
+         * @param float32 const* pfSource
+         * @param size_t         uCount
+         * @param uint32&        ruSeed - dither PRNG state, updated
+         */
+        static void convertDither(int16* piDestination, float32 const* pfSource, size_t uCount, uint32& ruSeed);
+
+    private:
+        std::vector<Job> aJobs;
+        uint32           uMaxThreads;
+
+        bool writeJob(Job const& roJob, float32 const* pfMix, size_t uSamples);
+};
+
+}
+#endif
@@ -22,12 +22,25 @@ namespace MC64K::Synth::Audio::Signal::Envelope {
 class DecayPulse : public IEnvelope {
 
     protected:
-        Packet::Ptr poLastPacket;
-        float32     fInitial;
-        float32     fHalflife;
-        float32     fTarget;
-        float64     fCurrent;
-        float64     fDecayPerSample;
+        /**
+         * Once the remaining decay falls below this, the envelope is considered to have reached its target
+         * and the shared constant packet is emitted instead.
+         */
+        static constexpr float64 const MIN_DECAY_LEVEL = 1.e-6;
+
+        Packet::Ptr      poTargetPacket;
+        Packet::ConstPtr poLastOutput;
+        float32          fInitial;
+        float32          fHalflife;
+        float32          fTarget;
+        float64          fCurrent;
+        float64          fDecayPerSample;
+        float64          fDecayPerPacket;
+
+        /**
+         * Decay factor for each sample position within a packet, relative to the start of the packet.
+         */
+        float32          afDecayPowers[PACKET_SIZE];
 
         void recalculateDecay();
 
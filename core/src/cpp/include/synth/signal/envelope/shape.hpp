@@ -52,29 +52,29 @@ class Shape : public IEnvelope {
 
     private:
         /**
-         * Internal representation of envelope point, expressed in terms of output sample position
-         * and higher precision level (after taking into account both time and level scale properties.
+         * Precompiled linear segment, expressed in output sample positions after taking into account both
+         * the time and level scale properties. The output for sample position p within the segment is
+         * fIntercept + fSlope * (p + 1 - uStart). Segments with no slope carry a shared packet of their
+         * constant level that is emitted directly whenever a whole packet falls inside them.
          */
-        struct ProcessPoint {
-            size_t  uSamplePosition;
-            float64 fLevel;
+        struct Segment {
+            size_t      uStart;
+            float64     fIntercept;
+            float64     fSlope;
+            Packet::Ptr poConstant;
         };
 
-        Packet::Ptr   pFinalPacket;
+        std::unique_ptr<Point[]>   aoPoints;
+        std::unique_ptr<Segment[]> aoSegments;
 
-        std::unique_ptr<Point[]>        aoPoints;
-        std::unique_ptr<ProcessPoint[]> aoProcessPoints;
+        Packet::ConstPtr poLastOutput;
 
-        ProcessPoint* pNextProcessPoint;
-        size_t        uNumPoints;
-        size_t        uFinalSamplePosition;
-        size_t        uXOffset;
-        float64       fYOffset;
-        float64       fGradient;
+        size_t uNumPoints;
+        size_t uNumSegments;
+        size_t uSegment;
 
         void processPointList(float32 fInitial, Point const* aoInputPoints, size_t uNumPoints);
         void recalculate();
-        void updateInterpolants();
 };
 
 } // namespace
@@ -16,6 +16,7 @@
 
 #include <cmath>
 #include <unordered_map>
+#include <vector>
 #include <synth/signal.hpp>
 
 namespace MC64K::Synth::Audio::Signal::Operator {
@@ -38,10 +39,24 @@ class SimpleMixer : public TStreamCommon, protected TPacketIndexAware {
          */
         struct Channel {
             IStream::Ptr poSource;
+            ChannelID    uID;
             float32      fLevel;
         };
 
-        std::unordered_map<ChannelID, Channel> oChannels;
+        /**
+         * Channels are kept densely packed so that mixdown is a linear walk over the active inputs.
+         * The map is only consulted when a channel is added, removed or has its level changed.
+         */
+        std::vector<Channel> oChannels;
+        std::unordered_map<ChannelID, size_t> oChannelSlots;
+
+        /**
+         * Per-packet scratch for the inputs gathered for accumulation. Kept as members to avoid
+         * reallocating on every packet.
+         */
+        std::vector<Packet::ConstPtr> oInputPackets;
+        std::vector<Packet const*>    oInputPtrs;
+        std::vector<float32>          oInputLevels;
 
         Packet::Ptr poLastPacket;
 
@@ -14,6 +14,7 @@
  *    - 64-bit 680x0-inspired Virtual Machine and assembler -
  */
 
+#include <atomic>
 #include <cstring>
 #include <memory>
 #include <misc/scalar.hpp>
@@ -172,17 +173,38 @@ class Packet {
             return accumulate(poPacket.get(), fScale);
         }
 
+        /**
+         * Maximum number of input packets that accumulateMany() will sum per pass.
+         */
+        static constexpr size_t const MAX_ACCUMULATE = 8;
+
+        /**
+         * Accumulate with the scaled values of several other packets. Inputs are summed in passes
+         * of up to MAX_ACCUMULATE packets so that each output sample is loaded and stored once per
+         * pass rather than once per input.
+         *
+         * @param  Packet const* const* apoPackets
+         * @param  float32 const* afScales
+         * @param  size_t uCount
+         * @return this
+         */
+        Packet* accumulateMany(Packet const* const* apoPackets, float32 const* afScales, size_t uCount);
+
         static void dumpStats();
 
     private:
-        static size_t uNextIndex;
+        /**
+         * Packets may be produced on several threads at once during offline rendering, so the
+         * shared counters are atomic.
+         */
+        static std::atomic<size_t> uNextIndex;
 
         /**
          * Allocator stats
          */
-        static uint64 uPacketsCreated;
-        static uint64 uPacketsDestroyed;
-        static uint64 uPeakPacketsInUse;
+        static std::atomic<uint64> uPacketsCreated;
+        static std::atomic<uint64> uPacketsDestroyed;
+        static std::atomic<uint64> uPeakPacketsInUse;
         /**
          * Forbid explicit creation and deletion
          */
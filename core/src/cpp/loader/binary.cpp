@@ -45,32 +45,42 @@ Binary::~Binary() {
 /**
  * @inheritDoc
  */
-const Executable* Binary::load(char const* sFileName) {
+Executable* Binary::load(char const* sFileName) {
 
     open(sFileName);
 
-    uint8*      puTargetData = 0;
-    uint8*      puImportList = 0;
-    uint8*      puExportList = 0;
-    uint8*      puByteCode   = 0;
-    Executable* poExecutable = 0;
-
-    if (
-        (puTargetData = readChunkData(CHUNK_TARGET_ID)) &&
-        (validateTarget(puTargetData)) &&
-        (puImportList = readChunkData(CHUNK_IMPORT_LIST_ID)) &&
-        (puExportList = readChunkData(CHUNK_EXPORT_LIST_ID)) &&
-        (puByteCode   = readChunkData(CHUNK_BYTE_CODE_ID)) &&
-        (poExecutable = new (std::nothrow) Executable(
-            roHostDefinition,
-            puTargetData,
-            puByteCode,
-            puImportList,
-            puExportList)
-        )
-    ) {
+    uint8*      puTargetData  = 0;
+    uint8*      puImportList  = 0;
+    uint8*      puExportList  = 0;
+    uint8*      puByteCode    = 0;
+    uint64      uByteCodeSize = 0;
+    Executable* poExecutable  = 0;
+
+    try {
+        if (
+            (puTargetData = readChunkData(CHUNK_TARGET_ID)) &&
+            (validateTarget(puTargetData)) &&
+            (puImportList = readChunkData(CHUNK_IMPORT_LIST_ID)) &&
+            (puExportList = readChunkData(CHUNK_EXPORT_LIST_ID)) &&
+            (puByteCode   = readChunkData(CHUNK_BYTE_CODE_ID, &uByteCodeSize)) &&
+            (poExecutable = new (std::nothrow) Executable(
+                roHostDefinition,
+                puTargetData,
+                puByteCode,
+                uByteCodeSize,
+                puImportList,
+                puExportList)
+            )
+        ) {
+            close();
+            return poExecutable;
+        }
+    } catch (LinkError&) {
+        // The executable's symbol sets already own the import and export lists, but not the other chunks
         close();
-        return poExecutable;
+        std::free(puByteCode);
+        std::free(puTargetData);
+        throw;
     }
     close();
     std::free(puByteCode);
@@ -154,7 +164,7 @@ const Binary::ManifestEntry* Binary::findChunk(uint64 const uChunkID) {
 /**
  * @inheritDoc
  */
-uint8* Binary::readChunkData(uint64 const uChunkID) {
+uint8* Binary::readChunkData(uint64 const uChunkID, uint64* puSize) {
     uint64 auHeader[2] = { 0, 0 };
     uint64 uAllocSize  = 0;
     uint8* puRawData   = 0;
@@ -171,6 +181,9 @@ uint8* Binary::readChunkData(uint64 const uChunkID) {
         std::free(puRawData);
         return 0;
     }
+    if (puSize) {
+        *puSize = auHeader[1];
+    }
     return puRawData;
 }
 
@@ -16,6 +16,7 @@
 #include <new>
 #include <mc64k.hpp>
 #include <loader/executable.hpp>
+#include <bytecode/effective_address.hpp>
 #include <host/definition.hpp>
 
 namespace MC64K::Loader {
@@ -45,16 +46,22 @@ Executable::Executable(
     Host::Definition const& roDefinition,
     uint8 const* puRawTargetData,
     uint8 const* puRawByteCode,
+    uint64       uRawByteCodeSize,
     uint8*       puRawImportData,
     uint8*       puRawExportData
 ) :
     oImportedSymbols(0, puRawImportData),
     oExportedSymbols(0, puRawExportData),
     puTargetData(puRawTargetData),
-    puByteCode(puRawByteCode)
+    puByteCode(puRawByteCode),
+    uByteCodeSize(uRawByteCodeSize),
+    poDependencies(0),
+    uNumDependencies(0)
 {
     std::fprintf(stderr, "Loading object file as host '%s'\n", roDefinition.getName());
 
+    processDependencies();
+
     Symbol* poSymbol;
     uint32  uNumSymbols;
     if (
@@ -68,14 +75,20 @@ Executable::Executable(
             poSymbol[u].pRawData    = 0;
             sSymbolName = processSymbolName(sSymbolName, poSymbol[u].uFlags);
         }
-        oImportedSymbols.linkAgainst(roDefinition.getExportedSymbolSet());
+        try {
+            oImportedSymbols.linkAgainst(roDefinition.getExportedSymbolSet());
+        } catch (LinkError&) {
+            std::free((void*)poDependencies);
+            throw;
+        }
     }
 
     if (
         (uNumSymbols = *(uint32*)puRawExportData) &&
         (poSymbol    = oExportedSymbols.allocate(uNumSymbols))
     ) {
-        std::fprintf(stderr, "Linking %u exported symbols...\n", uNumSymbols);
+        // Exported symbols are linked to the host imports by the Runtime, on the thread running the interpreter.
+        std::fprintf(stderr, "Loading %u exported symbols...\n", uNumSymbols);
         uint32 const* puCodeOffsets = (uint32 const*)(puRawExportData + sizeof(uint32));
         char* sSymbolName = ((char*)puRawExportData) + sizeof(uint32) + uNumSymbols * sizeof(uint32);
         for (unsigned u = 0; u < uNumSymbols; ++u) {
@@ -83,10 +96,66 @@ Executable::Executable(
             poSymbol[u].puByteCode  = puRawByteCode + puCodeOffsets[u];
             sSymbolName = processSymbolName(sSymbolName, poSymbol[u].uFlags);
         }
-        roDefinition.getImportedSymbolSet().linkAgainst(oExportedSymbols);
     }
 }
 
+/**
+ * @inheritDoc
+ */
+void Executable::processDependencies() {
+    uint32 uNumEntries = *((uint32 const*)(puTargetData + TD_OFFSET_NUM_DEPS));
+    if (!uNumEntries) {
+        return;
+    }
+    if (!(poDependencies = (Dependency*)std::malloc(uNumEntries * sizeof(Dependency)))) {
+        throw MC64K::OutOfMemoryException();
+    }
+    Misc::Version const* poVersionTable = (Misc::Version const*)(puTargetData + TD_OFFSET_NUM_DEPS + sizeof(uint32));
+    char const* sName = (char const*)(poVersionTable + uNumEntries);
+    for (uint32 u = 0; u < uNumEntries; ++u) {
+        poDependencies[u].oVersion = poVersionTable[u];
+        poDependencies[u].sName    = sName;
+        while (*sName++);
+    }
+    uNumDependencies = uNumEntries;
+}
+
+/**
+ * @inheritDoc
+ */
+uint32 Executable::bindImportReferences(std::vector<uint64> const& auOffsets) {
+    using namespace MC64K::ByteCode;
+
+    // The bytecode is owned by this instance and is only rewritten before anything executes it.
+    uint8* puCode    = (uint8*)puByteCode;
+    uint32 uNumBound = 0;
+    for (uint64 uOffset : auOffsets) {
+        uint8* puOperand = puCode + uOffset;
+        uint32 uIndex;
+        std::memcpy(&uIndex, puOperand + 1, sizeof(uint32));
+
+        Symbol const& roSymbol = oImportedSymbols[uIndex];
+        int64 iDisplacement = (uint8 const*)roSymbol.pRawData - (puOperand + 1 + sizeof(int32));
+        if (iDisplacement != (int64)(int32)iDisplacement) {
+            std::fprintf(
+                stderr,
+                "\tUnable to bind import reference at 0x%lX to %s, out of displacement range\n",
+                uOffset,
+                roSymbol.sIdentifier
+            );
+            continue;
+        }
+        int32 iPCDisplacement = (int32)iDisplacement;
+        std::memcpy(puOperand + 1, &iPCDisplacement, sizeof(int32));
+        puOperand[0] = EffectiveAddress::OFS_OTHER | EffectiveAddress::Other::PC_IND_DSP;
+        ++uNumBound;
+    }
+    if (!auOffsets.empty()) {
+        std::fprintf(stderr, "Bound %u of %zu import references\n", uNumBound, auOffsets.size());
+    }
+    return uNumBound;
+}
+
 /**
  * @inheritDoc
  */
@@ -98,6 +167,7 @@ uint32 Executable::getStackSize() const {
  * @inheritDoc
  */
 Executable::~Executable() {
+    std::free((void*)poDependencies);
     std::free((void*)puByteCode);
     std::free((void*)puTargetData);
 }
@@ -119,6 +119,30 @@ void SymbolSet::linkAgainst(SymbolSet const& roOther) const {
     }
 }
 
+/**
+ * @inheritDoc
+ */
+void SymbolSet::checkAgainst(SymbolSet const& roOther) const {
+    for (size_t u = 0; u < uNumSymbols; ++u) {
+        Symbol* poMatched = roOther.find(
+            poSymbols[u].sIdentifier,
+            poSymbols[u].uFlags & Symbol::ACCESS_MASK
+        );
+        if (!poMatched || !poMatched->pRawData) {
+            std::fprintf(
+                stderr,
+                "\tUnable to match %4zu [%c%c%c] %s\n",
+                u,
+                (poSymbols[u].uFlags & Symbol::READ    ? 'r' : '-'),
+                (poSymbols[u].uFlags & Symbol::WRITE   ? 'w' : '-'),
+                (poSymbols[u].uFlags & Symbol::EXECUTE ? 'x' : '-'),
+                poSymbols[u].sIdentifier
+            );
+            throw LinkError();
+        }
+    }
+}
+
 /**
  * @inheritDoc
  */
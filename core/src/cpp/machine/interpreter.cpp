@@ -18,6 +18,7 @@
 #include <machine/error.hpp>
 #include <machine/limits.hpp>
 #include <machine/interpreter.hpp>
+#include <machine/verifier.hpp>
 #include <loader/executable.hpp>
 
 namespace MC64K::Machine {
@@ -36,18 +37,55 @@ void* pDstEA;
 
 GPRegister      Interpreter::aoGPR[GPRegister::MAX] = {};
 FPRegister      Interpreter::aoFPR[FPRegister::MAX] = {};
+VRegister       Interpreter::aoVR[VRegister::MAX]   = {};
 void*           Interpreter::pSrcEA                 = 0;
 void*           Interpreter::pTmpEA                 = 0;
 uint8*          Interpreter::puStackTop             = 0;
 uint8*          Interpreter::puStackBase            = 0;
 Loader::Symbol* Interpreter::poImportSymbols        = 0;
+Verifier const* Interpreter::poVerifier             = 0;
 uint32          Interpreter::uNumHCFVectors         = 0;
 uint32          Interpreter::uNumImportSymbols      = 0;
 
+Interpreter::HostFrame const* Interpreter::poHostFrame = 0;
+
 Interpreter::HCFVector const* Interpreter::pcHCFVectors   = 0;
+Interpreter::HostCall const*  Interpreter::pcHostCalls    = 0;
 Interpreter::OperationSize    Interpreter::eOperationSize = Interpreter::SIZE_BYTE;
 Interpreter::Status           Interpreter::eStatus        = Interpreter::UNINITIALISED;
 
+namespace {
+    void* allocateHeapStack(uint64 uSize) {
+        return std::calloc(uSize, 1);
+    }
+
+    void releaseHeapStack(void* pStack) {
+        std::free(pStack);
+    }
+
+    template<typename T>
+    void fillElements(void* pBuffer, T tValue, uint64 uCount) {
+        T* ptBuffer = (T*)pBuffer;
+        while (uCount--) {
+            *ptBuffer++ = tValue;
+        }
+    }
+
+    /**
+     * Default memory hooks, for when the host supplies none
+     */
+    Interpreter::MemoryHooks const oDefaultMemoryHooks = {
+        allocateHeapStack,
+        releaseHeapStack,
+        fillElements<uint8>,
+        fillElements<uint16>,
+        fillElements<uint32>,
+        fillElements<uint64>
+    };
+}
+
+Interpreter::MemoryHooks const* Interpreter::poMemoryHooks = &oDefaultMemoryHooks;
+
 /**
  * Human readable names for Interpreter::eStatus
  */
@@ -60,7 +98,9 @@ const char* asStatusNames[] = {
     "Unimplemented Opcode",
     "Unimplemented Effective Address",
     "Unimplemented Host Call",
-    "Invalid Entrypoint"
+    "Invalid Entrypoint",
+    "Unresolved Symbol",
+    "Illegal Effective Address"
 };
 
 /**
@@ -72,6 +112,20 @@ void Interpreter::initHCFVectors(Interpreter::HCFVector const* pcHCFVectors, uin
     Interpreter::uNumHCFVectors = uNumHCFVectors;
 }
 
+/**
+ * @inheritDoc
+ */
+void Interpreter::initHostCalls(Interpreter::HostCall const* pcHostCalls) {
+    Interpreter::pcHostCalls = pcHostCalls;
+}
+
+/**
+ * @inheritDoc
+ */
+void Interpreter::initMemoryHooks(Interpreter::MemoryHooks const* poMemoryHooks) {
+    Interpreter::poMemoryHooks = poMemoryHooks ? poMemoryHooks : &oDefaultMemoryHooks;
+}
+
 /**
  * @inheritDoc
  */
@@ -87,7 +141,7 @@ void Interpreter::initImportSymbols(Loader::Symbol* poImportSymbols, uint32 cons
 void Interpreter::allocateStack(uint32 uSize) {
     uSize += (Limits::STACK_ALIGN - 1);
     uSize &= ~(Limits::STACK_ALIGN - 1);
-    puStackBase = (uint8*)std::calloc(uSize, 1);
+    puStackBase = (uint8*)poMemoryHooks->cAllocateStack(uSize);
     if (!puStackBase) {
         throw Error("Failed to allocate stack");
     }
@@ -105,7 +159,9 @@ void Interpreter::allocateStack(uint32 uSize) {
  * @inheritDoc
  */
 void Interpreter::freeStack() {
-    std::free(puStackBase);
+    if (puStackBase) {
+        poMemoryHooks->cReleaseStack(puStackBase);
+    }
     puStackTop = puStackBase = 0;
 }
 
@@ -116,6 +172,44 @@ void Interpreter::setProgramCounter(Interpreter::VMCodeEntryPoint pByteCode) {
     puProgramCounter = pByteCode;
 }
 
+/**
+ * @inheritDoc
+ */
+bool Interpreter::isReferenced(void const* pStart, uint64 const uSize) {
+    uint8 const* puStart = (uint8 const*)pStart;
+    auto cPointsInto = [=](void const* pAddress) {
+        return (uint64)((uint8 const*)pAddress - puStart) < uSize;
+    };
+
+    if (cPointsInto(puProgramCounter)) {
+        return true;
+    }
+    for (HostFrame const* poFrame = poHostFrame; poFrame; poFrame = poFrame->poPrevious) {
+        if (cPointsInto(poFrame->puReturn)) {
+            return true;
+        }
+    }
+    for (unsigned u = 0; u < GPRegister::MAX; ++u) {
+        if (cPointsInto(aoGPR[u].pAny)) {
+            return true;
+        }
+    }
+
+    // Values need not be aligned on the stack, so every position is considered.
+    uint8 const* puStack = aoGPR[GPRegister::SP].puByte;
+    if (puStack < puStackBase || puStack > puStackTop) {
+        return true;
+    }
+    for (; puStack + sizeof(void*) <= puStackTop; ++puStack) {
+        void const* pValue;
+        std::memcpy(&pValue, puStack, sizeof(void*));
+        if (cPointsInto(pValue)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 /**
  * @inheritDoc
  */
@@ -221,6 +315,21 @@ void Interpreter::dumpState(std::FILE* poStream, unsigned const uFlags) {
         }
         std::fprintf(poStream, "\n");
     }
+    if (uFlags & STATE_VR) {
+        std::fprintf(poStream, "Vector Registers (%p)\n", aoVR);
+        for (unsigned u = 0; u < VRegister::MAX; ++u) {
+            std::fprintf(
+                poStream,
+                "\t%2u : 0x%016lX %016lX %016lX %016lX\n",
+                u,
+                aoVR[u].auQuad[3],
+                aoVR[u].auQuad[2],
+                aoVR[u].auQuad[1],
+                aoVR[u].auQuad[0]
+            );
+        }
+        std::fprintf(poStream, "\n");
+    }
     if (uFlags & STATE_STACK) {
         std::fprintf(poStream, "Stack\n");
         if (puStackTop && puStackBase) {
@@ -245,15 +354,14 @@ void Interpreter::handleHost() {
     // Get the function ID and call it. The function is expected to return a valid
     // status code we can set.
     uint8 uNext = *puProgramCounter++;
-    if (uNext < uNumHCFVectors) {
-        uint8 const* volatile pNext = puProgramCounter + 1;
-        eStatus = pcHCFVectors[uNext](*puProgramCounter++);
-        if (eStatus == INITIALISED) {
-            puProgramCounter = pNext;
-            eStatus = RUNNING;
-        }
-    } else {
-        eStatus = UNKNOWN_HOST_CALL;
+    uint8 const* volatile pNext = puProgramCounter + 1;
+    HostFrame oFrame = { pNext, poHostFrame };
+    poHostFrame = &oFrame;
+    eStatus = callHost(uNext, *puProgramCounter++);
+    poHostFrame = oFrame.poPrevious;
+    if (eStatus == INITIALISED) {
+        puProgramCounter = pNext;
+        eStatus = RUNNING;
     }
 }
 
@@ -267,8 +375,38 @@ void Interpreter::handleHost() {
 #include "interpreter_bdc.cpp"
 #include "interpreter_smc.cpp"
 #include "interpreter_sdc.cpp"
+#include "interpreter_vec.cpp"
+#include "interpreter_bit.cpp"
+#include "interpreter_sel.cpp"
+#include "interpreter_blk.cpp"
+
+/**
+ * The tail call backend needs guaranteed tail calls, otherwise every instruction could grow the native stack. Where
+ * the compiler can't promise them the jump table backend is built instead, unless MUSTTAIL is already defined, e.g.
+ * as empty to rely on sibling call optimisation.
+ */
+#if defined(INTERPRETER_TAILCALL) && !defined(MUSTTAIL)
+    #if defined(__has_cpp_attribute)
+        #if __has_cpp_attribute(clang::musttail)
+            #define MUSTTAIL [[clang::musttail]]
+        #endif
+    #endif
+    #if !defined(MUSTTAIL) && defined(__has_attribute)
+        #if __has_attribute(musttail)
+            #define MUSTTAIL __attribute__((musttail))
+        #endif
+    #endif
+    #ifndef MUSTTAIL
+        #pragma message("No guaranteed tail calls, using the jump table interpreter instead")
+        #undef  INTERPRETER_TAILCALL
+        #define INTERPRETER_JUMPTBL
+        #define THREADED_DISPATCH
+    #endif
+#endif
 
-#ifdef INTERPRETER_JUMPTBL
+#if defined(INTERPRETER_TAILCALL)
+    #include "interpreter_run_tailcall.cpp"
+#elif defined(INTERPRETER_JUMPTBL)
     #include "interpreter_run_jumptable.cpp"
 #else
     #include "interpreter_run_switch.cpp"
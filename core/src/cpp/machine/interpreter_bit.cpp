@@ -0,0 +1,168 @@
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+#include <machine/interpreter.hpp>
+#include <bytecode/opcode.hpp>
+#include <machine/inline.hpp>
+#include <machine/gnarly.hpp>
+
+#if defined(__LZCNT__) || defined(__BMI__) || defined(__BMI2__)
+    #include <immintrin.h>
+#endif
+
+namespace MC64K::Machine {
+
+namespace {
+
+/**
+ * Leading zeros of a quad, 64 for zero
+ */
+inline uint64 leadingZeros(uint64 uValue) {
+#if defined(__LZCNT__)
+    return _lzcnt_u64(uValue);
+#else
+    return uValue ? (uint64)__builtin_clzll(uValue) : 64;
+#endif
+}
+
+/**
+ * Trailing zeros of a quad, 64 for zero
+ */
+inline uint64 trailingZeros(uint64 uValue) {
+#if defined(__BMI__)
+    return _tzcnt_u64(uValue);
+#else
+    return uValue ? (uint64)__builtin_ctzll(uValue) : 64;
+#endif
+}
+
+/**
+ * Sized counts. Narrower operands are zero extended, the trailing count has a stop bit just above the operand so
+ * that zero gives the operand size.
+ */
+template<typename T>
+inline T clz(T tValue) {
+    return (T)(leadingZeros((uint64)tValue) - (64 - 8 * sizeof(T)));
+}
+
+template<typename T>
+inline T ctz(T tValue) {
+    if constexpr (sizeof(T) < sizeof(uint64)) {
+        return (T)trailingZeros((uint64)tValue | (1ULL << (8 * sizeof(T))));
+    } else {
+        return (T)trailingZeros(tValue);
+    }
+}
+
+template<typename T>
+inline T popcnt(T tValue) {
+    return (T)__builtin_popcountll((uint64)tValue);
+}
+
+/**
+ * Mask of the lowest uWidth bits, for uWidth 1-64
+ */
+inline uint64 lowBits(uint64 uValue, uint32 uWidth) {
+#if defined(__BMI2__)
+    return _bzhi_u64(uValue, uWidth);
+#else
+    return uValue & (~0ULL >> (64 - uWidth));
+#endif
+}
+
+/**
+ * A bit field offset or width byte is either an immediate in range or a register
+ */
+inline bool isFieldByte(uint32 uByte, uint32 uMin, uint32 uMax) {
+    using namespace MC64K::ByteCode;
+    if (uByte & Opcode::BF_REGISTER) {
+        return !(uByte & ~(uint32)(Opcode::BF_REGISTER | Opcode::BF_REGISTER_MASK));
+    }
+    return uByte >= uMin && uByte <= uMax;
+}
+
+} // namespace
+
+/**
+ * Deal with bit manipulation operations
+ */
+void NOINLINE Interpreter::handleBIT() {
+    using namespace MC64K::ByteCode;
+
+    uint8 uOperation = *puProgramCounter++;
+
+    switch (uOperation) {
+        case Opcode::CLZ_B:    dyadic(SIZE_BYTE); asUByte(pDstEA) = clz(asUByte(pSrcEA));    return;
+        case Opcode::CLZ_W:    dyadic(SIZE_WORD); asUWord(pDstEA) = clz(asUWord(pSrcEA));    return;
+        case Opcode::CLZ_L:    dyadic(SIZE_LONG); asULong(pDstEA) = clz(asULong(pSrcEA));    return;
+        case Opcode::CLZ_Q:    dyadic(SIZE_QUAD); asUQuad(pDstEA) = clz(asUQuad(pSrcEA));    return;
+        case Opcode::CTZ_B:    dyadic(SIZE_BYTE); asUByte(pDstEA) = ctz(asUByte(pSrcEA));    return;
+        case Opcode::CTZ_W:    dyadic(SIZE_WORD); asUWord(pDstEA) = ctz(asUWord(pSrcEA));    return;
+        case Opcode::CTZ_L:    dyadic(SIZE_LONG); asULong(pDstEA) = ctz(asULong(pSrcEA));    return;
+        case Opcode::CTZ_Q:    dyadic(SIZE_QUAD); asUQuad(pDstEA) = ctz(asUQuad(pSrcEA));    return;
+        case Opcode::POPCNT_B: dyadic(SIZE_BYTE); asUByte(pDstEA) = popcnt(asUByte(pSrcEA)); return;
+        case Opcode::POPCNT_W: dyadic(SIZE_WORD); asUWord(pDstEA) = popcnt(asUWord(pSrcEA)); return;
+        case Opcode::POPCNT_L: dyadic(SIZE_LONG); asULong(pDstEA) = popcnt(asULong(pSrcEA)); return;
+        case Opcode::POPCNT_Q: dyadic(SIZE_QUAD); asUQuad(pDstEA) = popcnt(asUQuad(pSrcEA)); return;
+        default:
+            break;
+    }
+
+    if (uOperation >= Opcode::BMAX_OPERATION) {
+        eStatus = UNIMPLEMENTED_OPCODE;
+        return;
+    }
+
+    // Bit field operations. Verified code has already had the field bytes checked.
+    uint32 uOffset = *puProgramCounter++;
+    uint32 uWidth  = *puProgramCounter++;
+    bool   bRegister = (uOffset | uWidth) & Opcode::BF_REGISTER;
+    if (
+        !isFieldByte(uOffset, 0, 63) ||
+        !isFieldByte(uWidth, 1, 64)  ||
+        (!bRegister && uOffset + uWidth > 64)
+    ) {
+        eStatus = UNIMPLEMENTED_OPCODE;
+        return;
+    }
+    if (uOffset & Opcode::BF_REGISTER) {
+        uOffset = aoGPR[uOffset & Opcode::BF_REGISTER_MASK].uLong & 63;
+    }
+    if (uWidth & Opcode::BF_REGISTER) {
+        uWidth = ((aoGPR[uWidth & Opcode::BF_REGISTER_MASK].uLong - 1) & 63) + 1;
+    }
+    if (uOffset + uWidth > 64) {
+        uWidth = 64 - uOffset;
+    }
+
+    dyadic(SIZE_QUAD);
+    switch (uOperation) {
+        case Opcode::BFEXTU:
+            asUQuad(pDstEA) = lowBits(asUQuad(pSrcEA) >> uOffset, uWidth);
+            return;
+
+        case Opcode::BFEXTS:
+            asQuad(pDstEA) = (int64)(asUQuad(pSrcEA) << (64 - uOffset - uWidth)) >> (64 - uWidth);
+            return;
+
+        case Opcode::BFINS: {
+            uint64 uField = lowBits(~0ULL, uWidth) << uOffset;
+            asUQuad(pDstEA) = (asUQuad(pDstEA) & ~uField) | ((asUQuad(pSrcEA) << uOffset) & uField);
+            return;
+        }
+
+        default:
+            break;
+    }
+}
+
+}
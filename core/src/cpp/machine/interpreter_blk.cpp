@@ -0,0 +1,117 @@
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+#include <cstring>
+#include <machine/interpreter.hpp>
+#include <bytecode/opcode.hpp>
+#include <machine/inline.hpp>
+#include <machine/gnarly.hpp>
+
+namespace MC64K::Machine {
+
+namespace {
+
+/**
+ * Fill using the host supplied kernel for the element size, which is only given aligned blocks. A misaligned block
+ * is filled element by element instead.
+ */
+template<typename T>
+inline void blockFill(Interpreter::MemoryHooks const* poHooks, void* pBuffer, T tValue, uint64 uCount) {
+    if (!uCount) {
+        return;
+    }
+    if ((uint64)pBuffer & (sizeof(T) - 1)) {
+        uint8* puBuffer = (uint8*)pBuffer;
+        while (uCount--) {
+            std::memcpy(puBuffer, &tValue, sizeof(T));
+            puBuffer += sizeof(T);
+        }
+        return;
+    }
+    if constexpr (sizeof(T) == 1) {
+        poHooks->cFillByte(pBuffer, tValue, uCount);
+    } else if constexpr (sizeof(T) == 2) {
+        poHooks->cFillWord(pBuffer, tValue, uCount);
+    } else if constexpr (sizeof(T) == 4) {
+        poHooks->cFillLong(pBuffer, tValue, uCount);
+    } else {
+        poHooks->cFillQuad(pBuffer, tValue, uCount);
+    }
+}
+
+} // namespace
+
+/**
+ * Deal with block memory operations. The length register is read before the effective addresses are decoded, so
+ * that an addressing mode that modifies the same register doesn't change it.
+ */
+void NOINLINE Interpreter::handleBLK() {
+    using namespace MC64K::ByteCode;
+
+    uint8       uOperation = *puProgramCounter++;
+    GPRegister& roLength   = aoGPR[*puProgramCounter++ & 0x0F];
+    uint64      uLength    = roLength.uQuad;
+
+    // The destination and, other than for a fill value, the source must refer to memory. If either fails to decode,
+    // the operation is skipped.
+    switch (uOperation) {
+        case Opcode::BMOVE:
+            eOperationSize = SIZE_BYTE;
+            if ((pDstEA = decodeBlockEffectiveAddress()) && (pSrcEA = decodeBlockEffectiveAddress())) {
+                std::memmove(pDstEA, pSrcEA, uLength);
+            }
+            return;
+
+        case Opcode::BFILL_B:
+            eOperationSize = SIZE_BYTE;
+            if ((pDstEA = decodeBlockEffectiveAddress()) && (pSrcEA = decodeEffectiveAddress())) {
+                blockFill(poMemoryHooks, pDstEA, asUByte(pSrcEA), uLength);
+            }
+            return;
+
+        case Opcode::BFILL_W:
+            eOperationSize = SIZE_WORD;
+            if ((pDstEA = decodeBlockEffectiveAddress()) && (pSrcEA = decodeEffectiveAddress())) {
+                blockFill(poMemoryHooks, pDstEA, asUWord(pSrcEA), uLength);
+            }
+            return;
+
+        case Opcode::BFILL_L:
+            eOperationSize = SIZE_LONG;
+            if ((pDstEA = decodeBlockEffectiveAddress()) && (pSrcEA = decodeEffectiveAddress())) {
+                blockFill(poMemoryHooks, pDstEA, asULong(pSrcEA), uLength);
+            }
+            return;
+
+        case Opcode::BFILL_Q:
+            eOperationSize = SIZE_QUAD;
+            if ((pDstEA = decodeBlockEffectiveAddress()) && (pSrcEA = decodeEffectiveAddress())) {
+                blockFill(poMemoryHooks, pDstEA, asUQuad(pSrcEA), uLength);
+            }
+            return;
+
+        case Opcode::BCMP: {
+            eOperationSize = SIZE_BYTE;
+            if ((pDstEA = decodeBlockEffectiveAddress()) && (pSrcEA = decodeBlockEffectiveAddress())) {
+                int iResult = std::memcmp(pSrcEA, pDstEA, uLength);
+                roLength.iQuad = (iResult > 0) - (iResult < 0);
+            }
+            return;
+        }
+
+        default:
+            eStatus = UNIMPLEMENTED_OPCODE;
+            break;
+    }
+}
+
+}
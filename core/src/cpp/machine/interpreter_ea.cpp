@@ -216,7 +216,16 @@ void* Interpreter::decodeEffectiveAddress() {
 
                 case EffectiveAddress::IMPORT_SYMBOL_ID:
                     readSymbolIndex();
-                    return (uint8*)poImportSymbols[uIndex].pRawData;
+                    if (uIndex < uNumImportSymbols) {
+                        return poImportSymbols[uIndex].pRawData;
+                    }
+
+                    // A bad index can only be reached in unverified code. The machine halts once the current
+                    // operation completes so give it something harmless to work on in the meantime.
+                    std::fprintf(stderr, "Imported symbol index %u out of range\n", uIndex);
+                    eStatus = UNRESOLVED_SYMBOL;
+                    oImmediate.iQuad = 0;
+                    return oImmediate.auBytes;
 
                 default:
                     break;
@@ -231,6 +240,31 @@ void* Interpreter::decodeEffectiveAddress() {
     return 0;
 }
 
+/**
+ * @inheritDoc
+ */
+void* Interpreter::decodeBlockEffectiveAddress() {
+    using namespace MC64K::ByteCode;
+    switch (*puProgramCounter & 0xF0) {
+        case EffectiveAddress::OFS_GPR_DIR:
+        case EffectiveAddress::OFS_FPR_DIR:
+            break;
+        case EffectiveAddress::OFS_OTHER:
+            if (EffectiveAddress::Other::PC_IND_DSP == (*puProgramCounter & 0x0F)) {
+                return decodeEffectiveAddress();
+            }
+            break;
+        default: {
+            // The fallback operand for a bad import is too small for a block, so it's treated as a failure here
+            void* pAddress = decodeEffectiveAddress();
+            return RUNNING == eStatus ? pAddress : 0;
+        }
+    }
+    std::fprintf(stderr, "Effective address mode 0x%02X does not refer to memory\n", (unsigned)*puProgramCounter);
+    eStatus = ILLEGAL_EAMODE;
+    return 0;
+}
+
 /**
  * Save the registers indicated by the mask to the effective address
  *
@@ -17,6 +17,7 @@
 #include <bytecode/opcode.hpp>
 #include <machine/inline.hpp>
 #include <machine/gnarly.hpp>
+#include <machine/transcendental.hpp>
 
 namespace MC64K::Machine {
 
@@ -29,6 +30,10 @@ extern void* pDstEA;
 
 #define status()   goto begin_interpreter
 #define end()      goto end_interpreter
+
+// This build does not use the verifier, everything is dispatched with the status check.
+#define check()    goto begin_interpreter
+#define jump()     goto begin_interpreter
 #define dispatch() goto *((uint8*)&&begin_interpreter + uJumpTable[*puProgramCounter++])
 
 #ifdef THREADED_DISPATCH
@@ -185,11 +190,11 @@ void Interpreter::run() {
         JTE(FLOGN_S),   JTE(FLOGN_D),
         JTE(FLOG2_S),   JTE(FLOG2_D),
         JTE(FTWOTOX_S), JTE(FTWOTOX_D),
-        JTE(BAD), // 229
-        JTE(BAD), // 230
-        JTE(BAD), // 231
-        JTE(BAD), // 232
-        JTE(BAD), // 233
+        JTE(VEC), // 229
+        JTE(BIT), // 230
+        JTE(CSEL), // 231
+        JTE(MINMAX), // 232
+        JTE(BLK), // 233
         JTE(BAD), // 234
         JTE(BAD), // 235
         JTE(BAD), // 236
@@ -238,11 +243,7 @@ void Interpreter::run() {
 
         dispatch();
 
-        #include <machine/opcode_handlers/control.hpp>
-        #include <machine/opcode_handlers/fast_path.hpp>
-        #include <machine/opcode_handlers/data_move.hpp>
-        #include <machine/opcode_handlers/logical.hpp>
-        #include <machine/opcode_handlers/arithmetic.hpp>
+        #include <machine/opcode_handlers/all.hpp>
 
         // Super undocumented timing opcode ftw
         defOp(0xF0) {
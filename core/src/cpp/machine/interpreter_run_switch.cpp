@@ -13,10 +13,12 @@
 #include <cstdio>
 #include <cmath>
 #include <machine/interpreter.hpp>
+#include <machine/verifier.hpp>
 #include <machine/timing.hpp>
 #include <bytecode/opcode.hpp>
 #include <machine/inline.hpp>
 #include <machine/gnarly.hpp>
+#include <machine/transcendental.hpp>
 
 namespace MC64K::Machine {
 
@@ -37,8 +39,44 @@ void Interpreter::run() {
     eStatus = RUNNING;
     while (RUNNING == eStatus) {
 
-        // Fast branch back location for operations that don't change the status. If you invoke monadic() or dyadic()
-        // you have to assume the status could change due to a bad EA mode.
+        // Verified code can only change the status through a host call, stop, the final rts or a sub-operation
+        // refused at run time, so it runs in a copy of the handlers that skips the check everywhere else.
+        // Computed transfers of control stay in this loop only if the destination is also verified. The other
+        // backends have no verified variant: their status() is a single compare that dispatches directly.
+        if (poVerifier && poVerifier->isVerified(puProgramCounter)) {
+
+            verified_dispatch:
+
+            updateMIPS();
+            switch (*puProgramCounter++) {
+
+                #define end()       break
+                #define status()    goto verified_dispatch
+                #define next()      goto verified_dispatch
+                #define check()     break
+                #define jump()      if (poVerifier->isVerified(puProgramCounter)) { goto verified_dispatch; } break
+                #define defOp(NAME) case Opcode::NAME:
+
+                #include <machine/opcode_handlers/all.hpp>
+
+                #undef end
+                #undef status
+                #undef next
+                #undef check
+                #undef jump
+
+                case 0xF0: {
+                    aoGPR[14].uQuad = Nanoseconds::mark();
+                    goto verified_dispatch;
+                }
+                default:
+                    todo();
+            }
+            continue;
+        }
+
+        // Fast branch back location for operations that don't change the status. If you invoke monadic() or
+        // dyadic() you have to assume the status could change due to a bad EA mode.
         skip_status_check:
 
         updateMIPS();
@@ -48,13 +86,11 @@ void Interpreter::run() {
             #define end()       break
             #define status()    break
             #define next()      goto skip_status_check
+            #define check()     break
+            #define jump()      break
             #define defOp(NAME) case Opcode::NAME:
 
-            #include <machine/opcode_handlers/control.hpp>
-            #include <machine/opcode_handlers/fast_path.hpp>
-            #include <machine/opcode_handlers/data_move.hpp>
-            #include <machine/opcode_handlers/logical.hpp>
-            #include <machine/opcode_handlers/arithmetic.hpp>
+            #include <machine/opcode_handlers/all.hpp>
 
             // Super undocumented timing opcode ftw
             case 0xF0: {
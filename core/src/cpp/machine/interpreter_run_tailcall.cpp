@@ -0,0 +1,183 @@
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+#include <cstdio>
+#include <cmath>
+#include <array>
+#include <utility>
+#include <machine/interpreter.hpp>
+#include <machine/timing.hpp>
+#include <bytecode/opcode.hpp>
+#include <machine/inline.hpp>
+#include <machine/gnarly.hpp>
+#include <machine/transcendental.hpp>
+
+/**
+ * Tail call dispatch.
+ *
+ * Every handler is a separate function that ends by calling the handler for the next opcode. Since each call is
+ * in tail position it compiles to a jump and the stack does not grow, but unlike the switch and jump table loops
+ * every handler gets its own register allocation. The program counter, register file and call depth are passed as
+ * the arguments, so they stay in registers from one handler to the next whether or not the build reserves a global
+ * register for the program counter. The out of line helpers still work on the machine state, so the program counter
+ * is written back before calling one and reloaded afterwards.
+ *
+ * This is only built where the compiler guarantees the tail calls, see the backend selection in interpreter.cpp.
+ */
+namespace MC64K::Machine {
+
+#ifndef HAVE_PTR_DEPS
+extern uint8 const* puProgramCounter;
+extern void* pDstEA;
+#endif
+
+/**
+ * The handlers are separate functions, so there is no enclosing scope to put the displacement temporaries in.
+ */
+static union {
+    uint32 uMask;
+    uint32 uIndex;
+    int32  iDisplacement;
+    uint8  auBytes[sizeof(uint32)];
+};
+
+/**
+ * Handler set for the tail call dispatch
+ */
+struct Interpreter::TailCall {
+
+    typedef void (*Handler)(uint8 const* puProgramCounter, GPRegister* aoGPR, int32 iCallDepth);
+
+    /**
+     * The handler for opcode OP. Opcodes without a specialisation are unimplemented.
+     *
+     * @param uint8 const* puProgramCounter
+     * @param GPRegister*  aoGPR
+     * @param int32        iCallDepth
+     */
+    template<uint8 OP>
+    static void handler(uint8 const* puProgramCounter, GPRegister* aoGPR, int32 iCallDepth);
+
+    /**
+     * Decode an effective address, keeping the program counter argument and the machine state in step.
+     *
+     * @param  uint8 const*& rpuProgramCounter
+     * @return void*
+     */
+    static inline void* decode(uint8 const*& rpuProgramCounter) {
+        MC64K::Machine::puProgramCounter = rpuProgramCounter;
+        void* pEA = decodeEffectiveAddress();
+        rpuProgramCounter = MC64K::Machine::puProgramCounter;
+        return pEA;
+    }
+
+    /**
+     * Builds the table of handlers, indexed by opcode.
+     */
+    template<std::size_t... OP>
+    static constexpr std::array<Handler, 256> makeHandlers(std::index_sequence<OP...>) {
+        return {{ &handler<(uint8)OP>... }};
+    }
+
+    static std::array<Handler, 256> const acHandlers;
+
+#ifdef REPORT_MIPS
+    static uint64 uInstructionCount;
+#endif
+};
+
+#ifdef REPORT_MIPS
+    uint64 Interpreter::TailCall::uInstructionCount = 0;
+
+    #undef updateMIPS
+    #define updateMIPS() ++TailCall::uInstructionCount;
+#endif
+
+template<uint8 OP>
+void Interpreter::TailCall::handler(uint8 const* puProgramCounter, GPRegister* aoGPR, int32 iCallDepth) {
+    (void)aoGPR;
+    (void)iCallDepth;
+    MC64K::Machine::puProgramCounter = puProgramCounter;
+    eStatus = UNIMPLEMENTED_OPCODE;
+}
+
+#define savePC()    (MC64K::Machine::puProgramCounter = puProgramCounter)
+#define loadPC()    (puProgramCounter = MC64K::Machine::puProgramCounter)
+#define outOfLine(CALL) (savePC(), CALL, loadPC())
+
+#define decodeEffectiveAddress()      TailCall::decode(puProgramCounter)
+#define saveRegisters(MASK, MODE)     outOfLine(Interpreter::saveRegisters(MASK, MODE))
+#define restoreRegisters(MASK, MODE)  outOfLine(Interpreter::restoreRegisters(MASK, MODE))
+#define handleHost()                  outOfLine(Interpreter::handleHost())
+#define handleBMC()                   outOfLine(Interpreter::handleBMC())
+#define handleBDC()                   outOfLine(Interpreter::handleBDC())
+#define handleRBMC()                  outOfLine(Interpreter::handleRBMC())
+#define handleR2RBDC()                outOfLine(Interpreter::handleR2RBDC())
+#define handleSMC()                   outOfLine(Interpreter::handleSMC())
+#define handleSDC()                   outOfLine(Interpreter::handleSDC())
+#define handleVEC()                   outOfLine(Interpreter::handleVEC())
+#define handleBIT()                   outOfLine(Interpreter::handleBIT())
+#define handleCSEL()                  outOfLine(Interpreter::handleCSEL())
+#define handleMINMAX()                outOfLine(Interpreter::handleMINMAX())
+#define handleBLK()                   outOfLine(Interpreter::handleBLK())
+
+#define dispatch() updateMIPS(); MUSTTAIL return acHandlers[*puProgramCounter](puProgramCounter + 1, aoGPR, iCallDepth)
+
+#define end()       { savePC(); return; }
+#define status()    { if (RUNNING != eStatus) { savePC(); return; } dispatch(); }
+#define next()      { dispatch(); }
+#define check()     status()
+#define jump()      status()
+#define defOp(NAME) template<> void Interpreter::TailCall::handler<ByteCode::Opcode::NAME>( \
+    uint8 const* puProgramCounter, \
+    GPRegister*  aoGPR, \
+    int32        iCallDepth \
+)
+
+#include <machine/opcode_handlers/all.hpp>
+
+/**
+ * Super undocumented timing opcode ftw
+ */
+template<>
+void Interpreter::TailCall::handler<0xF0>(uint8 const* puProgramCounter, GPRegister* aoGPR, int32 iCallDepth) {
+    aoGPR[14].uQuad = Nanoseconds::mark();
+    next();
+}
+
+std::array<Interpreter::TailCall::Handler, 256> const Interpreter::TailCall::acHandlers =
+    Interpreter::TailCall::makeHandlers(std::make_index_sequence<256>());
+
+/**
+ * @inheritDoc
+ */
+void Interpreter::run() {
+
+    if (!puProgramCounter) {
+        return;
+    }
+
+    initMIPSReport();
+    eStatus = RUNNING;
+
+    // Returns when a handler stops the machine
+    TailCall::acHandlers[*puProgramCounter](puProgramCounter + 1, aoGPR, 1);
+
+#ifdef REPORT_MIPS
+    uInstructionCount = TailCall::uInstructionCount + 1;
+    TailCall::uInstructionCount = 0;
+#endif
+
+    outputMIPSReport();
+}
+
+}
@@ -0,0 +1,199 @@
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+#include <machine/interpreter.hpp>
+#include <bytecode/opcode.hpp>
+#include <machine/inline.hpp>
+#include <machine/gnarly.hpp>
+
+namespace MC64K::Machine {
+
+/**
+ * Decode the next operand and read it as type T. Immediates share a single temporary, so every operand is read
+ * before the next one is decoded. The destination is decoded first and stays in pDstEA, so an operand that is the
+ * same as the destination reads its current value.
+ */
+#define operand(T) (*(T const*)decodeEffectiveAddress())
+
+/**
+ * Select between two values on a comparison of two others. All four operands are always evaluated. The choice is
+ * made on the values rather than by branching, so compiles to a conditional move or blend.
+ */
+#define csel(size, T, c) { \
+    eOperationSize = (size); \
+    pDstEA = decodeEffectiveAddress(); \
+    T tA = operand(T); \
+    T tB = operand(T); \
+    T tX = operand(T); \
+    T tY = operand(T); \
+    *(T*)pDstEA = (c) ? tX : tY; \
+    return; \
+}
+
+#define bitPos(t, m) ((t) & (1ULL << ((uint8)tA & (m))))
+
+void NOINLINE Interpreter::handleCSEL() {
+    using namespace MC64K::ByteCode;
+
+    // next byte is the condition we will test
+    uint8 uCond = *puProgramCounter++;
+
+    switch (uCond) {
+        case Opcode::IEQ_B: csel(SIZE_BYTE, int8,    tA == tB);
+        case Opcode::IEQ_W: csel(SIZE_WORD, int16,   tA == tB);
+        case Opcode::IEQ_L: csel(SIZE_LONG, int32,   tA == tB);
+        case Opcode::IEQ_Q: csel(SIZE_QUAD, int64,   tA == tB);
+        case Opcode::FEQ_S: csel(SIZE_LONG, float32, tA == tB);
+        case Opcode::FEQ_D: csel(SIZE_QUAD, float64, tA == tB);
+
+        case Opcode::INE_B: csel(SIZE_BYTE, int8,    tA != tB);
+        case Opcode::INE_W: csel(SIZE_WORD, int16,   tA != tB);
+        case Opcode::INE_L: csel(SIZE_LONG, int32,   tA != tB);
+        case Opcode::INE_Q: csel(SIZE_QUAD, int64,   tA != tB);
+        case Opcode::FNE_S: csel(SIZE_LONG, float32, tA != tB);
+        case Opcode::FNE_D: csel(SIZE_QUAD, float64, tA != tB);
+
+        case Opcode::ILT_B: csel(SIZE_BYTE, int8,    tA < tB);
+        case Opcode::ILT_W: csel(SIZE_WORD, int16,   tA < tB);
+        case Opcode::ILT_L: csel(SIZE_LONG, int32,   tA < tB);
+        case Opcode::ILT_Q: csel(SIZE_QUAD, int64,   tA < tB);
+        case Opcode::ULT_B: csel(SIZE_BYTE, uint8,   tA < tB);
+        case Opcode::ULT_W: csel(SIZE_WORD, uint16,  tA < tB);
+        case Opcode::ULT_L: csel(SIZE_LONG, uint32,  tA < tB);
+        case Opcode::ULT_Q: csel(SIZE_QUAD, uint64,  tA < tB);
+        case Opcode::FLT_S: csel(SIZE_LONG, float32, tA < tB);
+        case Opcode::FLT_D: csel(SIZE_QUAD, float64, tA < tB);
+
+        case Opcode::ILE_B: csel(SIZE_BYTE, int8,    tA <= tB);
+        case Opcode::ILE_W: csel(SIZE_WORD, int16,   tA <= tB);
+        case Opcode::ILE_L: csel(SIZE_LONG, int32,   tA <= tB);
+        case Opcode::ILE_Q: csel(SIZE_QUAD, int64,   tA <= tB);
+        case Opcode::ULE_B: csel(SIZE_BYTE, uint8,   tA <= tB);
+        case Opcode::ULE_W: csel(SIZE_WORD, uint16,  tA <= tB);
+        case Opcode::ULE_L: csel(SIZE_LONG, uint32,  tA <= tB);
+        case Opcode::ULE_Q: csel(SIZE_QUAD, uint64,  tA <= tB);
+        case Opcode::FLE_S: csel(SIZE_LONG, float32, tA <= tB);
+        case Opcode::FLE_D: csel(SIZE_QUAD, float64, tA <= tB);
+
+        case Opcode::IGE_B: csel(SIZE_BYTE, int8,    tA >= tB);
+        case Opcode::IGE_W: csel(SIZE_WORD, int16,   tA >= tB);
+        case Opcode::IGE_L: csel(SIZE_LONG, int32,   tA >= tB);
+        case Opcode::IGE_Q: csel(SIZE_QUAD, int64,   tA >= tB);
+        case Opcode::UGE_B: csel(SIZE_BYTE, uint8,   tA >= tB);
+        case Opcode::UGE_W: csel(SIZE_WORD, uint16,  tA >= tB);
+        case Opcode::UGE_L: csel(SIZE_LONG, uint32,  tA >= tB);
+        case Opcode::UGE_Q: csel(SIZE_QUAD, uint64,  tA >= tB);
+        case Opcode::FGE_S: csel(SIZE_LONG, float32, tA >= tB);
+        case Opcode::FGE_D: csel(SIZE_QUAD, float64, tA >= tB);
+
+        case Opcode::IGT_B: csel(SIZE_BYTE, int8,    tA > tB);
+        case Opcode::IGT_W: csel(SIZE_WORD, int16,   tA > tB);
+        case Opcode::IGT_L: csel(SIZE_LONG, int32,   tA > tB);
+        case Opcode::IGT_Q: csel(SIZE_QUAD, int64,   tA > tB);
+        case Opcode::UGT_B: csel(SIZE_BYTE, uint8,   tA > tB);
+        case Opcode::UGT_W: csel(SIZE_WORD, uint16,  tA > tB);
+        case Opcode::UGT_L: csel(SIZE_LONG, uint32,  tA > tB);
+        case Opcode::UGT_Q: csel(SIZE_QUAD, uint64,  tA > tB);
+        case Opcode::FGT_S: csel(SIZE_LONG, float32, tA > tB);
+        case Opcode::FGT_D: csel(SIZE_QUAD, float64, tA > tB);
+
+        // Bit number tA of tB
+        case Opcode::BPS_B: csel(SIZE_BYTE, uint8,   bitPos(tB, 7));
+        case Opcode::BPS_W: csel(SIZE_WORD, uint16,  bitPos(tB, 15));
+        case Opcode::BPS_L: csel(SIZE_LONG, uint32,  bitPos(tB, 31));
+        case Opcode::BPS_Q: csel(SIZE_QUAD, uint64,  bitPos(tB, 63));
+        case Opcode::BPC_B: csel(SIZE_BYTE, uint8,   !bitPos(tB, 7));
+        case Opcode::BPC_W: csel(SIZE_WORD, uint16,  !bitPos(tB, 15));
+        case Opcode::BPC_L: csel(SIZE_LONG, uint32,  !bitPos(tB, 31));
+        case Opcode::BPC_Q: csel(SIZE_QUAD, uint64,  !bitPos(tB, 63));
+
+        default:
+            eStatus = UNIMPLEMENTED_OPCODE;
+            break;
+    }
+}
+
+#undef bitPos
+#undef csel
+
+/**
+ * Minimum and maximum. The comparisons are arranged so that float operations compile to the host minss/maxss
+ * family and integer ones to conditional moves.
+ */
+#define minmax(size, T, c) { \
+    eOperationSize = (size); \
+    pDstEA = decodeEffectiveAddress(); \
+    T tS = operand(T); \
+    T tD = *(T const*)pDstEA; \
+    *(T*)pDstEA = (c) ? tD : tS; \
+    return; \
+}
+
+#define clamp(size, T) { \
+    eOperationSize = (size); \
+    pDstEA = decodeEffectiveAddress(); \
+    T tLo = operand(T); \
+    T tHi = operand(T); \
+    T tD  = *(T const*)pDstEA; \
+    tD = (tD > tLo) ? tD : tLo; \
+    *(T*)pDstEA = (tD < tHi) ? tD : tHi; \
+    return; \
+}
+
+void NOINLINE Interpreter::handleMINMAX() {
+    using namespace MC64K::ByteCode;
+
+    uint8 uOperation = *puProgramCounter++;
+
+    switch (uOperation) {
+        case Opcode::MIN_B:    minmax(SIZE_BYTE, int8,    tD < tS);
+        case Opcode::MIN_W:    minmax(SIZE_WORD, int16,   tD < tS);
+        case Opcode::MIN_L:    minmax(SIZE_LONG, int32,   tD < tS);
+        case Opcode::MIN_Q:    minmax(SIZE_QUAD, int64,   tD < tS);
+        case Opcode::MAX_B:    minmax(SIZE_BYTE, int8,    tD > tS);
+        case Opcode::MAX_W:    minmax(SIZE_WORD, int16,   tD > tS);
+        case Opcode::MAX_L:    minmax(SIZE_LONG, int32,   tD > tS);
+        case Opcode::MAX_Q:    minmax(SIZE_QUAD, int64,   tD > tS);
+        case Opcode::MINU_B:   minmax(SIZE_BYTE, uint8,   tD < tS);
+        case Opcode::MINU_W:   minmax(SIZE_WORD, uint16,  tD < tS);
+        case Opcode::MINU_L:   minmax(SIZE_LONG, uint32,  tD < tS);
+        case Opcode::MINU_Q:   minmax(SIZE_QUAD, uint64,  tD < tS);
+        case Opcode::MAXU_B:   minmax(SIZE_BYTE, uint8,   tD > tS);
+        case Opcode::MAXU_W:   minmax(SIZE_WORD, uint16,  tD > tS);
+        case Opcode::MAXU_L:   minmax(SIZE_LONG, uint32,  tD > tS);
+        case Opcode::MAXU_Q:   minmax(SIZE_QUAD, uint64,  tD > tS);
+        case Opcode::FMIN_S:   minmax(SIZE_LONG, float32, tD < tS);
+        case Opcode::FMIN_D:   minmax(SIZE_QUAD, float64, tD < tS);
+        case Opcode::FMAX_S:   minmax(SIZE_LONG, float32, tD > tS);
+        case Opcode::FMAX_D:   minmax(SIZE_QUAD, float64, tD > tS);
+        case Opcode::CLAMP_B:  clamp(SIZE_BYTE, int8);
+        case Opcode::CLAMP_W:  clamp(SIZE_WORD, int16);
+        case Opcode::CLAMP_L:  clamp(SIZE_LONG, int32);
+        case Opcode::CLAMP_Q:  clamp(SIZE_QUAD, int64);
+        case Opcode::CLAMPU_B: clamp(SIZE_BYTE, uint8);
+        case Opcode::CLAMPU_W: clamp(SIZE_WORD, uint16);
+        case Opcode::CLAMPU_L: clamp(SIZE_LONG, uint32);
+        case Opcode::CLAMPU_Q: clamp(SIZE_QUAD, uint64);
+        case Opcode::FCLAMP_S: clamp(SIZE_LONG, float32);
+        case Opcode::FCLAMP_D: clamp(SIZE_QUAD, float64);
+
+        default:
+            eStatus = UNIMPLEMENTED_OPCODE;
+            break;
+    }
+}
+
+#undef clamp
+#undef minmax
+#undef operand
+
+}
@@ -0,0 +1,371 @@
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+#include <cstring>
+#include <limits>
+#include <machine/interpreter.hpp>
+#include <bytecode/opcode.hpp>
+#include <machine/inline.hpp>
+#include <machine/gnarly.hpp>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#endif
+
+namespace MC64K::Machine {
+
+namespace {
+
+/**
+ * Broadcast a scalar to every lane
+ */
+template<typename T>
+inline void splat(VRegister& roDst, void const* pSrc) {
+    T  tValue = *(T const*)pSrc;
+    T* ptDst  = (T*)roDst.auByte;
+    for (unsigned u = 0; u < VRegister::SIZE / sizeof(T); ++u) {
+        ptDst[u] = tValue;
+    }
+}
+
+#if defined(__AVX2__)
+
+inline __m256i getI(VRegister const& roReg) {
+    return _mm256_load_si256((__m256i const*)roReg.auByte);
+}
+
+inline void setI(VRegister& roReg, __m256i vValue) {
+    _mm256_store_si256((__m256i*)roReg.auByte, vValue);
+}
+
+inline __m256 getS(VRegister const& roReg) {
+    return _mm256_load_ps(roReg.afSingle);
+}
+
+inline void setS(VRegister& roReg, __m256 vValue) {
+    _mm256_store_ps(roReg.afSingle, vValue);
+}
+
+inline __m256d getD(VRegister const& roReg) {
+    return _mm256_load_pd(roReg.afDouble);
+}
+
+inline void setD(VRegister& roReg, __m256d vValue) {
+    _mm256_store_pd(roReg.afDouble, vValue);
+}
+
+#else
+
+/**
+ * Generic lane by lane operation: f(vd[n], vs[n]) -> vd[n]
+ */
+template<typename T, typename F>
+inline void lanes(T* ptDst, T const* ptSrc, F cFunction) {
+    for (unsigned u = 0; u < VRegister::SIZE / sizeof(T); ++u) {
+        ptDst[u] = cFunction(ptDst[u], ptSrc[u]);
+    }
+}
+
+/**
+ * Clamp a widened result to the range of the lane type
+ */
+template<typename T, typename W>
+inline T saturate(W wValue) {
+    return wValue < (W)std::numeric_limits<T>::min() ? std::numeric_limits<T>::min() : (
+        wValue > (W)std::numeric_limits<T>::max() ? std::numeric_limits<T>::max() : (T)wValue
+    );
+}
+
+#endif
+
+} // namespace
+
+/**
+ * Deal with packed vector operations
+ */
+void NOINLINE Interpreter::handleVEC() {
+    using namespace MC64K::ByteCode;
+
+    uint8 uOperation = *puProgramCounter++;
+    uint8 uRegPair   = *puProgramCounter++;
+
+    VRegister&       roDst = aoVR[uRegPair & 0x0F];
+    VRegister const& roSrc = aoVR[uRegPair >> 4];
+
+    // Memory and data movement operations don't depend on the available instruction set.
+    switch (uOperation) {
+        case Opcode::VLOAD:
+            eOperationSize = SIZE_VECTOR;
+            if ((pSrcEA = decodeBlockEffectiveAddress())) {
+                std::memcpy(roDst.auByte, pSrcEA, VRegister::SIZE);
+            }
+            return;
+        case Opcode::VSTORE:
+            eOperationSize = SIZE_VECTOR;
+            if ((pDstEA = decodeBlockEffectiveAddress())) {
+                std::memcpy(pDstEA, roDst.auByte, VRegister::SIZE);
+            }
+            return;
+        case Opcode::VMOVE:    roDst = roSrc; return;
+        case Opcode::VCLR:     std::memset(roDst.auByte, 0, VRegister::SIZE); return;
+        case Opcode::VSPLAT_B: monadic2(SIZE_BYTE); splat<uint8>(roDst, pSrcEA);  return;
+        case Opcode::VSPLAT_W: monadic2(SIZE_WORD); splat<uint16>(roDst, pSrcEA); return;
+        case Opcode::VSPLAT_L: monadic2(SIZE_LONG); splat<uint32>(roDst, pSrcEA); return;
+        case Opcode::VSPLAT_Q: monadic2(SIZE_QUAD); splat<uint64>(roDst, pSrcEA); return;
+        default:
+            break;
+    }
+
+#if defined(__AVX2__)
+
+    switch (uOperation) {
+        case Opcode::VAND:     setI(roDst, _mm256_and_si256(getI(roDst), getI(roSrc)));    return;
+        case Opcode::VOR:      setI(roDst, _mm256_or_si256(getI(roDst), getI(roSrc)));     return;
+        case Opcode::VEOR:     setI(roDst, _mm256_xor_si256(getI(roDst), getI(roSrc)));    return;
+        case Opcode::VANDN:    setI(roDst, _mm256_andnot_si256(getI(roDst), getI(roSrc))); return;
+
+        case Opcode::VADD_B:   setI(roDst, _mm256_add_epi8(getI(roDst), getI(roSrc)));     return;
+        case Opcode::VADD_W:   setI(roDst, _mm256_add_epi16(getI(roDst), getI(roSrc)));    return;
+        case Opcode::VADD_L:   setI(roDst, _mm256_add_epi32(getI(roDst), getI(roSrc)));    return;
+        case Opcode::VADD_Q:   setI(roDst, _mm256_add_epi64(getI(roDst), getI(roSrc)));    return;
+        case Opcode::VSUB_B:   setI(roDst, _mm256_sub_epi8(getI(roDst), getI(roSrc)));     return;
+        case Opcode::VSUB_W:   setI(roDst, _mm256_sub_epi16(getI(roDst), getI(roSrc)));    return;
+        case Opcode::VSUB_L:   setI(roDst, _mm256_sub_epi32(getI(roDst), getI(roSrc)));    return;
+        case Opcode::VSUB_Q:   setI(roDst, _mm256_sub_epi64(getI(roDst), getI(roSrc)));    return;
+
+        case Opcode::VADDS_B:  setI(roDst, _mm256_adds_epi8(getI(roDst), getI(roSrc)));    return;
+        case Opcode::VADDS_W:  setI(roDst, _mm256_adds_epi16(getI(roDst), getI(roSrc)));   return;
+        case Opcode::VADDUS_B: setI(roDst, _mm256_adds_epu8(getI(roDst), getI(roSrc)));    return;
+        case Opcode::VADDUS_W: setI(roDst, _mm256_adds_epu16(getI(roDst), getI(roSrc)));   return;
+        case Opcode::VSUBS_B:  setI(roDst, _mm256_subs_epi8(getI(roDst), getI(roSrc)));    return;
+        case Opcode::VSUBS_W:  setI(roDst, _mm256_subs_epi16(getI(roDst), getI(roSrc)));   return;
+        case Opcode::VSUBUS_B: setI(roDst, _mm256_subs_epu8(getI(roDst), getI(roSrc)));    return;
+        case Opcode::VSUBUS_W: setI(roDst, _mm256_subs_epu16(getI(roDst), getI(roSrc)));   return;
+
+        case Opcode::VMUL_W:   setI(roDst, _mm256_mullo_epi16(getI(roDst), getI(roSrc)));  return;
+        case Opcode::VMUL_L:   setI(roDst, _mm256_mullo_epi32(getI(roDst), getI(roSrc)));  return;
+
+        case Opcode::VLSL_W: setI(roDst, _mm256_sll_epi16(getI(roSrc), _mm_cvtsi32_si128(*puProgramCounter++ & 15))); return;
+        case Opcode::VLSL_L: setI(roDst, _mm256_sll_epi32(getI(roSrc), _mm_cvtsi32_si128(*puProgramCounter++ & 31))); return;
+        case Opcode::VLSL_Q: setI(roDst, _mm256_sll_epi64(getI(roSrc), _mm_cvtsi32_si128(*puProgramCounter++ & 63))); return;
+        case Opcode::VLSR_W: setI(roDst, _mm256_srl_epi16(getI(roSrc), _mm_cvtsi32_si128(*puProgramCounter++ & 15))); return;
+        case Opcode::VLSR_L: setI(roDst, _mm256_srl_epi32(getI(roSrc), _mm_cvtsi32_si128(*puProgramCounter++ & 31))); return;
+        case Opcode::VLSR_Q: setI(roDst, _mm256_srl_epi64(getI(roSrc), _mm_cvtsi32_si128(*puProgramCounter++ & 63))); return;
+        case Opcode::VASR_W: setI(roDst, _mm256_sra_epi16(getI(roSrc), _mm_cvtsi32_si128(*puProgramCounter++ & 15))); return;
+        case Opcode::VASR_L: setI(roDst, _mm256_sra_epi32(getI(roSrc), _mm_cvtsi32_si128(*puProgramCounter++ & 31))); return;
+
+        case Opcode::VFADD_S:  setS(roDst, _mm256_add_ps(getS(roDst), getS(roSrc))); return;
+        case Opcode::VFADD_D:  setD(roDst, _mm256_add_pd(getD(roDst), getD(roSrc))); return;
+        case Opcode::VFSUB_S:  setS(roDst, _mm256_sub_ps(getS(roDst), getS(roSrc))); return;
+        case Opcode::VFSUB_D:  setD(roDst, _mm256_sub_pd(getD(roDst), getD(roSrc))); return;
+        case Opcode::VFMUL_S:  setS(roDst, _mm256_mul_ps(getS(roDst), getS(roSrc))); return;
+        case Opcode::VFMUL_D:  setD(roDst, _mm256_mul_pd(getD(roDst), getD(roSrc))); return;
+        case Opcode::VFDIV_S:  setS(roDst, _mm256_div_ps(getS(roDst), getS(roSrc))); return;
+        case Opcode::VFDIV_D:  setD(roDst, _mm256_div_pd(getD(roDst), getD(roSrc))); return;
+        case Opcode::VFMIN_S:  setS(roDst, _mm256_min_ps(getS(roDst), getS(roSrc))); return;
+        case Opcode::VFMIN_D:  setD(roDst, _mm256_min_pd(getD(roDst), getD(roSrc))); return;
+        case Opcode::VFMAX_S:  setS(roDst, _mm256_max_ps(getS(roDst), getS(roSrc))); return;
+        case Opcode::VFMAX_D:  setD(roDst, _mm256_max_pd(getD(roDst), getD(roSrc))); return;
+
+    #if defined(__FMA__)
+        case Opcode::VFMA_S: setS(roDst, _mm256_fmadd_ps(getS(roSrc), getS(aoVR[*puProgramCounter++ & 0x0F]), getS(roDst))); return;
+        case Opcode::VFMA_D: setD(roDst, _mm256_fmadd_pd(getD(roSrc), getD(aoVR[*puProgramCounter++ & 0x0F]), getD(roDst))); return;
+    #else
+        case Opcode::VFMA_S: setS(roDst, _mm256_add_ps(getS(roDst), _mm256_mul_ps(getS(roSrc), getS(aoVR[*puProgramCounter++ & 0x0F])))); return;
+        case Opcode::VFMA_D: setD(roDst, _mm256_add_pd(getD(roDst), _mm256_mul_pd(getD(roSrc), getD(aoVR[*puProgramCounter++ & 0x0F])))); return;
+    #endif
+
+        case Opcode::VCVTL_S:  setS(roDst, _mm256_cvtepi32_ps(getI(roSrc)));  return;
+        case Opcode::VCVTS_L:  setI(roDst, _mm256_cvttps_epi32(getS(roSrc))); return;
+
+        case Opcode::VSHUF_L: {
+            // Build the permute index from the 2-bit selectors, offset into the upper half for lanes 4-7
+            __m256i vIndex = _mm256_or_si256(
+                _mm256_and_si256(
+                    _mm256_srlv_epi32(
+                        _mm256_set1_epi32(*puProgramCounter++),
+                        _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)
+                    ),
+                    _mm256_set1_epi32(3)
+                ),
+                _mm256_setr_epi32(0, 0, 0, 0, 4, 4, 4, 4)
+            );
+            setI(roDst, _mm256_permutevar8x32_epi32(getI(roSrc), vIndex));
+            return;
+        }
+
+        case Opcode::VPACKUS_W:
+            // packus works per 128-bit half, so gather the two packed quads back into the lower half
+            setI(roDst, _mm256_permute4x64_epi64(_mm256_packus_epi16(getI(roSrc), _mm256_setzero_si256()), 0xD8));
+            return;
+
+        case Opcode::VEXTU_B:
+            setI(roDst, _mm256_cvtepu8_epi16(_mm256_castsi256_si128(getI(roSrc))));
+            return;
+
+        default:
+            break;
+    }
+
+#else
+
+    switch (uOperation) {
+        case Opcode::VAND:     lanes(roDst.auQuad, roSrc.auQuad, [](uint64 a, uint64 b) { return a & b; });  return;
+        case Opcode::VOR:      lanes(roDst.auQuad, roSrc.auQuad, [](uint64 a, uint64 b) { return a | b; });  return;
+        case Opcode::VEOR:     lanes(roDst.auQuad, roSrc.auQuad, [](uint64 a, uint64 b) { return a ^ b; });  return;
+        case Opcode::VANDN:    lanes(roDst.auQuad, roSrc.auQuad, [](uint64 a, uint64 b) { return ~a & b; }); return;
+
+        case Opcode::VADD_B:   lanes(roDst.auByte, roSrc.auByte, [](uint8  a, uint8  b) { return (uint8)(a + b);  }); return;
+        case Opcode::VADD_W:   lanes(roDst.auWord, roSrc.auWord, [](uint16 a, uint16 b) { return (uint16)(a + b); }); return;
+        case Opcode::VADD_L:   lanes(roDst.auLong, roSrc.auLong, [](uint32 a, uint32 b) { return a + b; }); return;
+        case Opcode::VADD_Q:   lanes(roDst.auQuad, roSrc.auQuad, [](uint64 a, uint64 b) { return a + b; }); return;
+        case Opcode::VSUB_B:   lanes(roDst.auByte, roSrc.auByte, [](uint8  a, uint8  b) { return (uint8)(a - b);  }); return;
+        case Opcode::VSUB_W:   lanes(roDst.auWord, roSrc.auWord, [](uint16 a, uint16 b) { return (uint16)(a - b); }); return;
+        case Opcode::VSUB_L:   lanes(roDst.auLong, roSrc.auLong, [](uint32 a, uint32 b) { return a - b; }); return;
+        case Opcode::VSUB_Q:   lanes(roDst.auQuad, roSrc.auQuad, [](uint64 a, uint64 b) { return a - b; }); return;
+
+        case Opcode::VADDS_B:  lanes(roDst.aiByte, roSrc.aiByte, [](int8   a, int8   b) { return saturate<int8>(a + b);    }); return;
+        case Opcode::VADDS_W:  lanes(roDst.aiWord, roSrc.aiWord, [](int16  a, int16  b) { return saturate<int16>(a + b);   }); return;
+        case Opcode::VADDUS_B: lanes(roDst.auByte, roSrc.auByte, [](uint8  a, uint8  b) { return saturate<uint8>(a + b);   }); return;
+        case Opcode::VADDUS_W: lanes(roDst.auWord, roSrc.auWord, [](uint16 a, uint16 b) { return saturate<uint16>(a + b);  }); return;
+        case Opcode::VSUBS_B:  lanes(roDst.aiByte, roSrc.aiByte, [](int8   a, int8   b) { return saturate<int8>(a - b);    }); return;
+        case Opcode::VSUBS_W:  lanes(roDst.aiWord, roSrc.aiWord, [](int16  a, int16  b) { return saturate<int16>(a - b);   }); return;
+        case Opcode::VSUBUS_B: lanes(roDst.auByte, roSrc.auByte, [](uint8  a, uint8  b) { return saturate<uint8>(a - b);   }); return;
+        case Opcode::VSUBUS_W: lanes(roDst.auWord, roSrc.auWord, [](uint16 a, uint16 b) { return saturate<uint16>(a - b);  }); return;
+
+        case Opcode::VMUL_W:   lanes(roDst.auWord, roSrc.auWord, [](uint16 a, uint16 b) { return (uint16)(a * b); }); return;
+        case Opcode::VMUL_L:   lanes(roDst.auLong, roSrc.auLong, [](uint32 a, uint32 b) { return a * b; }); return;
+
+        case Opcode::VLSL_W: {
+            uint32 uShift = *puProgramCounter++ & 15;
+            lanes(roDst.auWord, roSrc.auWord, [uShift](uint16, uint16 b) { return (uint16)(b << uShift); });
+            return;
+        }
+        case Opcode::VLSL_L: {
+            uint32 uShift = *puProgramCounter++ & 31;
+            lanes(roDst.auLong, roSrc.auLong, [uShift](uint32, uint32 b) { return b << uShift; });
+            return;
+        }
+        case Opcode::VLSL_Q: {
+            uint32 uShift = *puProgramCounter++ & 63;
+            lanes(roDst.auQuad, roSrc.auQuad, [uShift](uint64, uint64 b) { return b << uShift; });
+            return;
+        }
+        case Opcode::VLSR_W: {
+            uint32 uShift = *puProgramCounter++ & 15;
+            lanes(roDst.auWord, roSrc.auWord, [uShift](uint16, uint16 b) { return (uint16)(b >> uShift); });
+            return;
+        }
+        case Opcode::VLSR_L: {
+            uint32 uShift = *puProgramCounter++ & 31;
+            lanes(roDst.auLong, roSrc.auLong, [uShift](uint32, uint32 b) { return b >> uShift; });
+            return;
+        }
+        case Opcode::VLSR_Q: {
+            uint32 uShift = *puProgramCounter++ & 63;
+            lanes(roDst.auQuad, roSrc.auQuad, [uShift](uint64, uint64 b) { return b >> uShift; });
+            return;
+        }
+        case Opcode::VASR_W: {
+            uint32 uShift = *puProgramCounter++ & 15;
+            lanes(roDst.aiWord, roSrc.aiWord, [uShift](int16, int16 b) { return (int16)(b >> uShift); });
+            return;
+        }
+        case Opcode::VASR_L: {
+            uint32 uShift = *puProgramCounter++ & 31;
+            lanes(roDst.aiLong, roSrc.aiLong, [uShift](int32, int32 b) { return b >> uShift; });
+            return;
+        }
+
+        case Opcode::VFADD_S:  lanes(roDst.afSingle, roSrc.afSingle, [](float32 a, float32 b) { return a + b; }); return;
+        case Opcode::VFADD_D:  lanes(roDst.afDouble, roSrc.afDouble, [](float64 a, float64 b) { return a + b; }); return;
+        case Opcode::VFSUB_S:  lanes(roDst.afSingle, roSrc.afSingle, [](float32 a, float32 b) { return a - b; }); return;
+        case Opcode::VFSUB_D:  lanes(roDst.afDouble, roSrc.afDouble, [](float64 a, float64 b) { return a - b; }); return;
+        case Opcode::VFMUL_S:  lanes(roDst.afSingle, roSrc.afSingle, [](float32 a, float32 b) { return a * b; }); return;
+        case Opcode::VFMUL_D:  lanes(roDst.afDouble, roSrc.afDouble, [](float64 a, float64 b) { return a * b; }); return;
+        case Opcode::VFDIV_S:  lanes(roDst.afSingle, roSrc.afSingle, [](float32 a, float32 b) { return a / b; }); return;
+        case Opcode::VFDIV_D:  lanes(roDst.afDouble, roSrc.afDouble, [](float64 a, float64 b) { return a / b; }); return;
+        case Opcode::VFMIN_S:  lanes(roDst.afSingle, roSrc.afSingle, [](float32 a, float32 b) { return a < b ? a : b; }); return;
+        case Opcode::VFMIN_D:  lanes(roDst.afDouble, roSrc.afDouble, [](float64 a, float64 b) { return a < b ? a : b; }); return;
+        case Opcode::VFMAX_S:  lanes(roDst.afSingle, roSrc.afSingle, [](float32 a, float32 b) { return a > b ? a : b; }); return;
+        case Opcode::VFMAX_D:  lanes(roDst.afDouble, roSrc.afDouble, [](float64 a, float64 b) { return a > b ? a : b; }); return;
+
+        case Opcode::VFMA_S: {
+            VRegister const& roSrc2 = aoVR[*puProgramCounter++ & 0x0F];
+            for (unsigned u = 0; u < VRegister::SIZE / sizeof(float32); ++u) {
+                roDst.afSingle[u] += roSrc.afSingle[u] * roSrc2.afSingle[u];
+            }
+            return;
+        }
+        case Opcode::VFMA_D: {
+            VRegister const& roSrc2 = aoVR[*puProgramCounter++ & 0x0F];
+            for (unsigned u = 0; u < VRegister::SIZE / sizeof(float64); ++u) {
+                roDst.afDouble[u] += roSrc.afDouble[u] * roSrc2.afDouble[u];
+            }
+            return;
+        }
+
+        case Opcode::VCVTL_S: {
+            VRegister oResult;
+            for (unsigned u = 0; u < VRegister::SIZE / sizeof(int32); ++u) {
+                oResult.afSingle[u] = (float32)roSrc.aiLong[u];
+            }
+            roDst = oResult;
+            return;
+        }
+        case Opcode::VCVTS_L: {
+            VRegister oResult;
+            for (unsigned u = 0; u < VRegister::SIZE / sizeof(float32); ++u) {
+                oResult.aiLong[u] = (int32)roSrc.afSingle[u];
+            }
+            roDst = oResult;
+            return;
+        }
+
+        case Opcode::VSHUF_L: {
+            uint8     uSelect = *puProgramCounter++;
+            VRegister oResult;
+            for (unsigned u = 0; u < VRegister::SIZE / sizeof(uint32); ++u) {
+                oResult.auLong[u] = roSrc.auLong[(u & 4) | ((uSelect >> ((u & 3) << 1)) & 3)];
+            }
+            roDst = oResult;
+            return;
+        }
+
+        case Opcode::VPACKUS_W: {
+            VRegister oResult;
+            for (unsigned u = 0; u < VRegister::SIZE / sizeof(int16); ++u) {
+                oResult.auByte[u] = saturate<uint8>(roSrc.aiWord[u]);
+            }
+            roDst = oResult;
+            return;
+        }
+
+        case Opcode::VEXTU_B: {
+            VRegister oResult;
+            for (unsigned u = 0; u < VRegister::SIZE / sizeof(uint16); ++u) {
+                oResult.auWord[u] = roSrc.auByte[u];
+            }
+            roDst = oResult;
+            return;
+        }
+
+        default:
+            break;
+    }
+
+#endif
+
+    eStatus = UNIMPLEMENTED_OPCODE;
+}
+
+} // namespace
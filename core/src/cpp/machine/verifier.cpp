@@ -0,0 +1,693 @@
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <machine/verifier.hpp>
+#include <machine/error.hpp>
+#include <bytecode/opcode.hpp>
+#include <bytecode/effective_address.hpp>
+#include <loader/executable.hpp>
+#include <loader/symbol.hpp>
+
+namespace MC64K::Machine {
+
+using namespace MC64K::ByteCode;
+
+namespace {
+
+    /**
+     * Conditions handled by the monadic compare operations (bmc, r_bmc, scm)
+     */
+    inline bool isMonadicCondition(uint8 const uCondition) {
+        return uCondition <= Opcode::FNE_D ||
+            (uCondition >= Opcode::ILT_B && uCondition <= Opcode::ILT_Q) ||
+            Opcode::FLT_S == uCondition || Opcode::FLT_D == uCondition ||
+            (uCondition >= Opcode::IGT_B && uCondition <= Opcode::IGT_Q) ||
+            Opcode::FGT_S == uCondition || Opcode::FGT_D == uCondition;
+    }
+
+    /**
+     * Conditions handled by the dyadic compare operations (bdc, r2r_bdc, scd)
+     */
+    inline bool isDyadicCondition(uint8 const uCondition) {
+        return uCondition <= Opcode::BPC_Q;
+    }
+
+    /**
+     * Opcodes whose only operand is a packed register pair byte
+     */
+    inline bool isRegisterPairOperation(uint8 const uOpcode) {
+        return
+            (uOpcode >= Opcode::R2R_MOVE_L && uOpcode <= Opcode::R2R_SWAP_Q) ||
+            (uOpcode >= Opcode::R2R_AND_L  && uOpcode <= Opcode::R2R_LSR_Q)  ||
+            (uOpcode >= Opcode::R2R_EXTB_L && uOpcode <= Opcode::R2R_FSQRT_D) ||
+            Opcode::UNLK  == uOpcode ||
+            Opcode::BFFFO == uOpcode ||
+            Opcode::BFCNT == uOpcode;
+    }
+
+    /**
+     * Effective address modes that give the start of a block of memory
+     */
+    inline bool isBlockAddress(uint8 const uMode) {
+        switch (uMode & 0xF0) {
+            case EffectiveAddress::OFS_GPR_DIR:
+            case EffectiveAddress::OFS_FPR_DIR:
+                return false;
+            case EffectiveAddress::OFS_OTHER:
+                return EffectiveAddress::Other::PC_IND_DSP == (uMode & 0x0F);
+            default:
+                return true;
+        }
+    }
+
+    /**
+     * Bit field offset and width bytes. Each is an immediate or a register, an all immediate field must fit in the
+     * operand. Register fields are cut short at run time.
+     */
+    inline bool isBitField(uint32 const uOffset, uint32 const uWidth) {
+        uint32 const uRegisterMask = Opcode::BF_REGISTER | Opcode::BF_REGISTER_MASK;
+        bool bOffsetValid = (uOffset & Opcode::BF_REGISTER) ? !(uOffset & ~uRegisterMask) : uOffset <= 63;
+        bool bWidthValid  = (uWidth & Opcode::BF_REGISTER)  ? !(uWidth & ~uRegisterMask)  : uWidth - 1 <= 63;
+        return bOffsetValid && bWidthValid && (((uOffset | uWidth) & Opcode::BF_REGISTER) || uOffset + uWidth <= 64);
+    }
+}
+
+/**
+ * @inheritDoc
+ */
+Verifier::Verifier(Loader::Executable const& roExecutable) :
+    roExecutable(roExecutable),
+    puByteCode(roExecutable.getByteCode()),
+    uByteCodeSize(roExecutable.getByteCodeSize()),
+    uVerifiedSize(0),
+    auState(roExecutable.getByteCodeSize(), STATE_UNVISITED),
+    sIssue(0),
+    uNumUnresolved(0),
+    bSpeculative(false)
+{
+    uint64 uFailedAt = 0;
+
+    // Everything reachable from an exported entry point must verify.
+    Loader::SymbolSet const* poExports = roExecutable.getExportedSymbolSet();
+    for (size_t u = 0; u < poExports->getCount(); ++u) {
+        Loader::Symbol const& roSymbol = (*poExports)[u];
+        if (!(roSymbol.uFlags & Loader::Symbol::EXECUTE)) {
+            continue;
+        }
+        uint64 uOffset = (uint64)(roSymbol.puByteCode - puByteCode);
+        if (uOffset >= uByteCodeSize) {
+            std::fprintf(stderr, "Verifier: Exported symbol '%s' is outside the bytecode\n", roSymbol.sIdentifier);
+            throw Error("Bytecode verification failed");
+        }
+        if (!walk(uOffset, uFailedAt)) {
+            std::fprintf(
+                stderr,
+                "Verifier: %s at offset 0x%lX, reached from '%s'\n",
+                sIssue,
+                uFailedAt,
+                roSymbol.sIdentifier
+            );
+            throw Error("Bytecode verification failed");
+        }
+    }
+
+    // Addresses taken of code that may be called indirectly. Whatever doesn't decode is left to the checked
+    // interpreter and anything it had claimed is released again.
+    bSpeculative = true;
+    uint32 uNumRejected = 0;
+    while (!auSpeculative.empty()) {
+        uint64 uOffset = auSpeculative.back();
+        auSpeculative.pop_back();
+        auClaimed.clear();
+        uint32 uUnresolvedBefore = uNumUnresolved;
+        size_t uReferencesBefore = auImportReferences.size();
+        if (!walk(uOffset, uFailedAt)) {
+            for (uint64 uClaimed : auClaimed) {
+                auState[uClaimed] = STATE_UNVISITED;
+            }
+            uNumUnresolved = uUnresolvedBefore;
+            auImportReferences.resize(uReferencesBefore);
+            ++uNumRejected;
+        }
+    }
+
+    uint64 uNumInstructions = 0;
+    uint64 uNumCovered      = 0;
+    for (uint8 uState : auState) {
+        uNumInstructions += (STATE_INSTRUCTION == uState);
+        uNumCovered      += (STATE_UNVISITED   != uState);
+    }
+
+    if (uNumUnresolved) {
+        // The checked interpreter halts on an unresolved reference, so none of the code can run unchecked.
+        std::fprintf(
+            stderr,
+            "Verifier: %u references to unresolvable imports, using checked dispatch\n",
+            uNumUnresolved
+        );
+        return;
+    }
+
+    uVerifiedSize = uByteCodeSize;
+    std::fprintf(
+        stderr,
+        "Verifier: %lu instructions verified, covering %lu of %lu bytes (%u speculative entries rejected)\n",
+        uNumInstructions,
+        uNumCovered,
+        uByteCodeSize,
+        uNumRejected
+    );
+}
+
+/**
+ * @inheritDoc
+ */
+bool Verifier::walk(uint64 const uOffset, uint64& ruFailedAt) {
+    auPending.clear();
+    auPending.push_back(uOffset);
+    while (!auPending.empty()) {
+        uint64 uPosition = auPending.back();
+        auPending.pop_back();
+
+        bool bContinues = true;
+        while (bContinues) {
+            ruFailedAt = uPosition;
+            if (uPosition >= uByteCodeSize) {
+                return fail("Execution runs past the end of the bytecode");
+            }
+            if (STATE_INSTRUCTION == auState[uPosition]) {
+                break;
+            }
+            if (STATE_OPERAND == auState[uPosition]) {
+                return fail("Branch into the middle of an instruction");
+            }
+
+            uint64 uLength = 0;
+            if (!decodeInstruction(uPosition, uLength, bContinues)) {
+                return false;
+            }
+            for (uint64 u = 1; u < uLength; ++u) {
+                if (STATE_UNVISITED != auState[uPosition + u]) {
+                    return fail("Instruction overlaps another");
+                }
+            }
+            auState[uPosition] = STATE_INSTRUCTION;
+            std::memset(auState.data() + uPosition + 1, STATE_OPERAND, uLength - 1);
+            if (bSpeculative) {
+                for (uint64 u = 0; u < uLength; ++u) {
+                    auClaimed.push_back(uPosition + u);
+                }
+            }
+            uPosition += uLength;
+        }
+    }
+    return true;
+}
+
+/**
+ * @inheritDoc
+ */
+bool Verifier::decodeInstruction(uint64 const uOffset, uint64& ruLength, bool& rbContinues) {
+    uint64 uPosition = uOffset + 1;
+    uint8  uOpcode   = puByteCode[uOffset];
+
+    // Number of bytes that must be available beyond the current position. Effective addresses check their own.
+    #define require(n) if (uPosition + (n) > uByteCodeSize) { return fail("Truncated instruction"); }
+
+    // Reads the 32-bit displacement of a branch and queues the target, relative to the end of the instruction.
+    #define branch() { \
+        require(4); \
+        int32 iDisplacement = readLong(uPosition); \
+        uPosition += 4; \
+        if (!queueBranch(uPosition, iDisplacement)) { return false; } \
+    }
+
+    rbContinues = true;
+    switch (uOpcode) {
+        case Opcode::STOP:
+            rbContinues = false;
+            break;
+
+        case Opcode::RTS:
+            rbContinues = false;
+            break;
+
+        case Opcode::HOST:
+            require(2);
+            uPosition += 2;
+            break;
+
+        case Opcode::BRA_B:
+        case Opcode::BSR_B: {
+            require(1);
+            int8 iDisplacement = (int8)puByteCode[uPosition++];
+            if (!queueBranch(uPosition, iDisplacement)) {
+                return false;
+            }
+            rbContinues = (Opcode::BSR_B == uOpcode);
+            break;
+        }
+
+        case Opcode::BRA:
+        case Opcode::BSR:
+            branch();
+            rbContinues = (Opcode::BSR == uOpcode);
+            break;
+
+        case Opcode::JMP:
+            if (!decodeEffectiveAddress(uPosition, true)) {
+                return false;
+            }
+            rbContinues = false;
+            break;
+
+        case Opcode::JSR:
+        case Opcode::CLR_B:
+        case Opcode::CLR_W:
+        case Opcode::CLR_L:
+        case Opcode::CLR_Q:
+            if (!decodeEffectiveAddress(uPosition, true)) {
+                return false;
+            }
+            break;
+
+        case Opcode::PEA:
+            if (!decodeEffectiveAddress(uPosition, true, true)) {
+                return false;
+            }
+            break;
+
+        case Opcode::DBNZ:
+            if (!decodeEffectiveAddress(uPosition, true)) {
+                return false;
+            }
+            branch();
+            break;
+
+        case Opcode::BMC:
+            require(1);
+            if (!isMonadicCondition(puByteCode[uPosition++])) {
+                return fail("Invalid condition");
+            }
+            if (!decodeEffectiveAddress(uPosition, true)) {
+                return false;
+            }
+            branch();
+            break;
+
+        case Opcode::BDC:
+            require(1);
+            if (!isDyadicCondition(puByteCode[uPosition++])) {
+                return fail("Invalid condition");
+            }
+            if (
+                !decodeEffectiveAddress(uPosition, true) ||
+                !decodeEffectiveAddress(uPosition, false)
+            ) {
+                return false;
+            }
+            branch();
+            break;
+
+        case Opcode::R_BMC:
+            require(2);
+            if (!isMonadicCondition(puByteCode[uPosition])) {
+                return fail("Invalid condition");
+            }
+            uPosition += 2;
+            branch();
+            break;
+
+        case Opcode::R2R_BDC:
+            require(2);
+            if (!isDyadicCondition(puByteCode[uPosition])) {
+                return fail("Invalid condition");
+            }
+            uPosition += 2;
+            branch();
+            break;
+
+        case Opcode::R_DBNZ:
+            require(1);
+            ++uPosition;
+            branch();
+            break;
+
+        case Opcode::SAVEM:
+        case Opcode::LOADM: {
+            require(5);
+            uint8 uMode = puByteCode[Opcode::SAVEM == uOpcode ? uPosition : uPosition + 4] & 0xF0;
+            if (uMode < EffectiveAddress::OFS_GPR_IND_POST_INC || uMode > EffectiveAddress::OFS_GPR_IND_PRE_DEC) {
+                return fail("Invalid register list addressing mode");
+            }
+            uPosition += 5;
+            break;
+        }
+
+        case Opcode::LINK:
+            require(5);
+            uPosition += 5;
+            break;
+
+        case Opcode::LEA:
+            if (
+                !decodeEffectiveAddress(uPosition, true) ||
+                !decodeEffectiveAddress(uPosition, false, true)
+            ) {
+                return false;
+            }
+            break;
+
+        case Opcode::SCM:
+            require(1);
+            if (!isMonadicCondition(puByteCode[uPosition++])) {
+                return fail("Invalid condition");
+            }
+            if (
+                !decodeEffectiveAddress(uPosition, true) ||
+                !decodeEffectiveAddress(uPosition, false)
+            ) {
+                return false;
+            }
+            break;
+
+        case Opcode::SCD:
+            require(1);
+            if (!isDyadicCondition(puByteCode[uPosition++])) {
+                return fail("Invalid condition");
+            }
+            if (
+                !decodeEffectiveAddress(uPosition, true)  ||
+                !decodeEffectiveAddress(uPosition, false) ||
+                !decodeEffectiveAddress(uPosition, false)
+            ) {
+                return false;
+            }
+            break;
+
+        case Opcode::R2R_FMACC_S:
+        case Opcode::R2R_FMACC_D:
+        case Opcode::R2R_FMADD_S:
+        case Opcode::R2R_FMADD_D:
+            require(2);
+            uPosition += 2;
+            break;
+
+        case Opcode::VEC: {
+            require(2);
+            uint8 uOperation = puByteCode[uPosition];
+            uPosition += 2;
+            switch (uOperation) {
+                case Opcode::VLOAD:
+                case Opcode::VSTORE:
+                    if (uPosition >= uByteCodeSize || !isBlockAddress(puByteCode[uPosition])) {
+                        return fail("Invalid vector address");
+                    }
+                    if (!decodeEffectiveAddress(uPosition, true)) {
+                        return false;
+                    }
+                    break;
+
+                case Opcode::VSPLAT_B:
+                case Opcode::VSPLAT_W:
+                case Opcode::VSPLAT_L:
+                case Opcode::VSPLAT_Q:
+                    if (!decodeEffectiveAddress(uPosition, true)) {
+                        return false;
+                    }
+                    break;
+
+                case Opcode::VLSL_W:
+                case Opcode::VLSL_L:
+                case Opcode::VLSL_Q:
+                case Opcode::VLSR_W:
+                case Opcode::VLSR_L:
+                case Opcode::VLSR_Q:
+                case Opcode::VASR_W:
+                case Opcode::VASR_L:
+                case Opcode::VFMA_S:
+                case Opcode::VFMA_D:
+                case Opcode::VSHUF_L:
+                    require(1);
+                    ++uPosition;
+                    break;
+
+                default:
+                    if (uOperation >= Opcode::VMAX_OPERATION) {
+                        return fail("Invalid vector operation");
+                    }
+                    break;
+            }
+            break;
+        }
+
+        case Opcode::BIT: {
+            require(1);
+            uint8 uOperation = puByteCode[uPosition++];
+            if (uOperation >= Opcode::BMAX_OPERATION) {
+                return fail("Invalid bit operation");
+            }
+            if (uOperation >= Opcode::BFEXTU) {
+                require(2);
+                uint32 uFieldOffset = puByteCode[uPosition++];
+                uint32 uFieldWidth  = puByteCode[uPosition++];
+                if (!isBitField(uFieldOffset, uFieldWidth)) {
+                    return fail("Invalid bit field");
+                }
+            }
+            if (
+                !decodeEffectiveAddress(uPosition, true) ||
+                !decodeEffectiveAddress(uPosition, false)
+            ) {
+                return false;
+            }
+            break;
+        }
+
+        case Opcode::CSEL:
+            require(1);
+            if (!isDyadicCondition(puByteCode[uPosition++])) {
+                return fail("Invalid condition");
+            }
+            if (
+                !decodeEffectiveAddress(uPosition, true)  ||
+                !decodeEffectiveAddress(uPosition, false) ||
+                !decodeEffectiveAddress(uPosition, false) ||
+                !decodeEffectiveAddress(uPosition, false) ||
+                !decodeEffectiveAddress(uPosition, false)
+            ) {
+                return false;
+            }
+            break;
+
+        case Opcode::MINMAX: {
+            require(1);
+            uint8 uOperation = puByteCode[uPosition++];
+            if (uOperation >= Opcode::MMAX_OPERATION) {
+                return fail("Invalid min/max operation");
+            }
+            if (
+                !decodeEffectiveAddress(uPosition, true) ||
+                !decodeEffectiveAddress(uPosition, false)
+            ) {
+                return false;
+            }
+            if (uOperation >= Opcode::CLAMP_B && !decodeEffectiveAddress(uPosition, false)) {
+                return false;
+            }
+            break;
+        }
+
+        case Opcode::BLK: {
+            require(2);
+            uint8 uOperation = puByteCode[uPosition++];
+            if (uOperation >= Opcode::BLKMAX_OPERATION) {
+                return fail("Invalid block operation");
+            }
+            if (puByteCode[uPosition++] > 15) {
+                return fail("Invalid block length register");
+            }
+            if (uPosition >= uByteCodeSize || !isBlockAddress(puByteCode[uPosition])) {
+                return fail("Invalid block address");
+            }
+            if (!decodeEffectiveAddress(uPosition, true)) {
+                return false;
+            }
+            if (
+                uPosition < uByteCodeSize &&
+                (uOperation < Opcode::BFILL_B || uOperation > Opcode::BFILL_Q) &&
+                !isBlockAddress(puByteCode[uPosition])
+            ) {
+                return fail("Invalid block address");
+            }
+            if (!decodeEffectiveAddress(uPosition, false)) {
+                return false;
+            }
+            break;
+        }
+
+        // Undocumented timing opcode
+        case 0xF0:
+            break;
+
+        default:
+            if (isRegisterPairOperation(uOpcode)) {
+                require(1);
+                ++uPosition;
+            } else if (uOpcode < Opcode::OFS_OTHER) {
+                if (
+                    !decodeEffectiveAddress(uPosition, true) ||
+                    !decodeEffectiveAddress(uPosition, false)
+                ) {
+                    return false;
+                }
+            } else {
+                return fail("Invalid opcode");
+            }
+            break;
+    }
+
+    #undef branch
+    #undef require
+
+    ruLength = uPosition - uOffset;
+    return true;
+}
+
+/**
+ * @inheritDoc
+ */
+bool Verifier::decodeEffectiveAddress(uint64& ruPosition, bool const bFirst, bool const bAddressTaken) {
+    if (ruPosition >= uByteCodeSize) {
+        return fail("Truncated effective address");
+    }
+    uint8  uMode    = puByteCode[ruPosition++];
+    uint8  uLower   = uMode & 0x0F;
+    uint64 uExtra   = 0;
+    switch (uMode & 0xF0) {
+        case EffectiveAddress::OFS_GPR_DIR:
+        case EffectiveAddress::OFS_GPR_IND:
+        case EffectiveAddress::OFS_GPR_IND_POST_INC:
+        case EffectiveAddress::OFS_GPR_IND_POST_DEC:
+        case EffectiveAddress::OFS_GPR_IND_PRE_INC:
+        case EffectiveAddress::OFS_GPR_IND_PRE_DEC:
+        case EffectiveAddress::OFS_FPR_DIR:
+            break;
+
+        case EffectiveAddress::OFS_GPR_IND_DSP8: uExtra = 1; break;
+        case EffectiveAddress::OFS_GPR_IND_DSP:  uExtra = 4; break;
+        case EffectiveAddress::OFS_GPR_IDX:      uExtra = 1; break;
+        case EffectiveAddress::OFS_GPR_IDX_DSP8: uExtra = 2; break;
+        case EffectiveAddress::OFS_GPR_IDX_DSP:  uExtra = 5; break;
+
+        case EffectiveAddress::OFS_OTHER:
+            switch (uLower) {
+                case EffectiveAddress::Other::INT_IMM_BYTE:   uExtra = 1; break;
+                case EffectiveAddress::Other::INT_IMM_WORD:   uExtra = 2; break;
+                case EffectiveAddress::Other::INT_IMM_LONG:
+                case EffectiveAddress::Other::FLT_IMM_SINGLE: uExtra = 4; break;
+                case EffectiveAddress::Other::INT_IMM_QUAD:
+                case EffectiveAddress::Other::FLT_IMM_DOUBLE: uExtra = 8; break;
+
+                case EffectiveAddress::Other::PC_IND_DSP:
+                    if (ruPosition + 4 > uByteCodeSize) {
+                        return fail("Truncated effective address");
+                    }
+                    if (bAddressTaken) {
+                        uint64 uTarget = ruPosition + 4 + (uint64)(int64)readLong(ruPosition);
+                        if (uTarget < uByteCodeSize) {
+                            auSpeculative.push_back(uTarget);
+                        }
+                    }
+                    uExtra = 4;
+                    break;
+
+                default:
+                    // Small integer immediates
+                    break;
+            }
+            break;
+
+        case EffectiveAddress::OFS_OTHER_2:
+            switch (uLower) {
+                case EffectiveAddress::SAME_AS_DEST:
+                    if (bFirst) {
+                        return fail("Invalid effective address mode");
+                    }
+                    break;
+
+                case EffectiveAddress::IMPORT_SYMBOL_ID:
+                    if (ruPosition + 4 > uByteCodeSize) {
+                        return fail("Truncated effective address");
+                    }
+                    if (!checkImport((uint32)readLong(ruPosition))) {
+                        return false;
+                    }
+                    auImportReferences.push_back(ruPosition - 1);
+                    uExtra = 4;
+                    break;
+
+                default:
+                    return fail("Invalid effective address mode");
+            }
+            break;
+
+        default:
+            return fail("Invalid effective address mode");
+    }
+    if (ruPosition + uExtra > uByteCodeSize) {
+        return fail("Truncated effective address");
+    }
+    ruPosition += uExtra;
+    return true;
+}
+
+/**
+ * @inheritDoc
+ */
+bool Verifier::queueBranch(uint64 const uEnd, int64 const iDisplacement) {
+    uint64 uTarget = uEnd + (uint64)iDisplacement;
+    if (uTarget >= uByteCodeSize) {
+        return fail("Branch target outside of the bytecode");
+    }
+    auPending.push_back(uTarget);
+    return true;
+}
+
+/**
+ * @inheritDoc
+ */
+bool Verifier::checkImport(uint32 const uIndex) {
+    Loader::SymbolSet const* poImports = roExecutable.getImportedSymbolSet();
+    if (uIndex >= poImports->getCount()) {
+        return fail("Imported symbol index out of range");
+    }
+    Loader::Symbol const& roSymbol = (*poImports)[uIndex];
+    if (!roSymbol.pRawData) {
+        ++uNumUnresolved;
+    }
+    return true;
+}
+
+/**
+ * @inheritDoc
+ */
+int32 Verifier::readLong(uint64 const uPosition) const {
+    int32 iValue;
+    std::memcpy(&iValue, puByteCode + uPosition, sizeof(int32));
+    return iValue;
+}
+
+} // namespace
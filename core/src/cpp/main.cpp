@@ -39,6 +39,15 @@ int main(int iArgN, char const** aArgV) {
 
         MC64K::StandardTestHost::setCLIParameters(iArgN, aArgV);
         MC64K::Host::Runtime oRuntime(MC64K::StandardTestHost::instance, sExecutableName);
+
+        // Opt in to hot reload of the binary for development
+        if (std::getenv("MC64K_HOT_RELOAD")) {
+            try {
+                oRuntime.enableHotReload();
+            } catch (MC64K::Exception& oError) {
+                std::fprintf(stderr, "Hot reload unavailable: %s.\n", oError.getMessage());
+            }
+        }
         oRuntime.invoke(MC64K::StandardTestHost::ABI::MAIN);
 
     } catch (MC64K::Loader::Error& oError) {
@@ -48,6 +57,9 @@ int main(int iArgN, char const** aArgV) {
             oError.sIssue
         );
         std::exit(EXIT_FAILURE);
+    } catch (MC64K::Loader::LinkError&) {
+        std::printf("Unable to link binary file \"%s\" against the host.\n", aArgV[1]);
+        std::exit(EXIT_FAILURE);
     } catch (MC64K::Machine::Error& oError) {
         std::printf(
             "Machine error: %s.\n",
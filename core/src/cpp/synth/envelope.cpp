@@ -21,6 +21,17 @@
 namespace MC64K::Synth::Audio::Signal {
 using namespace MC64K::StandardTestHost::Audio::IConfig;
 
+/**
+ * Points a constant packet at the given level. Constant packets may still be held by consumers, so an existing one
+ * is only kept when it is already at that level and a new one is made otherwise, rather than refilling it.
+ */
+static void setConstantPacket(Packet::Ptr& roPacket, float32 fLevel) {
+    if (!roPacket.get() || roPacket->afSamples[0] != fLevel) {
+        roPacket = Packet::create();
+        roPacket->fillWith(fLevel);
+    }
+}
+
 /**
  * @inheritDoc
  */
@@ -89,6 +100,16 @@ void DecayPulse::recalculateDecay() {
     fCurrent = (fInitial * fLevelScale) - fTarget;
     float64 fHalfLifeInSamples = (PROCESS_RATE * fHalflife * fTimeScale);
     fDecayPerSample   = 0.5 * std::exp2((fHalfLifeInSamples - 1.0) / fHalfLifeInSamples);
+
+    // Precompute the per sample decay across a packet so that each packet is a single multiply-add
+    float64 fPower = 1.0;
+    for (unsigned u = 0; u < PACKET_SIZE; ++u) {
+        fPower *= fDecayPerSample;
+        afDecayPowers[u] = (float32)fPower;
+    }
+    fDecayPerPacket = fPower;
+
+    setConstantPacket(poTargetPacket, fTarget);
     bParameterChanged = false;
 }
 
@@ -101,18 +122,25 @@ Packet::ConstPtr DecayPulse::emit(size_t uIndex) {
         return Packet::getSilence();
     }
     if (useLast(uIndex)) {
-        return poOutputPacket;
+        return poLastOutput;
     }
     if (bParameterChanged) {
         recalculateDecay();
     }
+    uSamplePosition += PACKET_SIZE;
+
+    // Fully decayed, no further work required.
+    if (std::fabs(fCurrent) < MIN_DECAY_LEVEL) {
+        return poLastOutput = poTargetPacket;
+    }
+
     float32* afSamples = poOutputPacket->afSamples;
+    float32  fStart    = (float32)fCurrent;
     for (unsigned u = 0; u < PACKET_SIZE; ++u) {
-        fCurrent *= fDecayPerSample;
-        afSamples[u] = (float32)fCurrent + fTarget;
+        afSamples[u] = fStart * afDecayPowers[u] + fTarget;
     }
-    uSamplePosition += PACKET_SIZE;
-    return poOutputPacket;
+    fCurrent *= fDecayPerPacket;
+    return poLastOutput = poOutputPacket;
 }
 
 /**
@@ -160,7 +188,9 @@ namespace MC64K::Synth::Audio::Signal::Envelope {
  */
 Shape::Shape(float32 fInitial, Point const* aoInputPoints, size_t uNumInputPoints):
     aoPoints(0),
-    uNumPoints(0)
+    uNumPoints(0),
+    uNumSegments(0),
+    uSegment(0)
 {
     std::fprintf(stderr, "Created Shape at %p with %lu vertices\n", this, uNumInputPoints);
     processPointList(fInitial, aoInputPoints, uNumInputPoints);
@@ -179,7 +209,7 @@ Shape::~Shape() {
  */
 Shape* Shape::reset() {
     IEnvelope::reset();
-    pNextProcessPoint = aoProcessPoints.get();
+    uSegment = 0;
     return this;
 }
 
@@ -191,36 +221,47 @@ Packet::ConstPtr Shape::emit(size_t uIndex) {
         return Packet::getSilence();
     }
     if (useLast(uIndex)) {
-        return poOutputPacket;
+        return poLastOutput;
     }
     if (bParameterChanged) {
         recalculate();
     }
-    if (uSamplePosition > uFinalSamplePosition) {
-        uSamplePosition += PACKET_SIZE;
-        return pFinalPacket;
-    }
 
-    // Does the next packet contain a vertex?
-    if (uSamplePosition + PACKET_SIZE > pNextProcessPoint->uSamplePosition) {
-        // version that checks for interpolant change. There could even be more than one...
-        float32* afSamples = poOutputPacket->afSamples;
-        for (unsigned u = 0; u < PACKET_SIZE; ++u) {
-            if (pNextProcessPoint->uSamplePosition == uSamplePosition) {
-                updateInterpolants();
-                ++pNextProcessPoint; // we should probably range check this too...
-            }
-            afSamples[u] = (float32)(fYOffset + (float64)(++uSamplePosition - uXOffset) * fGradient);
+    float32* afSamples = poOutputPacket->afSamples;
+    unsigned uOffset   = 0;
+    while (uOffset < PACKET_SIZE) {
+
+        // Advance to the segment containing the current position. The final segment never ends.
+        while (uSegment + 1 < uNumSegments && aoSegments[uSegment + 1].uStart <= uSamplePosition) {
+            ++uSegment;
         }
-    } else {
-        // version that doesn't check for interpolant change
-        float32* afSamples = poOutputPacket->afSamples;
-        for (unsigned u = 0; u < PACKET_SIZE; ++u) {
-            afSamples[u] = (float32)(fYOffset + (float64)(++uSamplePosition - uXOffset) * fGradient);
+        Segment const& roSegment = aoSegments[uSegment];
+        size_t uRemaining = (uSegment + 1 < uNumSegments) ?
+            aoSegments[uSegment + 1].uStart - uSamplePosition :
+            PACKET_SIZE;
+
+        // Whole packet in a flat segment, e.g. sustaining or finished: hand out the shared packet.
+        if (0 == uOffset && uRemaining >= PACKET_SIZE && roSegment.poConstant.get()) {
+            uSamplePosition += PACKET_SIZE;
+            return poLastOutput = roSegment.poConstant;
+        }
+
+        unsigned uCount = (unsigned)(
+            uRemaining < (PACKET_SIZE - uOffset) ? uRemaining : (PACKET_SIZE - uOffset)
+        );
+        float32 fBase  = (float32)(
+            roSegment.fIntercept + roSegment.fSlope * (float64)(uSamplePosition + 1 - roSegment.uStart)
+        );
+        float32 fSlope = (float32)roSegment.fSlope;
+        float32* afSpan = afSamples + uOffset;
+        for (unsigned u = 0; u < uCount; ++u) {
+            afSpan[u] = fBase + fSlope * (float32)u;
         }
+        uOffset         += uCount;
+        uSamplePosition += uCount;
     }
 
-    return poOutputPacket;
+    return poLastOutput = poOutputPacket;
 }
 
 /**
@@ -229,7 +270,7 @@ Packet::ConstPtr Shape::emit(size_t uIndex) {
 void Shape::processPointList(float32 fInitial, Point const* aoInputPoints, size_t uNumInputPoints) {
     uNumPoints = uNumInputPoints + 1;
     aoPoints.reset(new Point[uNumPoints]);
-    aoProcessPoints.reset(new ProcessPoint[uNumPoints + 1]);
+    aoSegments.reset(new Segment[uNumPoints]);
     aoPoints[0].fLevel = fInitial;
     aoPoints[0].fTime  = 0.0f;
     std::printf("\t[%.2f, %.2f]\n", aoPoints[0].fLevel, aoPoints[0].fTime);
@@ -240,48 +281,51 @@ void Shape::processPointList(float32 fInitial, Point const* aoInputPoints, size_
         std::printf("\t[%.2f, %.2f]\n", aoPoints[u + 1].fLevel, aoPoints[u + 1].fTime);
     }
     bParameterChanged = true;
-    pNextProcessPoint = aoProcessPoints.get();
+    uSegment          = 0;
 }
 
 /**
  * @inheritDoc
+ *
+ * Compiles the point list into the segment table. Points that land on the same sample position after
+ * time scaling produce no segment.
  */
 void Shape::recalculate() {
-    float64 fTimeTotal = 0.0f;
-    for (size_t u = 0; u < uNumPoints; ++u) {
+    float64 fTimeTotal   = 0.0;
+    size_t  uLastStart   = 0;
+    float64 fLastLevel   = aoPoints[0].fLevel * fLevelScale;
+    uNumSegments = 0;
+    for (size_t u = 1; u < uNumPoints; ++u) {
         fTimeTotal += aoPoints[u].fTime * fTimeScale;
-        aoProcessPoints[u].uSamplePosition = (size_t)(fTimeTotal * PROCESS_RATE);
-        aoProcessPoints[u].fLevel = aoPoints[u].fLevel * fLevelScale;
+        size_t  uStart = (size_t)(fTimeTotal * PROCESS_RATE);
+        float64 fLevel = aoPoints[u].fLevel * fLevelScale;
+        if (uStart > uLastStart) {
+            Segment& roSegment   = aoSegments[uNumSegments++];
+            roSegment.uStart     = uLastStart;
+            roSegment.fIntercept = fLastLevel;
+            roSegment.fSlope     = (fLevel - fLastLevel) / (float64)(uStart - uLastStart);
+            if (0.0 == roSegment.fSlope) {
+                setConstantPacket(roSegment.poConstant, (float32)fLevel);
+            } else {
+                roSegment.poConstant.reset();
+            }
+        }
+        uLastStart = uStart;
+        fLastLevel = fLevel;
     }
 
-    size_t uLastPoint = uNumPoints - 1;
+    // The final level holds indefinitely
+    Segment& roFinal   = aoSegments[uNumSegments++];
+    roFinal.uStart     = uLastStart;
+    roFinal.fIntercept = fLastLevel;
+    roFinal.fSlope     = 0.0;
+    setConstantPacket(roFinal.poConstant, (float32)fLastLevel);
 
-    // Pad on the last ProcessPoint again, with a slight time offset to ensure that the interpolation code
-    // is always acting between a pair of ProcessPoints and doesn't wander off the end of the array
-    aoProcessPoints[uNumPoints] = aoProcessPoints[uLastPoint];
-    aoProcessPoints[uNumPoints].uSamplePosition += 16; // will never be reached.
-
-    // Fill the final packet with the last level value.
-    if (!pFinalPacket.get()) {
-        pFinalPacket = Packet::create();
-    }
-    pFinalPacket->fillWith((float32)aoProcessPoints[uLastPoint].fLevel);
-
-    uFinalSamplePosition = aoProcessPoints[uLastPoint].uSamplePosition;
+    // Timing may have changed under us, so restart the segment search from the beginning
+    uSegment = 0;
 
     // Clear the changed flag
     bParameterChanged = false;
 }
 
-/**
- * @inheritDoc
- */
-void Shape::updateInterpolants() {
-    ProcessPoint const& rA = pNextProcessPoint[0];
-    ProcessPoint const& rB = pNextProcessPoint[1];
-    fGradient = (rB.fLevel - rA.fLevel) / (float64)(rB.uSamplePosition - rA.uSamplePosition);
-    fYOffset  = rA.fLevel;
-    uXOffset  = rA.uSamplePosition;
-}
-
 } // namespace
@@ -15,12 +15,16 @@
 #include <cstdio>
 #include <synth/signal.hpp>
 
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#endif
+
 namespace MC64K::Synth::Audio::Signal {
 
-size_t Packet::uNextIndex        = 0;
-uint64 Packet::uPacketsCreated   = 0;
-uint64 Packet::uPacketsDestroyed = 0;
-uint64 Packet::uPeakPacketsInUse = 0;
+std::atomic<size_t> Packet::uNextIndex(0);
+std::atomic<uint64> Packet::uPacketsCreated(0);
+std::atomic<uint64> Packet::uPacketsDestroyed(0);
+std::atomic<uint64> Packet::uPeakPacketsInUse(0);
 
 Packet* Packet::fillWith(float32 fValue) {
     for (unsigned u = 0; u < PACKET_SIZE; ++u) {
@@ -71,6 +75,41 @@ Packet* Packet::accumulate(Packet const* poPacket, float32 fValue) {
     return this;
 }
 
+Packet* Packet::accumulateMany(Packet const* const* apoPackets, float32 const* afScales, size_t uCount) {
+    while (uCount > 0) {
+        size_t uPass = uCount < MAX_ACCUMULATE ? uCount : MAX_ACCUMULATE;
+
+#if defined(__AVX2__)
+        static_assert(0 == (PACKET_SIZE & 7), "PACKET_SIZE must be a multiple of 8 for AVX2 accumulate");
+        __m256 avScales[MAX_ACCUMULATE];
+        for (size_t i = 0; i < uPass; ++i) {
+            avScales[i] = _mm256_set1_ps(afScales[i]);
+        }
+        for (unsigned u = 0; u < PACKET_SIZE; u += 8) {
+            __m256 vSum = _mm256_loadu_ps(afSamples + u);
+            for (size_t i = 0; i < uPass; ++i) {
+                vSum = _mm256_add_ps(
+                    vSum,
+                    _mm256_mul_ps(_mm256_loadu_ps(apoPackets[i]->afSamples + u), avScales[i])
+                );
+            }
+            _mm256_storeu_ps(afSamples + u, vSum);
+        }
+#else
+        for (unsigned u = 0; u < PACKET_SIZE; ++u) {
+            float32 fSum = afSamples[u];
+            for (size_t i = 0; i < uPass; ++i) {
+                fSum += apoPackets[i]->afSamples[u] * afScales[i];
+            }
+            afSamples[u] = fSum;
+        }
+#endif
+        apoPackets += uPass;
+        afScales   += uPass;
+        uCount     -= uPass;
+    }
+    return this;
+}
 
 /**
  * Deleter hook for shared_ptr.
@@ -92,8 +131,9 @@ class Packet::Deleter {
 Packet::Ptr Packet::create() {
     Packet* poPacket = new Packet();
     uint64 uPacketsInUse = ++uPacketsCreated - uPacketsDestroyed;
-    if (uPacketsInUse > uPeakPacketsInUse) {
-        uPeakPacketsInUse = uPacketsInUse;
+    uint64 uPeak         = uPeakPacketsInUse;
+    while (uPacketsInUse > uPeak && !uPeakPacketsInUse.compare_exchange_weak(uPeak, uPacketsInUse)) {
+        // uPeak is refreshed on failure
     }
     return Ptr(poPacket, Deleter());
 }
@@ -102,11 +142,12 @@ Packet::Ptr Packet::create() {
  * @inheritDoc
  */
 Packet::ConstPtr Packet::getSilence() {
-    static Packet::Ptr pSilence;
-    if (!pSilence.get()) {
-        pSilence = Packet::create();
-        pSilence->fillWith(0.0f);
-    }
+    // Function local static initialisation is thread safe
+    static Packet::ConstPtr const pSilence = []() {
+        Packet::Ptr pPacket = Packet::create();
+        pPacket->clear();
+        return pPacket;
+    }();
     return pSilence;
 }
 
@@ -129,9 +170,9 @@ void Packet::dumpStats() {
         "\tCreated     : %lu\n"
         "\tDestroyed   : %lu\n"
         "\tPeak In Use : %lu\n",
-        uPacketsCreated,
-        uPacketsDestroyed,
-        uPeakPacketsInUse
+        uPacketsCreated.load(),
+        uPacketsDestroyed.load(),
+        uPeakPacketsInUse.load()
     );
 }
 
@@ -0,0 +1,354 @@
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <machine/timing.hpp>
+#include <synth/render.hpp>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#endif
+
+namespace MC64K::Synth::Audio {
+
+using MC64K::Machine::Nanoseconds;
+using namespace MC64K::StandardTestHost::Audio::IConfig;
+
+/**
+ * Number of samples converted and written per fwrite() call.
+ */
+constexpr size_t const WRITE_CHUNK = 65536;
+
+/**
+ * Minimal canonical RIFF WAVE header for 16-bit mono PCM.
+ */
+struct WavHeader {
+    char   acRiff[4];
+    uint32 uRiffSize;
+    char   acWave[4];
+    char   acFmt[4];
+    uint32 uFmtSize;
+    uint16 uFormat;
+    uint16 uChannels;
+    uint32 uSampleRate;
+    uint32 uByteRate;
+    uint16 uBlockAlign;
+    uint16 uBitsPerSample;
+    char   acData[4];
+    uint32 uDataSize;
+} __attribute__((packed));
+
+static_assert(44 == sizeof(WavHeader), "Unexpected WavHeader size");
+
+OfflineRenderer::OfflineRenderer(uint32 uMaxThreads) : uMaxThreads(uMaxThreads) {
+    if (!this->uMaxThreads) {
+        this->uMaxThreads = std::thread::hardware_concurrency();
+        if (!this->uMaxThreads) {
+            this->uMaxThreads = 1;
+        }
+    }
+}
+
+/**
+ * @inheritDoc
+ */
+OfflineRenderer* OfflineRenderer::addJob(Job const& roJob) {
+    aJobs.push_back(roJob);
+    return this;
+}
+
+/**
+ * SplitMix style seed derivation: each call advances the state and returns a well mixed, non zero xorshift seed.
+ */
+static inline uint32 nextSeed(uint32& ruState) {
+    uint32 uSeed = (ruState += 0x9E3779B9);
+    uSeed ^= uSeed >> 16;
+    uSeed *= 0x85EBCA6B;
+    uSeed ^= uSeed >> 13;
+    uSeed *= 0xC2B2AE35;
+    uSeed ^= uSeed >> 16;
+    return uSeed ? uSeed : 0x9E3779B9;
+}
+
+/**
+ * @inheritDoc
+ */
+void OfflineRenderer::convertDither(int16* piDestination, float32 const* pfSource, size_t uCount, uint32& ruSeed) {
+
+    constexpr float32 const SCALE     = 32767.0f;
+    constexpr float32 const LSB_RANGE = 1.0f / 65536.0f;
+
+    // TPDF dither: the difference of the two 16-bit halves of a 32-bit xorshift value gives a
+    // triangular distribution over (-1, 1) LSB.
+    uint32 uSeed = ruSeed ? ruSeed : 0x9E3779B9;
+
+#if defined(__AVX2__)
+    if (uCount >= 16) {
+        // Independent lane streams, so that no lane is a multiple of another or left at zero
+        uint32 uState = uSeed;
+        int32  aiLane[8];
+        for (unsigned u = 0; u < 8; ++u) {
+            aiLane[u] = (int32)nextSeed(uState);
+        }
+        __m256i vSeed  = _mm256_loadu_si256((__m256i const*)aiLane);
+        __m256i const vLow   = _mm256_set1_epi32(0xFFFF);
+        __m256  const vScale = _mm256_set1_ps(SCALE);
+        __m256  const vRange = _mm256_set1_ps(LSB_RANGE);
+
+        auto dither = [&]() {
+            vSeed = _mm256_xor_si256(vSeed, _mm256_slli_epi32(vSeed, 13));
+            vSeed = _mm256_xor_si256(vSeed, _mm256_srli_epi32(vSeed, 17));
+            vSeed = _mm256_xor_si256(vSeed, _mm256_slli_epi32(vSeed, 5));
+            __m256i vDiff = _mm256_sub_epi32(
+                _mm256_and_si256(vSeed, vLow),
+                _mm256_srli_epi32(vSeed, 16)
+            );
+            return _mm256_mul_ps(_mm256_cvtepi32_ps(vDiff), vRange);
+        };
+
+        while (uCount >= 16) {
+            __m256i vA = _mm256_cvtps_epi32(
+                _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(pfSource), vScale), dither())
+            );
+            __m256i vB = _mm256_cvtps_epi32(
+                _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(pfSource + 8), vScale), dither())
+            );
+            // packs operates per 128-bit lane, so restore the order afterwards
+            _mm256_storeu_si256(
+                (__m256i*)piDestination,
+                _mm256_permute4x64_epi64(_mm256_packs_epi32(vA, vB), 0xD8)
+            );
+            pfSource      += 16;
+            piDestination += 16;
+            uCount        -= 16;
+        }
+        uSeed = (uint32)_mm256_extract_epi32(vSeed, 0);
+        if (!uSeed) {
+            uSeed = 0x9E3779B9;
+        }
+    }
+#endif
+
+    while (uCount--) {
+        uSeed ^= uSeed << 13;
+        uSeed ^= uSeed >> 17;
+        uSeed ^= uSeed << 5;
+        float32 fDither = (float32)((int32)(uSeed & 0xFFFF) - (int32)(uSeed >> 16)) * LSB_RANGE;
+        float32 fSample = *pfSource++ * SCALE + fDither;
+        fSample = fSample > SCALE ? SCALE : (fSample < -SCALE - 1.0f ? -SCALE - 1.0f : fSample);
+        *piDestination++ = (int16)std::lrintf(fSample);
+    }
+    ruSeed = uSeed;
+}
+
+/**
+ * Mix, convert and write a job. Samples are converted a chunk at a time so that writes are large
+ * without needing a second full size buffer.
+ */
+bool OfflineRenderer::writeJob(Job const& roJob, float32 const* pfMix, size_t uSamples) {
+    std::FILE* poFile = std::fopen(roJob.sFileName.c_str(), "wb");
+    if (!poFile) {
+        std::fprintf(stderr, "OfflineRenderer: Unable to open %s for writing\n", roJob.sFileName.c_str());
+        return false;
+    }
+
+    if (WAV_16 == roJob.eFormat) {
+        uint32 uDataSize = (uint32)(uSamples * sizeof(int16));
+        WavHeader oHeader = {
+            {'R', 'I', 'F', 'F'},
+            uDataSize + (uint32)sizeof(WavHeader) - 8,
+            {'W', 'A', 'V', 'E'},
+            {'f', 'm', 't', ' '},
+            16,
+            1,
+            1,
+            (uint32)PROCESS_RATE,
+            (uint32)(PROCESS_RATE * sizeof(int16)),
+            (uint16)sizeof(int16),
+            16,
+            {'d', 'a', 't', 'a'},
+            uDataSize
+        };
+        if (1 != std::fwrite(&oHeader, sizeof(oHeader), 1, poFile)) {
+            std::fclose(poFile);
+            std::fprintf(stderr, "OfflineRenderer: Write failed for %s\n", roJob.sFileName.c_str());
+            return false;
+        }
+    }
+
+    std::vector<int16> aiChunk(WRITE_CHUNK);
+    uint32 uSeed  = 0;
+    bool   bOk    = true;
+    while (uSamples && bOk) {
+        size_t uCount = uSamples < WRITE_CHUNK ? uSamples : WRITE_CHUNK;
+        convertDither(aiChunk.data(), pfMix, uCount, uSeed);
+        bOk       = uCount == std::fwrite(aiChunk.data(), sizeof(int16), uCount, poFile);
+        pfMix    += uCount;
+        uSamples -= uCount;
+    }
+    std::fclose(poFile);
+    if (!bOk) {
+        std::fprintf(stderr, "OfflineRenderer: Write failed for %s\n", roJob.sFileName.c_str());
+    }
+    return bOk;
+}
+
+/**
+ * @inheritDoc
+ */
+OfflineRenderer::Statistics OfflineRenderer::render() {
+
+    Statistics oStats = { 0.0, 0.0, 0.0, 0.0, 0, 0 };
+
+    // Flatten all voices of all jobs into a single work list, clipping each voice to its job
+    struct WorkItem {
+        uint32 uJob;
+        uint32 uVoice;
+        size_t uStartPacket;
+        size_t uPackets;
+    };
+    std::vector<WorkItem> aWork;
+    for (uint32 uJob = 0; uJob < aJobs.size(); ++uJob) {
+        size_t uJobPackets = aJobs[uJob].uPackets;
+        for (uint32 uVoice = 0; uVoice < aJobs[uJob].aVoices.size(); ++uVoice) {
+            Voice const& roVoice = aJobs[uJob].aVoices[uVoice];
+            if (roVoice.uStartPacket >= uJobPackets) {
+                continue;
+            }
+            size_t uPackets = uJobPackets - roVoice.uStartPacket;
+            if (roVoice.uPackets && roVoice.uPackets < uPackets) {
+                uPackets = roVoice.uPackets;
+            }
+            aWork.push_back({ uJob, uVoice, roVoice.uStartPacket, uPackets });
+            oStats.fAudioSeconds += (float64)uPackets * PACKET_PERIOD;
+        }
+    }
+
+    oStats.uVoices  = (uint32)aWork.size();
+    oStats.uThreads = oStats.uVoices < uMaxThreads ? oStats.uVoices : uMaxThreads;
+    if (!oStats.uThreads) {
+        aJobs.clear();
+        return oStats;
+    }
+
+    // Each thread sums the voices it renders into its own per-job buffer, allocated on first use.
+    // This bounds memory by threads x jobs rather than by the number of voices.
+    std::vector<std::vector<std::vector<float32>>> aaThreadMix(
+        oStats.uThreads,
+        std::vector<std::vector<float32>>(aJobs.size())
+    );
+    std::atomic<size_t> uNextItem(0);
+
+    auto worker = [&](uint32 uThread) {
+        size_t uItem;
+        while ((uItem = uNextItem++) < aWork.size()) {
+            WorkItem const& roItem = aWork[uItem];
+            Job const& roJob = aJobs[roItem.uJob];
+            Signal::IStream::Ptr poStream = roJob.aVoices[roItem.uVoice].cCreate();
+            if (!poStream.get()) {
+                continue;
+            }
+            std::vector<float32>& rafMix = aaThreadMix[uThread][roItem.uJob];
+            if (rafMix.empty()) {
+                rafMix.resize(roJob.uPackets * PACKET_SIZE, 0.0f);
+            }
+            float32* pfMix = rafMix.data() + roItem.uStartPacket * PACKET_SIZE;
+            for (size_t uPacket = 0; uPacket < roItem.uPackets; ++uPacket) {
+                auto poPacket = poStream->emit();
+                float32 const* pfSource = poPacket->afSamples;
+                for (unsigned u = 0; u < PACKET_SIZE; ++u) {
+                    pfMix[u] += pfSource[u];
+                }
+                pfMix += PACKET_SIZE;
+            }
+        }
+    };
+
+    Nanoseconds::Value uMark = Nanoseconds::mark();
+    {
+        std::vector<std::thread> aThreads;
+        for (uint32 uThread = 1; uThread < oStats.uThreads; ++uThread) {
+            aThreads.emplace_back(worker, uThread);
+        }
+        worker(0);
+        for (auto& roThread : aThreads) {
+            roThread.join();
+        }
+    }
+    oStats.fRenderSeconds = 1.0e-9 * (float64)(Nanoseconds::mark() - uMark);
+
+    uMark = Nanoseconds::mark();
+    for (uint32 uJob = 0; uJob < aJobs.size(); ++uJob) {
+        Job const& roJob  = aJobs[uJob];
+        size_t   uSamples = roJob.uPackets * PACKET_SIZE;
+
+        // Reduce the per-thread buffers into the first one present, applying the job level
+        std::vector<float32>* pafMix = nullptr;
+        for (uint32 uThread = 0; uThread < oStats.uThreads; ++uThread) {
+            std::vector<float32>& rafThreadMix = aaThreadMix[uThread][uJob];
+            if (rafThreadMix.empty()) {
+                continue;
+            }
+            if (!pafMix) {
+                pafMix = &rafThreadMix;
+                continue;
+            }
+            float32*       pfDest   = pafMix->data();
+            float32 const* pfSource = rafThreadMix.data();
+            for (size_t u = 0; u < uSamples; ++u) {
+                pfDest[u] += pfSource[u];
+            }
+            rafThreadMix = std::vector<float32>();
+        }
+
+        std::vector<float32> afSilence;
+        if (!pafMix) {
+            afSilence.resize(uSamples, 0.0f);
+            pafMix = &afSilence;
+        }
+        float32* pfDest = pafMix->data();
+        for (size_t u = 0; u < uSamples; ++u) {
+            pfDest[u] *= roJob.fLevel;
+        }
+        writeJob(roJob, pfDest, uSamples);
+        *pafMix = std::vector<float32>();
+    }
+    oStats.fOutputSeconds = 1.0e-9 * (float64)(Nanoseconds::mark() - uMark);
+    oStats.fRealtimeFactor = oStats.fAudioSeconds / (oStats.fRenderSeconds + oStats.fOutputSeconds);
+
+    std::fprintf(
+        stderr,
+        "OfflineRenderer: %zu job(s), %u voice(s) on %u thread(s)\n"
+        "\tAudio   : %.3f voice-seconds\n"
+        "\tRender  : %.3f s\n"
+        "\tOutput  : %.3f s\n"
+        "\tSpeed   : %.2f x realtime [%.2f x realtime per thread]\n",
+        aJobs.size(),
+        oStats.uVoices,
+        oStats.uThreads,
+        oStats.fAudioSeconds,
+        oStats.fRenderSeconds,
+        oStats.fOutputSeconds,
+        oStats.fRealtimeFactor,
+        oStats.fRealtimeFactor / (float64)oStats.uThreads
+    );
+
+    aJobs.clear();
+    return oStats;
+}
+
+}
@@ -0,0 +1,315 @@
+/**
+ *   888b     d888  .d8888b.   .d8888b.      d8888  888    d8P
+ *   8888b   d8888 d88P  Y88b d88P  Y88b    d8P888  888   d8P
+ *   88888b.d88888 888    888 888          d8P 888  888  d8P
+ *   888Y88888P888 888        888d888b.   d8P  888  888d88K
+ *   888 Y888P 888 888        888P "Y88b d88   888  8888888b
+ *   888  Y8P  888 888    888 888    888 8888888888 888  Y88b
+ *   888   "   888 Y88b  d88P Y88b  d88P       888  888   Y88b
+ *   888       888  "Y8888P"   "Y8888P"        888  888    Y88b
+ *
+ *    - 64-bit 680x0-inspired Virtual Machine and assembler -
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <synth/note.hpp>
+#include <synth/render.hpp>
+#include <synth/signal/oscillator/sound.hpp>
+#include <synth/signal/envelope/shape.hpp>
+#include <synth/signal/filter/4polemulti.hpp>
+
+namespace MC64K::Synth::Audio {
+
+using namespace MC64K::StandardTestHost::Audio::IConfig;
+
+/**
+ * Longest description line accepted
+ */
+constexpr size_t const MAX_LINE = 256;
+
+/**
+ * Maximum number of arguments following the keyword
+ */
+constexpr unsigned const MAX_ARGS = 4;
+
+/**
+ * Sound parameters applied to each note of a job description.
+ */
+struct Patch {
+    Signal::IWaveform::FixedShape           eWave;
+    float32                                 fAttack;
+    float32                                 fDecay;
+    float32                                 fSustain;
+    float32                                 fRelease;
+    Signal::Filter::FourPoleMultiMode::Mode eFilterMode;
+    float32                                 fCutoff;
+    float32                                 fResonance;
+    bool                                    bFilter;
+};
+
+struct WaveName {
+    char const*                   sName;
+    Signal::IWaveform::FixedShape eWave;
+};
+
+static WaveName const aWaveNames[] = {
+    { "sine",     Signal::IWaveform::SINE     },
+    { "triangle", Signal::IWaveform::TRIANGLE },
+    { "saw_down", Signal::IWaveform::SAW_DOWN },
+    { "saw_up",   Signal::IWaveform::SAW_UP   },
+    { "square",   Signal::IWaveform::SQUARE   },
+    { "pulse",    Signal::IWaveform::PULSE    },
+    { "pokey",    Signal::IWaveform::POKEY    },
+    { "noise",    Signal::IWaveform::NOISE    },
+};
+
+struct FilterName {
+    char const*                             sName;
+    Signal::Filter::FourPoleMultiMode::Mode eMode;
+};
+
+static FilterName const aFilterNames[] = {
+    { "low_pass",    Signal::Filter::FourPoleMultiMode::LOW_PASS    },
+    { "hi_pass",     Signal::Filter::FourPoleMultiMode::HI_PASS     },
+    { "band_pass",   Signal::Filter::FourPoleMultiMode::BAND_PASS   },
+    { "band_reject", Signal::Filter::FourPoleMultiMode::BAND_REJECT },
+};
+
+/**
+ * Parse a float argument, requiring the whole token to be consumed and the value to be in range.
+ */
+static bool parseFloat(char const* sToken, float32 fMin, float32 fMax, float32& rfValue) {
+    char* sEnd = nullptr;
+    float32 fValue = std::strtof(sToken, &sEnd);
+    if (sEnd == sToken || *sEnd || !(fValue >= fMin && fValue <= fMax)) {
+        return false;
+    }
+    rfValue = fValue;
+    return true;
+}
+
+/**
+ * Convert a duration in seconds to a whole number of packets, rounding up.
+ */
+static size_t toPackets(float32 fSeconds) {
+    return (size_t)std::ceil((float64)fSeconds / PACKET_PERIOD);
+}
+
+/**
+ * Builds the stream for one note: an oscillator under an attack, decay, sustain, release shape,
+ * optionally followed by the filter. The note is released after fHold seconds of sustain.
+ */
+static Signal::IStream::Ptr createNote(Patch const& roPatch, float32 fFrequency, float32 fLevel, float32 fHold) {
+    std::shared_ptr<Signal::Oscillator::Sound> poSound(
+        new Signal::Oscillator::Sound(
+            Signal::IWaveform::get(roPatch.eWave),
+            fFrequency,
+            0.0f
+        )
+    );
+    float32 fSustain = fLevel * roPatch.fSustain;
+    Signal::IEnvelope::Ptr poEnvelope(
+        new Signal::Envelope::Shape(
+            0.0f,
+            {
+                { fLevel,   roPatch.fAttack  },
+                { fSustain, roPatch.fDecay   },
+                { fSustain, fHold            },
+                { 0.0f,     roPatch.fRelease },
+            }
+        )
+    );
+    poSound->setLevelEnvelope(poEnvelope);
+
+    Signal::IStream::Ptr poOutput = poSound;
+    if (roPatch.bFilter) {
+        poOutput = Signal::IStream::Ptr(
+            new Signal::Filter::FourPoleMultiMode(
+                poSound,
+                roPatch.eFilterMode,
+                roPatch.fCutoff,
+                roPatch.fResonance
+            )
+        );
+    }
+    poOutput->enable();
+    return poOutput;
+}
+
+/**
+ * @inheritDoc
+ */
+bool OfflineRenderer::loadJob(char const* sFileName) {
+    std::FILE* poFile = std::fopen(sFileName, "r");
+    if (!poFile) {
+        std::fprintf(stderr, "OfflineRenderer: Unable to open job description %s\n", sFileName);
+        return false;
+    }
+
+    Job oJob = { {}, "", 0, 1.0f, RAW_16 };
+    Patch oPatch = {
+        Signal::IWaveform::SINE,
+        Signal::Envelope::Shape::MIN_TIME,
+        Signal::Envelope::Shape::MIN_TIME,
+        1.0f,
+        Signal::Envelope::Shape::MIN_TIME,
+        Signal::Filter::FourPoleMultiMode::LOW_PASS,
+        1.0f,
+        0.0f,
+        false
+    };
+    float32     fTail  = 0.0f;
+    size_t      uEnd   = 0;
+    unsigned    uLine  = 0;
+    char const* sError = nullptr;
+    char        sLine[MAX_LINE];
+
+    while (!sError && std::fgets(sLine, sizeof(sLine), poFile)) {
+        ++uLine;
+        size_t uLength = std::strlen(sLine);
+        if (uLength == sizeof(sLine) - 1 && sLine[uLength - 1] != '\n' && !std::feof(poFile)) {
+            sError = "Line too long";
+            break;
+        }
+        if (char* sComment = std::strchr(sLine, '#')) {
+            *sComment = 0;
+        }
+
+        char const* sKeyword = std::strtok(sLine, " \t\r\n");
+        if (!sKeyword) {
+            continue;
+        }
+        char const* asArgs[MAX_ARGS + 1] = { nullptr };
+        unsigned uArgs = 0;
+        while (uArgs <= MAX_ARGS && (asArgs[uArgs] = std::strtok(nullptr, " \t\r\n"))) {
+            ++uArgs;
+        }
+        if (uArgs > MAX_ARGS) {
+            sError = "Too many arguments";
+            break;
+        }
+
+        if (0 == std::strcmp(sKeyword, "output")) {
+            if (1 != uArgs) {
+                sError = "Expected output <file>";
+                break;
+            }
+            oJob.sFileName = asArgs[0];
+            size_t uNameLength = oJob.sFileName.size();
+            oJob.eFormat = (uNameLength > 4 && 0 == oJob.sFileName.compare(uNameLength - 4, 4, ".wav")) ?
+                WAV_16 :
+                RAW_16;
+        } else if (0 == std::strcmp(sKeyword, "level")) {
+            if (1 != uArgs || !parseFloat(asArgs[0], -16.0f, 16.0f, oJob.fLevel)) {
+                sError = "Expected level <level>";
+            }
+        } else if (0 == std::strcmp(sKeyword, "tail")) {
+            if (1 != uArgs || !parseFloat(asArgs[0], 0.0f, Signal::Envelope::Shape::MAX_TIME, fTail)) {
+                sError = "Expected tail <seconds>";
+            }
+        } else if (0 == std::strcmp(sKeyword, "wave")) {
+            sError = "Expected wave <name>";
+            for (auto const& roWave : aWaveNames) {
+                if (1 == uArgs && 0 == std::strcmp(asArgs[0], roWave.sName)) {
+                    oPatch.eWave = roWave.eWave;
+                    sError = nullptr;
+                    break;
+                }
+            }
+        } else if (0 == std::strcmp(sKeyword, "attack")) {
+            if (1 != uArgs || !parseFloat(asArgs[0], 0.0f, Signal::Envelope::Shape::MAX_TIME, oPatch.fAttack)) {
+                sError = "Expected attack <seconds>";
+            }
+        } else if (0 == std::strcmp(sKeyword, "decay")) {
+            if (1 != uArgs || !parseFloat(asArgs[0], 0.0f, Signal::Envelope::Shape::MAX_TIME, oPatch.fDecay)) {
+                sError = "Expected decay <seconds>";
+            }
+        } else if (0 == std::strcmp(sKeyword, "sustain")) {
+            if (1 != uArgs || !parseFloat(asArgs[0], 0.0f, 1.0f, oPatch.fSustain)) {
+                sError = "Expected sustain <level>";
+            }
+        } else if (0 == std::strcmp(sKeyword, "release")) {
+            if (1 != uArgs || !parseFloat(asArgs[0], 0.0f, Signal::Envelope::Shape::MAX_TIME, oPatch.fRelease)) {
+                sError = "Expected release <seconds>";
+            }
+        } else if (0 == std::strcmp(sKeyword, "filter")) {
+            if (1 == uArgs && 0 == std::strcmp(asArgs[0], "off")) {
+                oPatch.bFilter = false;
+                continue;
+            }
+            sError = "Expected filter <mode> <cutoff> <resonance> or filter off";
+            if (
+                3 != uArgs ||
+                !parseFloat(asArgs[1], 0.0f, 1.0f, oPatch.fCutoff) ||
+                !parseFloat(asArgs[2], 0.0f, 1.0f, oPatch.fResonance)
+            ) {
+                break;
+            }
+            for (auto const& roFilter : aFilterNames) {
+                if (0 == std::strcmp(asArgs[0], roFilter.sName)) {
+                    oPatch.eFilterMode = roFilter.eMode;
+                    oPatch.bFilter     = true;
+                    sError             = nullptr;
+                    break;
+                }
+            }
+        } else if (0 == std::strcmp(sKeyword, "note")) {
+            uint32  uNote     = uArgs >= 3 ? Note::getNumber(asArgs[0]) : Note::ILLEGAL_NOTE;
+            float32 fStart    = 0.0f;
+            float32 fDuration = 0.0f;
+            float32 fVelocity = 127.0f;
+            if (
+                Note::ILLEGAL_NOTE == uNote ||
+                !parseFloat(asArgs[1], 0.0f, 86400.0f, fStart) ||
+                !parseFloat(asArgs[2], 0.0f, Signal::Envelope::Shape::MAX_TIME, fDuration) ||
+                (4 == uArgs && !parseFloat(asArgs[3], 0.0f, 127.0f, fVelocity))
+            ) {
+                sError = "Expected note <name> <start> <duration> [velocity]";
+                break;
+            }
+
+            // The note is released once its duration has passed, but not before the attack and
+            // decay phases have completed.
+            float32 fHold = fDuration - oPatch.fAttack - oPatch.fDecay;
+            if (fHold < 0.0f) {
+                fHold = 0.0f;
+            }
+            float32 fLength = oPatch.fAttack + oPatch.fDecay + fHold + oPatch.fRelease;
+
+            Patch   oNotePatch = oPatch;
+            float32 fFrequency = Note::getFrequency((int32)uNote);
+            float32 fLevel     = fVelocity * (1.0f / 127.0f);
+            Voice oVoice = {
+                [oNotePatch, fFrequency, fLevel, fHold]() {
+                    return createNote(oNotePatch, fFrequency, fLevel, fHold);
+                },
+                (size_t)std::lround((float64)fStart / PACKET_PERIOD),
+                toPackets(fLength)
+            };
+            oJob.aVoices.push_back(oVoice);
+            if (oVoice.uStartPacket + oVoice.uPackets > uEnd) {
+                uEnd = oVoice.uStartPacket + oVoice.uPackets;
+            }
+        } else {
+            sError = "Unknown keyword";
+        }
+    }
+    std::fclose(poFile);
+
+    if (!sError && oJob.sFileName.empty()) {
+        sError = "No output file given";
+    }
+    if (sError) {
+        std::fprintf(stderr, "OfflineRenderer: %s:%u: %s\n", sFileName, uLine, sError);
+        return false;
+    }
+
+    oJob.uPackets = uEnd + toPackets(fTail);
+    addJob(oJob);
+    return true;
+}
+
+}
@@ -44,13 +44,13 @@ SimpleMixer* SimpleMixer::reset() {
         p->clear();
     }
     std::fprintf(stderr, "SimpleMixer %p reset()\n", this);
-    for (auto pPair = oChannels.begin(); pPair != oChannels.end(); ++pPair) {
-        pPair->second.poSource->reset();
+    for (auto& roChannel : oChannels) {
+        roChannel.poSource->reset();
         std::fprintf(
             stderr,
             "\tResetting input ID:%lu [%p]\n",
-            pPair->first,
-            pPair->second.poSource.get()
+            roChannel.uID,
+            roChannel.poSource.get()
         );
     }
     return this;
@@ -70,20 +70,34 @@ Packet::ConstPtr SimpleMixer::emit(size_t uIndex) {
 }
 
 Packet::ConstPtr SimpleMixer::emitNew() {
+
+    // Gather the enabled inputs first. Disabled inputs are skipped on their flag alone, without
+    // being asked to emit.
+    oInputPackets.clear();
+    oInputPtrs.clear();
+    oInputLevels.clear();
+    for (auto& roChannel : oChannels) {
+        if (roChannel.poSource->isEnabled()) {
+            oInputPackets.push_back(roChannel.poSource->emit(uLastIndex));
+            oInputPtrs.push_back(oInputPackets.back().get());
+            oInputLevels.push_back(roChannel.fLevel * fOutputLevel);
+        }
+    }
+
     if (!poLastPacket.get()) {
         poLastPacket = Packet::create();
     }
-    Packet* pOutput = poLastPacket.get();
-    pOutput->clear();
-    for (auto pPair = oChannels.begin(); pPair != oChannels.end(); ++pPair) {
-        if (pPair->second.poSource->isEnabled()) {
-            pOutput->accumulate(
-                pPair->second.poSource->emit(uLastIndex),
-                pPair->second.fLevel
-            );
-        }
+    poLastPacket->clear();
+    if (!oInputPtrs.empty()) {
+        poLastPacket->accumulateMany(
+            oInputPtrs.data(),
+            oInputLevels.data(),
+            oInputPtrs.size()
+        );
     }
-    pOutput->scaleBy(fOutputLevel);
+
+    // Release our references to the input packets as soon as we are done with them.
+    oInputPackets.clear();
     return poLastPacket;
 }
 
@@ -111,9 +125,15 @@ SimpleMixer* SimpleMixer::addInputStream(SimpleMixer::ChannelID uID, IStream::Pt
     if (poSource.get()) {
 
         std::fprintf(stderr, "SimpleMixer %p addInputStream() setting %p [ID:%lu]\n", this, poSource.get(), uID);
-        Channel& roChannel = oChannels[uID];
-        roChannel.poSource  = poSource;
-        roChannel.fLevel   = fLevel;
+        auto pSlot = oChannelSlots.find(uID);
+        if (pSlot != oChannelSlots.end()) {
+            Channel& roChannel = oChannels[pSlot->second];
+            roChannel.poSource = poSource;
+            roChannel.fLevel   = fLevel;
+        } else {
+            oChannelSlots[uID] = oChannels.size();
+            oChannels.push_back({poSource, uID, fLevel});
+        }
     } else {
         std::fprintf(stderr, "SimpleMixer %p addInputStream() not adding empty stream [ID:%lu]\n", this, uID);
     }
@@ -121,10 +141,20 @@ SimpleMixer* SimpleMixer::addInputStream(SimpleMixer::ChannelID uID, IStream::Pt
 }
 
 /**
- *  Removes an input stream, if it is attached.
+ *  Removes an input stream, if it is attached. The last channel is moved into the vacated slot
+ *  to keep the channel list dense.
  */
 SimpleMixer* SimpleMixer::removeIputStream(SimpleMixer::ChannelID uID) {
-    oChannels.erase(uID);
+    auto pSlot = oChannelSlots.find(uID);
+    if (pSlot != oChannelSlots.end()) {
+        size_t uSlot = pSlot->second;
+        oChannelSlots.erase(pSlot);
+        if (uSlot != oChannels.size() - 1) {
+            oChannels[uSlot] = std::move(oChannels.back());
+            oChannelSlots[oChannels[uSlot].uID] = uSlot;
+        }
+        oChannels.pop_back();
+    }
     return this;
 }
 
@@ -135,9 +165,9 @@ SimpleMixer* SimpleMixer::removeIputStream(SimpleMixer::ChannelID uID) {
  * @return float32
  */
 float32 SimpleMixer::getInputLevel(SimpleMixer::ChannelID uID) const {
-    auto pChannel = oChannels.find(uID);
-    if (pChannel != oChannels.end()) {
-        return pChannel->second.fLevel;
+    auto pSlot = oChannelSlots.find(uID);
+    if (pSlot != oChannelSlots.end()) {
+        return oChannels[pSlot->second].fLevel;
     }
     return 0.0f;
 }
@@ -150,9 +180,9 @@ float32 SimpleMixer::getInputLevel(SimpleMixer::ChannelID uID) const {
  * @return float32
  */
 SimpleMixer* SimpleMixer::setInputLevel(SimpleMixer::ChannelID uID, float32 fLevel) {
-    auto pChannel = oChannels.find(uID);
-    if (pChannel != oChannels.end()) {
-        pChannel->second.fLevel = fLevel;
+    auto pSlot = oChannelSlots.find(uID);
+    if (pSlot != oChannelSlots.end()) {
+        oChannels[pSlot->second].fLevel = fLevel;
     }
     return this;
 }
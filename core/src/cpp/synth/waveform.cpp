@@ -238,6 +238,7 @@ FixedPWM::~FixedPWM() {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <atomic>
 #include <random>
 #include <synth/signal/waveform/noise.hpp>
 #include <synth/signal/waveform/xform.hpp>
@@ -245,9 +246,22 @@ FixedPWM::~FixedPWM() {
 namespace MC64K::Synth::Audio::Signal::Waveform {
 
 /**
- * 32-bit mersenne
+ * Distinct seed for each thread's generator, so that threads rendering noise concurrently do not all produce the
+ * same sequence.
  */
-std::mt19937 mt_rand;
+static uint32 threadSeed() {
+    static std::atomic<uint32> uThreadCount{0};
+    uint32 uSeed = uThreadCount.fetch_add(1, std::memory_order_relaxed) * 0x9E3779B9 + 5489;
+    uSeed ^= uSeed >> 16;
+    uSeed *= 0x85EBCA6B;
+    uSeed ^= uSeed >> 13;
+    return uSeed;
+}
+
+/**
+ * 32-bit mersenne. Per thread, so that independent voices can be rendered concurrently.
+ */
+thread_local std::mt19937 mt_rand(threadSeed());
 
 WhiteNoise::WhiteNoise() {
     fNormalise = 4.0f / (float64) mt_rand.max();
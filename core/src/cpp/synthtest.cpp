@@ -1,8 +1,10 @@
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <mc64k.hpp>
 #include <machine/timing.hpp>
 #include <synth/note.hpp>
+#include <synth/render.hpp>
 #include <synth/signal.hpp>
 #include <synth/signal/operator/mixer.hpp>
 #include <synth/signal/operator/automute.hpp>
@@ -18,26 +20,6 @@ using namespace MC64K::StandardTestHost::Audio::IConfig;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-/**
- * Outputs a stream to a 16-bit raw file for a number of packets.
- */
-void writeRawFile(Signal::IStream* pStream, char const* sName, size_t uPackets) {
-    int16 afSamples[PACKET_SIZE];
-    std::FILE* pRawFile = std::fopen(sName, "wb");
-    if (pRawFile) {
-        for (size_t uIndex = 0; uIndex < uPackets; ++uIndex) {
-            auto pOutput = pStream->emit();
-            for (unsigned i = 0; i < PACKET_SIZE; ++i) {
-                afSamples[i] = (int16)(32000 * pOutput->afSamples[i]);
-            }
-            std::fwrite(afSamples, sizeof(int16), PACKET_SIZE, pRawFile);
-        }
-        std::fclose(pRawFile);
-    }
-}
-
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
 /**
  * Tests the standard waveforms
  */
@@ -217,7 +199,11 @@ void benchmark(Signal::IStream* pStream) {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void mixtest() {
+/**
+ * Builds the mix test graph: three sine oscillators, one phase modulating another under a decay
+ * envelope, summed by a SimpleMixer.
+ */
+Signal::IStream::Ptr createMixTest() {
     Signal::IStream::Ptr pStream1 (
         new Signal::Oscillator::Sound(
             Signal::IWaveform::get(Signal::IWaveform::SINE),
@@ -256,29 +242,75 @@ void mixtest() {
 
     std::reinterpret_pointer_cast<Signal::Oscillator::Sound>(pStream3)->setLevelEnvelope(pEnv);
 
-    Signal::Operator::SimpleMixer oMix(1.0f);
+    std::shared_ptr<Signal::Operator::SimpleMixer> pMix(new Signal::Operator::SimpleMixer(1.0f));
 
-    oMix.addInputStream(
+    pMix->addInputStream(
         0xdeadbeef,
         pStream1,
         0.8f
     );
 
-    oMix.addInputStream(
+    pMix->addInputStream(
         0xabadafe,
         pStream2,
         0.1f
     );
 
-    oMix.addInputStream(
+    pMix->addInputStream(
         0x69696969,
         pStream3,
         0.1f
     );
 
-    oMix.enable();
+    pMix->enable();
 
-    writeRawFile(&oMix, "mix_test.raw", 1000);
+    return pMix;
+}
+
+void mixtest() {
+    OfflineRenderer oRenderer;
+    oRenderer.addJob({
+        { { createMixTest, 0, 0 } },
+        "mix_test.raw",
+        1000,
+        1.0f,
+        OfflineRenderer::RAW_16
+    });
+    oRenderer.addJob({
+        { { createMixTest, 0, 0 } },
+        "mix_test.wav",
+        1000,
+        1.0f,
+        OfflineRenderer::WAV_16
+    });
+    oRenderer.render();
+}
+
+/**
+ * Bounces a job of many independent copies of the mix test graph to measure how many voices can
+ * be sustained per core.
+ */
+void bounceBenchmark(unsigned uVoices, size_t uPackets) {
+    OfflineRenderer::Job oJob = {
+        {},
+        "bounce_test.wav",
+        uPackets,
+        1.0f / (float32)uVoices,
+        OfflineRenderer::WAV_16
+    };
+    oJob.aVoices.assign(uVoices, { createMixTest, 0, 0 });
+
+    OfflineRenderer oRenderer;
+    oRenderer.addJob(oJob);
+    OfflineRenderer::Statistics oStats = oRenderer.render();
+    std::printf(
+        "Bounced %u voices x %.2f s on %u threads: %.2f x realtime (%.1f realtime voices per thread)\n",
+        oStats.uVoices,
+        (float64)uPackets * PACKET_PERIOD,
+        oStats.uThreads,
+        oStats.fRealtimeFactor,
+        oStats.fRealtimeFactor / (float64)oStats.uThreads
+    );
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -346,6 +378,18 @@ int main(int const iArgCount, char const** aiArgVal) {
 
     testNotes();
     mixtest();
+
+    // The bounce benchmark writes bounce_test.wav, so only runs when asked for
+    for (int i = 1; i < iArgCount; ++i) {
+        if (0 == std::strcmp(aiArgVal[i], "--bounce")) {
+            bounceBenchmark(64, 5000);
+        } else if (0 == std::strcmp(aiArgVal[i], "--render") && i + 1 < iArgCount) {
+            OfflineRenderer oRenderer;
+            if (oRenderer.loadJob(aiArgVal[++i])) {
+                oRenderer.render();
+            }
+        }
+    }
     Signal::Packet::dumpStats();
 
     return EXIT_SUCCESS;